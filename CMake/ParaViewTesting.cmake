@@ -29,6 +29,20 @@ function(paraview_add_test_driven)
   vtk_add_test_python(${ARGN})
 endfunction ()
 
+# Same as `paraview_add_test_driven` but with separate data and render servers.
+function(paraview_add_test_driven_render_server)
+  if (NOT (TARGET pvdataserver AND TARGET pvrenderserver AND TARGET pvpython))
+    return()
+  endif ()
+  set(_vtk_testing_python_exe "$<TARGET_FILE:ParaView::smTestDriver>")
+  set(_vtk_test_python_args
+    --data-server $<TARGET_FILE:ParaView::pvdataserver>
+    --render-server $<TARGET_FILE:ParaView::pvrenderserver>
+    --client $<TARGET_FILE:ParaView::pvpython> --dr)
+  set(vtk_test_prefix "DRS-${vtk_test_prefix}")
+  vtk_add_test_python(${ARGN})
+endfunction ()
+
 function (_paraview_add_tests function)
   cmake_parse_arguments(_paraview_add_tests
     "FORCE_SERIAL;FORCE_LOCK;SMTESTING_ALLOW_ERRORS"
@@ -0,0 +1,73 @@
+# Checks that, with geometry caching enabled, prefetching the next animation
+# frame on the server turns the ticks of the following frames into cache hits.
+from paraview import servermanager
+from paraview import simple as smp
+from paraview.modules.vtkRemotingSettings import vtkPVGeneralSettings
+
+# Make sure the test driver know that process has properly started
+print ("Process started")
+
+def getHost(url):
+   return url.split(':')[1][2:]
+def getPort(url):
+   return int(url.split(':')[2])
+
+def cacheStatistics(view):
+    info = servermanager.vtkPVViewCacheInformation()
+    view.SMProxy.GatherInformation(info)
+    return info.GetNumberOfHits(), info.GetNumberOfMisses()
+
+def play(view, scene):
+    hits, misses = cacheStatistics(view)
+    scene.GoToFirst()
+    scene.Play()
+    newHits, newMisses = cacheStatistics(view)
+    return newHits - hits, newMisses - misses
+
+def runTest():
+    options = servermanager.vtkRemotingCoreConfiguration.GetInstance()
+    url = options.GetServerURL()
+    smp.Connect(getHost(url), getPort(url))
+
+    source = smp.TimeSource(XAmplitude=1)
+    view = smp.CreateRenderView()
+    smp.Show(source, view)
+    smp.Render(view)
+
+    scene = smp.GetAnimationScene()
+    scene.UpdateAnimationUsingDataTimeSteps()
+    scene.PlayMode = 'Snap To TimeSteps'
+    numberOfFrames = len(source.TimestepValues)
+
+    settings = vtkPVGeneralSettings.GetInstance()
+    settings.SetCacheGeometryForAnimation(True)
+
+    # without prefetching, every frame of the first playback is a miss except
+    # the first one, already shown by GoToFirst().
+    settings.SetPrefetchNextFrameForAnimation(False)
+    hits, misses = play(view, scene)
+    if hits > 1:
+        raise RuntimeError("Expected at most 1 hit without prefetching, got %d." % hits)
+
+    # modifying the source clears the cache.
+    source.XAmplitude = 2
+    smp.Render(view)
+
+    # with prefetching, each frame is prepared while the previous one is shown.
+    # GoToFirst() misses the first frame, the following frames are misses when
+    # prefetched and hits when shown. Going back to the shown frame after a
+    # prefetch is not counted.
+    settings.SetPrefetchNextFrameForAnimation(True)
+    hits, misses = play(view, scene)
+    if hits != numberOfFrames - 1:
+        raise RuntimeError("Expected %d hits with prefetching, got %d." %
+            (numberOfFrames - 1, hits))
+    if misses != numberOfFrames:
+        raise RuntimeError("Expected %d misses with prefetching, got %d." %
+            (numberOfFrames, misses))
+
+    settings.SetPrefetchNextFrameForAnimation(False)
+    settings.SetCacheGeometryForAnimation(False)
+    print ("Test Passed")
+
+runTest()
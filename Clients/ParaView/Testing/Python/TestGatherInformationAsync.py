@@ -0,0 +1,59 @@
+# Checks GatherInformationAsync/WaitForGatherInformation against the data
+# server and the render server, including replies received while the client
+# is blocked on another request to the same server.
+from paraview import servermanager
+from paraview import simple as smp
+
+# Make sure the test driver know that process has properly started
+print ("Process started")
+
+def connect(url):
+    # cs://host:port or cdsrs://dshost:dsport/rshost:rsport
+    servers = url.split('://')[1].split('/')
+    ds_host, ds_port = servers[0].split(':')
+    if len(servers) > 1:
+        rs_host, rs_port = servers[1].split(':')
+        return smp.Connect(ds_host, int(ds_port), rs_host, int(rs_port))
+    return smp.Connect(ds_host, int(ds_port))
+
+def runTest():
+    options = servermanager.vtkRemotingCoreConfiguration.GetInstance()
+    connect(options.GetServerURL())
+    session = servermanager.ActiveConnection.Session
+
+    sphere = smp.Sphere(ThetaResolution=32, PhiResolution=32)
+    sphere.UpdatePipeline()
+    expected = sphere.GetDataInformation().GetNumberOfPoints()
+
+    # data server.
+    dataInfo = servermanager.vtkPVDataInformation()
+    request = session.GatherInformationAsync(
+        servermanager.vtkSMSession.DATA_SERVER, dataInfo, sphere.SMProxy.GetGlobalID())
+    if request == 0 or not session.WaitForGatherInformation(request):
+        raise RuntimeError("Failed to gather data information asynchronously.")
+    if dataInfo.GetNumberOfPoints() != expected:
+        raise RuntimeError("Expected %d points, got %d." % (expected, dataInfo.GetNumberOfPoints()))
+
+    # a request that completed cannot be waited for again.
+    if session.WaitForGatherInformation(request):
+        raise RuntimeError("Completed request must be unknown.")
+
+    for location in (servermanager.vtkSMSession.DATA_SERVER,
+                     servermanager.vtkSMSession.RENDER_SERVER):
+        reference = servermanager.vtkPVServerInformation()
+        session.GatherInformation(location, reference, 0)
+
+        # the reply of the asynchronous request arrives while the client waits
+        # for the reply of the blocking one, on the same connection.
+        info = servermanager.vtkPVServerInformation()
+        request = session.GatherInformationAsync(location, info, 0)
+        blocking = servermanager.vtkPVServerInformation()
+        session.GatherInformation(location, blocking, 0)
+        if not session.WaitForGatherInformation(request):
+            raise RuntimeError("Failed to gather server information from %d." % location)
+        for result in (info, blocking):
+            if result.GetNumberOfProcesses() != reference.GetNumberOfProcesses():
+                raise RuntimeError("Server information mismatch for %d." % location)
+    print ("Test Passed")
+
+runTest()
@@ -0,0 +1,73 @@
+# Checks that state pushed while a push transaction is open reaches the
+# server before it renders.
+from paraview import servermanager
+from paraview import simple as smp
+from paraview.vtk.util.misc import vtkGetTempDir
+from paraview.vtk.vtkIOImage import vtkPNGReader
+from os.path import join
+
+# Make sure the test driver know that process has properly started
+print ("Process started")
+
+def getHost(url):
+   return url.split(':')[1][2:]
+def getPort(url):
+   return int(url.split(':')[2])
+
+def centerColor(view):
+    filename = join(vtkGetTempDir(), "TestPushTransactionRenderOrder.png")
+    smp.SaveScreenshot(filename, view, ImageResolution=[200, 200])
+    reader = vtkPNGReader()
+    reader.SetFileName(filename)
+    reader.Update()
+    image = reader.GetOutput()
+    dims = image.GetDimensions()
+    scalars = image.GetPointData().GetScalars()
+    color = scalars.GetTuple((dims[1] // 2) * dims[0] + dims[0] // 2)
+    return [int(c) for c in color[:3]]
+
+def checkColor(view, expected, label):
+    color = centerColor(view)
+    if any(abs(c - e) > 5 for c, e in zip(color, expected)):
+        raise RuntimeError("%s: expected %s, got %s" % (label, expected, color))
+
+def runTest():
+    options = servermanager.vtkRemotingCoreConfiguration.GetInstance()
+    url = options.GetServerURL()
+    smp.Connect(getHost(url), getPort(url))
+
+    view = smp.CreateRenderView()
+    view.RemoteRenderThreshold = 0
+    view.OrientationAxesVisibility = 0
+    view.UseColorPaletteForBackground = 0
+    view.Background = [0, 0, 0]
+
+    sphere = smp.Sphere(Radius=4)
+    display = smp.Show(sphere, view)
+    display.Ambient = 1
+    display.Diffuse = 0
+    display.AmbientColor = [1, 1, 1]
+    smp.ResetCamera(view)
+    smp.Render(view)
+    checkColor(view, [255, 255, 255], "initial render")
+
+    pxm = servermanager.ProxyManager().SMProxyManager
+    pxm.BeginPushTransaction()
+    display.AmbientColor = [1, 0, 0]
+    smp.Render(view)
+    checkColor(view, [255, 0, 0], "render in transaction")
+
+    # nested transaction, the outer one is still open.
+    pxm.BeginPushTransaction()
+    display.AmbientColor = [0, 1, 0]
+    pxm.CommitPushTransaction()
+    smp.Render(view)
+    checkColor(view, [0, 255, 0], "render after nested commit")
+
+    display.AmbientColor = [0, 0, 1]
+    pxm.CommitPushTransaction()
+    smp.Render(view)
+    checkColor(view, [0, 0, 255], "render after commit")
+    print ("Test Passed")
+
+runTest()
@@ -37,6 +37,13 @@ public:
   int ProcessViewRequest(vtkInformationRequestKey* request_type, vtkInformation* inInfo,
     vtkInformation* outInfo) override;
 
+  /**
+   * The input bounds and axis names are obtained in RequestData which does not
+   * execute when data is loaded from disk, hence the on-disk geometry cache is
+   * not supported.
+   */
+  std::string GetDiskCacheParameters() override { return std::string(); }
+
   ///@{
   /**
    * Set If the Data are simulation data or not. If they are, they need to be converted to the prism
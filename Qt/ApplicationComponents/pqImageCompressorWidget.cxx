@@ -9,6 +9,8 @@
 
 #include <QRegExp>
 
+#include <algorithm>
+
 static const int NO_COMPRESSION = 0;
 static const int LZ4_COMPRESSION = 1;
 static const int SQUIRT_COMPRESSION = 2;
@@ -20,6 +22,9 @@ class pqImageCompressorWidget::pqInternals
 {
 public:
   Ui::ImageCompressorWidget Ui;
+  // the delta compressor is appended after the optional compressors so that
+  // the indices of the existing entries do not change.
+  int DeltaCompression = -1;
 };
 
 //-----------------------------------------------------------------------------
@@ -49,11 +54,15 @@ pqImageCompressorWidget::pqImageCompressorWidget(
   this->connect(ui.zlibColorSpace, SIGNAL(valueChanged(int)), SIGNAL(compressorConfigChanged()));
   this->connect(ui.zlibLevel, SIGNAL(valueChanged(int)), SIGNAL(compressorConfigChanged()));
   this->connect(ui.zlibStripAlpha, SIGNAL(stateChanged(int)), SIGNAL(compressorConfigChanged()));
+  this->connect(ui.numberOfTiles, SIGNAL(valueChanged(int)), SIGNAL(compressorConfigChanged()));
+  this->connect(ui.deltaTileSize, SIGNAL(valueChanged(int)), SIGNAL(compressorConfigChanged()));
 
 #if VTK_MODULE_ENABLE_ParaView_nvpipe
   ui.compressionType->addItem("NvPipe");
   this->connect(ui.nvpLevel, SIGNAL(valueChanged(int)), SIGNAL(compressorConfigChanged()));
 #endif
+  this->Internals->DeltaCompression = ui.compressionType->count();
+  ui.compressionType->addItem(tr("Delta (changed tiles only)"));
 
   this->addPropertyLink(this, "compressorConfig", SIGNAL(compressorConfigChanged()), smproperty);
 }
@@ -85,14 +94,23 @@ void pqImageCompressorWidget::setCompressorConfig(const QString& value)
                      "\\s+"
                      "([0-9]+)" // num-of-bits
                      "\\s+"
-                     "([01])" // strip alpha (0 or 1).
+                     "([01])"            // strip alpha (0 or 1).
+                     "(?:\\s+([0-9]+))?" // optional number of tiles.
                      "$");
   QRegExp lz4RegExp("^vtkLZ4Compressor"
-                    "\\s+"     // space
-                    "0"        // 0
-                    "\\s+"     // space
-                    "([0-9]+)" // num-of-bits.
+                    "\\s+"              // space
+                    "0"                 // 0
+                    "\\s+"              // space
+                    "([0-9]+)"          // num-of-bits.
+                    "(?:\\s+([0-9]+))?" // optional number of tiles.
                     "$");
+  QRegExp deltaRegExp("^vtkDeltaImageCompressor"
+                      "\\s+"              // space
+                      "0"                 // 0
+                      "\\s+"              // space
+                      "([0-9]+)"          // tile size.
+                      "(?:\\s+([0-9]+))?" // optional number of tiles.
+                      "$");
   QRegExp nvpipeRegExp("^vtkNvPipeCompressor"
                        "\\s+"     // space
                        "0"        // 0
@@ -105,6 +123,7 @@ void pqImageCompressorWidget::setCompressorConfig(const QString& value)
     int numBits = lz4RegExp.cap(1).toInt();
     ui.compressionType->setCurrentIndex(LZ4_COMPRESSION);
     ui.squirtColorSpace->setValue(numBits);
+    ui.numberOfTiles->setValue(std::max(1, lz4RegExp.cap(2).toInt()));
   }
   else if (squirtRegExp.exactMatch(value))
   {
@@ -121,6 +140,13 @@ void pqImageCompressorWidget::setCompressorConfig(const QString& value)
     ui.zlibLevel->setValue(level);
     ui.zlibColorSpace->setValue(numBits);
     ui.zlibStripAlpha->setCheckState(stripAlpha ? Qt::Checked : Qt::Unchecked);
+    ui.numberOfTiles->setValue(std::max(1, zlibRegExp.cap(4).toInt()));
+  }
+  else if (deltaRegExp.exactMatch(value))
+  {
+    ui.compressionType->setCurrentIndex(this->Internals->DeltaCompression);
+    ui.deltaTileSize->setValue(deltaRegExp.cap(1).toInt());
+    ui.numberOfTiles->setValue(std::max(1, deltaRegExp.cap(2).toInt()));
   }
   else if (nvpipeRegExp.exactMatch(value))
   {
@@ -138,10 +164,20 @@ void pqImageCompressorWidget::setCompressorConfig(const QString& value)
 QString pqImageCompressorWidget::compressorConfig() const
 {
   Ui::ImageCompressorWidget& ui = this->Internals->Ui;
-  switch (ui.compressionType->currentIndex())
+  // the number of tiles is only added when tiling is used to keep the
+  // configuration compatible with older versions.
+  const int numberOfTiles = ui.numberOfTiles->value();
+  const QString tiles = numberOfTiles > 1 ? QString(" %1").arg(numberOfTiles) : QString();
+  const int index = ui.compressionType->currentIndex();
+  if (index == this->Internals->DeltaCompression)
+  {
+    return QString("vtkDeltaImageCompressor 0 %1").arg(ui.deltaTileSize->value()) + tiles;
+  }
+
+  switch (index)
   {
     case LZ4_COMPRESSION:
-      return QString("vtkLZ4Compressor 0 %1").arg(ui.squirtColorSpace->value());
+      return QString("vtkLZ4Compressor 0 %1").arg(ui.squirtColorSpace->value()) + tiles;
 
     case SQUIRT_COMPRESSION: // squirt
       return QString("vtkSquirtCompressor 0 %1").arg(ui.squirtColorSpace->value());
@@ -150,7 +186,8 @@ QString pqImageCompressorWidget::compressorConfig() const
       return QString("vtkZlibImageCompressor 0 %1 %2 %3")
         .arg(ui.zlibLevel->value())
         .arg(ui.zlibColorSpace->value())
-        .arg(ui.zlibStripAlpha->isChecked() ? 1 : 0);
+        .arg(ui.zlibStripAlpha->isChecked() ? 1 : 0) +
+        tiles;
 
     case NVPIPE_COMPRESSION: // nvpipe
       return QString("vtkNvPipeCompressor 0 %1").arg(ui.nvpLevel->value());
@@ -172,6 +209,14 @@ void pqImageCompressorWidget::currentIndexChanged(int index)
   ui.zlibColorSpace->setVisible(index == ZLIB_COMPRESSION);
   ui.zlibStripAlpha->setVisible(index == ZLIB_COMPRESSION);
 
+  const bool delta = index == this->Internals->DeltaCompression;
+  ui.deltaLabel->setVisible(delta);
+  ui.deltaTileSize->setVisible(delta);
+
+  const bool tiled = index == ZLIB_COMPRESSION || index == LZ4_COMPRESSION || delta;
+  ui.tilesLabel->setVisible(tiled);
+  ui.numberOfTiles->setVisible(tiled);
+
 #if VTK_MODULE_ENABLE_ParaView_nvpipe
   ui.nvpLabel->setVisible(index == NVPIPE_COMPRESSION);
   ui.nvpLevel->setVisible(index == NVPIPE_COMPRESSION);
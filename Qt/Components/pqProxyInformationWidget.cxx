@@ -33,6 +33,7 @@
 #include "vtkSMPropertyHelper.h"
 #include "vtkSMSourceProxy.h"
 #include "vtkSmartPointer.h"
+#include "vtkWeakPointer.h"
 #include <vtksys/SystemTools.hxx>
 
 #include <tuple>
@@ -317,6 +318,14 @@ public:
   QPointer<pqOutputPort> Port;
   vtkNew<vtkPVDataInformation> SubsetDataInformation;
 
+  // The output port whose data information is shown, it differs from Port
+  // while the data information of Port is being gathered.
+  QPointer<pqOutputPort> ShownPort;
+
+  // Observed to update the UI once the data information has been received.
+  vtkWeakPointer<vtkSMOutputPort> ObservedPortProxy;
+  unsigned long ObserverId = 0;
+
   vtkSMSourceProxy* sourceProxy() const
   {
     return this->Port ? this->Port->getSourceProxy() : nullptr;
@@ -705,10 +714,21 @@ void pqProxyInformationWidget::setOutputPort(pqOutputPort* port)
   {
     this->disconnect(internals.Port->getSource());
   }
+  if (internals.ObservedPortProxy)
+  {
+    internals.ObservedPortProxy->RemoveObserver(internals.ObserverId);
+    internals.ObservedPortProxy = nullptr;
+  }
   internals.Port = port;
   if (port)
   {
     this->connect(port->getSource(), SIGNAL(dataUpdated(pqPipelineSource*)), SLOT(updateUI()));
+    if (auto portProxy = port->getOutputPortProxy())
+    {
+      internals.ObservedPortProxy = portProxy;
+      internals.ObserverId = pqCoreUtilities::connect(
+        portProxy, vtkCommand::UpdateInformationEvent, this, SLOT(updateUI()));
+    }
   }
   this->updateUI();
 }
@@ -732,6 +752,26 @@ vtkPVDataInformation* pqProxyInformationWidget::dataInformation() const
 void pqProxyInformationWidget::updateUI()
 {
   auto& internals = (*this->Internals);
+
+  // gather the data information without blocking the user interface in
+  // client-server mode, this is called again once it has been received.
+  auto portProxy = internals.Port ? internals.Port->getOutputPortProxy() : nullptr;
+  if (portProxy && !portProxy->UpdateDataInformationAsync())
+  {
+    if (internals.ShownPort != internals.Port)
+    {
+      // don't show the information of the previous port meanwhile.
+      internals.setFileName(internals.sourceProxy());
+      internals.setDataGrouping(nullptr, nullptr);
+      internals.setTimeSteps(nullptr);
+      internals.setDataStatistics(nullptr);
+      internals.setDataArrays(nullptr);
+      internals.ShownPort = internals.Port;
+    }
+    return;
+  }
+  internals.ShownPort = internals.Port;
+
   auto proxy = internals.sourceProxy();
   auto dinfo = this->dataInformation();
   internals.setFileName(proxy);
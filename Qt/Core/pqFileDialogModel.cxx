@@ -240,6 +240,10 @@ Q_GLOBAL_STATIC(pqFileDialogModelIconProvider, Icons);
 namespace
 {
 
+// Number of entries listed at once, the next ones are listed as the view
+// scrolls to them.
+const int ListingPageSize = 5000;
+
 ///////////////////////////////////////////////////////////////////////
 // CaseInsensitiveSort
 
@@ -346,16 +350,19 @@ public:
     return result.trimmed();
   }
 
-  /// query the file system for information
-  vtkPVFileInformation* GetData(bool dirListing, const QString& path, bool specialDirs)
+  /// query the file system for information. Directory listings are limited
+  /// to one page of entries starting at `listingOffset`.
+  vtkPVFileInformation* GetData(
+    bool dirListing, const QString& path, bool specialDirs, int listingOffset = 0)
   {
-    return this->GetData(dirListing, this->CurrentPath, path, specialDirs);
+    return this->GetData(dirListing, this->CurrentPath, path, specialDirs, false, listingOffset);
   }
 
   /// query the file system for information
   vtkPVFileInformation* GetData(bool dirListing, const QString& workingDir, const QString& path,
-    bool specialDirs, bool forceClient = false)
+    bool specialDirs, bool forceClient = false, int listingOffset = 0)
   {
+    const int listingLimit = dirListing ? ListingPageSize : 0;
     if (this->FileInformationHelperProxy && !forceClient)
     {
       // send data to server
@@ -365,6 +372,8 @@ public:
       pqSMAdaptor::setElementProperty(helper->GetProperty("Path"), path.toUtf8());
       pqSMAdaptor::setElementProperty(helper->GetProperty("SpecialDirectories"), specialDirs);
       pqSMAdaptor::setElementProperty(helper->GetProperty("GroupFileSequences"), this->GroupFiles);
+      pqSMAdaptor::setElementProperty(helper->GetProperty("ListingOffset"), listingOffset);
+      pqSMAdaptor::setElementProperty(helper->GetProperty("ListingLimit"), listingLimit);
       helper->UpdateVTKObjects();
 
       // get data from server
@@ -379,6 +388,8 @@ public:
       helper->SetSpecialDirectories(specialDirs);
       helper->SetWorkingDirectory(workingDir.toUtf8().data());
       helper->SetGroupFileSequences(this->GroupFiles);
+      helper->SetListingOffset(listingOffset);
+      helper->SetListingLimit(listingLimit);
       this->FileInformation->CopyFromObject(helper);
     }
     return this->FileInformation;
@@ -389,7 +400,25 @@ public:
   {
     this->CurrentPath = path;
     this->FileList.clear();
+    // the next pages are appended without reallocating, so that the group
+    // pointers held by child indexes stay valid.
+    this->TotalNumberOfContents = dir->GetTotalNumberOfContents();
+    this->FileList.reserve(this->TotalNumberOfContents);
+    this->NumberOfFetchedContents = 0;
+    this->Append(this->ReadPage(dir), dir);
+  }
+
+  /// add a page read from the listing `dir` of the current path to our model
+  void Append(const QVector<pqFileDialogModelFileInfo>& page, vtkPVFileInformation* dir)
+  {
+    this->FileList.append(page);
+    this->NumberOfFetchedContents += dir->GetContents()->GetNumberOfItems();
+  }
 
+  /// read a page of a directory listing. The server sorts directories first
+  /// then by name, so that the page can be appended to the previous ones.
+  QVector<pqFileDialogModelFileInfo> ReadPage(vtkPVFileInformation* dir)
+  {
     QList<pqFileDialogModelFileInfo> dirs;
     QList<pqFileDialogModelFileInfo> files;
 
@@ -448,14 +477,17 @@ public:
     std::sort(dirs.begin(), dirs.end(), CaseInsensitiveSort);
     std::sort(files.begin(), files.end(), CaseInsensitiveSort);
 
+    QVector<pqFileDialogModelFileInfo> page;
+    page.reserve(dirs.size() + files.size());
     for (int i = 0; i != dirs.size(); ++i)
     {
-      this->FileList.push_back(dirs[i]);
+      page.push_back(dirs[i]);
     }
     for (int i = 0; i != files.size(); ++i)
     {
-      this->FileList.push_back(files[i]);
+      page.push_back(files[i]);
     }
+    return page;
   }
 
   QStringList getFilePaths(const QModelIndex& index)
@@ -517,6 +549,10 @@ public:
   QString CurrentPath;
   /// Caches information about the set of files within the current path.
   QVector<pqFileDialogModelFileInfo> FileList; // adjacent memory occupation for QModelIndex
+  /// Number of entries in the listing of the current path, and number of
+  /// them already in FileList.
+  int TotalNumberOfContents = 0;
+  int NumberOfFetchedContents = 0;
 
   const pqFileDialogModelFileInfo* infoForIndex(const QModelIndex& idx) const
   {
@@ -1062,6 +1098,41 @@ int pqFileDialogModel::rowCount(const QModelIndex& idx) const
   return 0;
 }
 
+bool pqFileDialogModel::canFetchMore(const QModelIndex& idx) const
+{
+  return !idx.isValid() &&
+    this->Implementation->NumberOfFetchedContents < this->Implementation->TotalNumberOfContents;
+}
+
+void pqFileDialogModel::fetchMore(const QModelIndex& idx)
+{
+  if (!this->canFetchMore(idx))
+  {
+    return;
+  }
+
+  const QString path = this->Implementation->CurrentPath;
+  vtkPVFileInformation* info =
+    this->Implementation->GetData(true, path, false, this->Implementation->NumberOfFetchedContents);
+  if (info->GetTotalNumberOfContents() != this->Implementation->TotalNumberOfContents)
+  {
+    // the directory changed since the first page was listed, start over.
+    this->setCurrentPath(path);
+    return;
+  }
+
+  const QVector<pqFileDialogModelFileInfo> page = this->Implementation->ReadPage(info);
+  if (page.empty())
+  {
+    this->Implementation->NumberOfFetchedContents = this->Implementation->TotalNumberOfContents;
+    return;
+  }
+  const int first = this->Implementation->FileList.size();
+  this->beginInsertRows(QModelIndex(), first, first + page.size() - 1);
+  this->Implementation->Append(page, info);
+  this->endInsertRows();
+}
+
 bool pqFileDialogModel::hasChildren(const QModelIndex& idx) const
 {
   if (!idx.isValid())
@@ -182,6 +182,15 @@ public:
    * return whether a given index has children
    */
   bool hasChildren(const QModelIndex& p) const override;
+  /**
+   * return whether more entries of the current path can be listed. Huge
+   * directories are listed one page at a time, as the view scrolls.
+   */
+  bool canFetchMore(const QModelIndex& p) const override;
+  /**
+   * list the next page of entries of the current path
+   */
+  void fetchMore(const QModelIndex& p) override;
   /**
    * returns header data
    */
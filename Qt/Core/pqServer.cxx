@@ -57,6 +57,10 @@ public:
 
   vtkNew<vtkEventQtSlotConnect> VTKConnect;
   vtkWeakPointer<vtkSMCollaborationManager> CollaborationCommunicator;
+
+  // true when server notifications are monitored irrespective of pending
+  // asynchronous information requests.
+  bool MonitorServerNotifications{ false };
 };
 /////////////////////////////////////////////////////////////////////////////////////////////
 // pqServer
@@ -117,6 +121,11 @@ pqServer::pqServer(vtkIdType connectionID, QObject* _parent)
   this->Internals->VTKConnect->Connect(this->Session, vtkPVSessionBase::ConnectionLost, this,
     SLOT(onConnectionLost(vtkObject*, ulong, void*, void*)));
 
+  // Replies to asynchronous information requests are processed along with
+  // server notifications.
+  this->Internals->VTKConnect->Connect(this->Session,
+    vtkSMSession::GatherInformationRequestedEvent, this, SLOT(onGatherInformationRequested()));
+
   // In case of Multi-clients connection, the client has to listen
   // server notification so collaboration could happen
   if (this->session()->IsMultiClients())
@@ -158,7 +167,8 @@ pqServer::~pqServer()
 //-----------------------------------------------------------------------------
 void pqServer::setMonitorServerNotifications(bool val)
 {
-  if (val)
+  this->Internals->MonitorServerNotifications = val;
+  if (val || (this->Session && this->Session->HasPendingGatherInformation()))
   {
     this->IdleCollaborationTimer.start();
   }
@@ -436,7 +446,21 @@ void pqServer::processServerNotification()
       view->render();
     }
   }
-  this->IdleCollaborationTimer.start();
+
+  if (this->Internals->MonitorServerNotifications ||
+    (this->Session && this->Session->HasPendingGatherInformation()))
+  {
+    this->IdleCollaborationTimer.start();
+  }
+}
+
+//-----------------------------------------------------------------------------
+void pqServer::onGatherInformationRequested()
+{
+  if (!this->IdleCollaborationTimer.isActive())
+  {
+    this->IdleCollaborationTimer.start();
+  }
 }
 
 //-----------------------------------------------------------------------------
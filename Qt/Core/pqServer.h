@@ -127,7 +127,9 @@ public:
   static int getHeartBeatTimeoutSetting();
 
   /**
-   * enable/disable monitoring of server notifications.
+   * enable/disable monitoring of server notifications. Server notifications
+   * are also processed, irrespective of this flag, while replies to
+   * vtkSMSession::GatherInformationAsync() requests are pending.
    */
   void setMonitorServerNotifications(bool);
 
@@ -226,6 +228,12 @@ protected Q_SLOTS:
    */
   void processServerNotification();
 
+  /**
+   * Called when an asynchronous information request has been sent, to
+   * process the reply once it arrives.
+   */
+  void onGatherInformationRequested();
+
   /**
    * Called by vtkSMCollaborationManager when associated message happen.
    * This will convert the given parameter into vtkSMMessage and
@@ -0,0 +1,112 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkCallbackCommand.h"
+#include "vtkCompositeAnimationPlayer.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkSMAnimationScene.h"
+
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+struct Frame
+{
+  double Time;
+  bool PrefetchTimeValid;
+  double PrefetchTime;
+};
+
+void RecordFrame(vtkObject* caller, unsigned long, void* clientdata, void*)
+{
+  auto scene = vtkSMAnimationScene::SafeDownCast(caller);
+  auto frames = reinterpret_cast<std::vector<Frame>*>(clientdata);
+  frames->push_back(
+    Frame{ scene->GetSceneTime(), scene->GetPrefetchTimeValid(), scene->GetPrefetchTime() });
+}
+
+bool Verify(const std::vector<Frame>& frames, const std::vector<double>& times, const char* mode)
+{
+  if (frames.size() != times.size())
+  {
+    vtkLogF(ERROR, "%s: expected %d frames, got %d.", mode, static_cast<int>(times.size()),
+      static_cast<int>(frames.size()));
+    return false;
+  }
+  for (size_t cc = 0; cc < frames.size(); ++cc)
+  {
+    const bool last = (cc + 1 == frames.size());
+    if (frames[cc].Time != times[cc] || frames[cc].PrefetchTimeValid == last ||
+      (!last && frames[cc].PrefetchTime != times[cc + 1]))
+    {
+      vtkLogF(ERROR, "%s: unexpected prefetch time for frame %d.", mode, static_cast<int>(cc));
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestAnimationPrefetchTime(int, char*[])
+{
+  vtkNew<vtkSMAnimationScene> scene;
+  scene->SetStartTime(0);
+  scene->SetEndTime(4);
+
+  vtkNew<vtkCompositeAnimationPlayer> player;
+  player->SetAnimationScene(scene);
+
+  std::vector<Frame> frames;
+  vtkNew<vtkCallbackCommand> observer;
+  observer->SetCallback(RecordFrame);
+  observer->SetClientData(&frames);
+  scene->AddObserver(vtkCommand::AnimationCueTickEvent, observer);
+
+  // sequence: the next frame is prefetched, except for the last one.
+  player->SetPlayMode(vtkCompositeAnimationPlayer::SEQUENCE);
+  player->SetNumberOfFrames(5);
+  player->Play();
+  if (!Verify(frames, { 0, 1, 2, 3, 4 }, "sequence"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  frames.clear();
+  player->SetStride(2);
+  player->Play();
+  player->SetStride(1);
+  if (!Verify(frames, { 0, 2, 4 }, "sequence with stride"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // snap to timesteps.
+  frames.clear();
+  player->SetPlayMode(vtkCompositeAnimationPlayer::SNAP_TO_TIMESTEPS);
+  for (double time : { 0.0, 0.5, 3.0, 4.0 })
+  {
+    player->AddTimeStep(time);
+  }
+  player->Play();
+  if (!Verify(frames, { 0, 0.5, 3, 4 }, "snap to timesteps"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // reverse.
+  frames.clear();
+  player->Play(static_cast<int>(vtkAnimationCue::PlayDirection::BACKWARD));
+  if (!Verify(frames, { 4, 3, 0.5, 0 }, "reverse"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  if (scene->GetPrefetchTimeValid())
+  {
+    vtkLogF(ERROR, "Prefetch time must be reset after playback.");
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
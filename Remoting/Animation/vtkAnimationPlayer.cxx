@@ -102,6 +102,18 @@ void vtkAnimationPlayer::Play(const int dir /*=1*/)
     double deltatime = 0.0;
     while (!this->StopPlay && withinTimeRange())
     {
+      // let the scene know what comes next so that it can be prefetched.
+      const double next = this->PeekNextTime(this->CurrentTime, reverse);
+      if (next != this->CurrentTime &&
+        (reverse ? next >= playbackWindow[0] : next <= playbackWindow[1]))
+      {
+        this->AnimationScene->SetPrefetchTime(next);
+      }
+      else
+      {
+        this->AnimationScene->ResetPrefetchTime();
+      }
+
       this->AnimationScene->Tick(this->CurrentTime, deltatime, this->CurrentTime);
       double progress = getElapsedPercent() / 100.;
       this->InvokeEvent(vtkCommand::ProgressEvent, &progress);
@@ -123,6 +135,7 @@ void vtkAnimationPlayer::Play(const int dir /*=1*/)
     // loop when this->Loop is true.
   } while (this->Loop && !this->StopPlay);
 
+  this->AnimationScene->ResetPrefetchTime();
   this->InPlay = false;
   this->StopPlay = false;
 
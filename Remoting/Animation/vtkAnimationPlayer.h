@@ -116,6 +116,17 @@ protected:
   virtual double GoToPrevious(double start, double end, double currenttime) = 0;
   ///@}
 
+  /**
+   * Return the time GetNextTime() (or GetPreviousTime() when `reverse` is
+   * true) would return for `currenttime`, without changing the state of the
+   * loop. This is used to let the scene prefetch the next frame. The default
+   * implementation returns `currenttime`, i.e. nothing is prefetched.
+   */
+  virtual double PeekNextTime(double currenttime, bool vtkNotUsed(reverse))
+  {
+    return currenttime;
+  }
+
 private:
   vtkAnimationPlayer(const vtkAnimationPlayer&) = delete;
   void operator=(const vtkAnimationPlayer&) = delete;
@@ -106,6 +106,18 @@ double vtkCompositeAnimationPlayer::GoToPrevious(double start, double end, doubl
   return VTK_DOUBLE_MIN;
 }
 
+//----------------------------------------------------------------------------
+double vtkCompositeAnimationPlayer::PeekNextTime(double currenttime, bool reverse)
+{
+  vtkAnimationPlayer* player = this->GetActivePlayer();
+  if (player)
+  {
+    return player->PeekNextTime(currenttime, reverse);
+  }
+
+  return currenttime;
+}
+
 //----------------------------------------------------------------------------
 void vtkCompositeAnimationPlayer::PrintSelf(ostream& os, vtkIndent indent)
 {
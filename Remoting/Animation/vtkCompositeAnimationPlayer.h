@@ -81,6 +81,7 @@ protected:
   double GetPreviousTime(double currenttime) override;
   double GoToNext(double start, double end, double currenttime) override;
   double GoToPrevious(double start, double end, double currenttime) override;
+  double PeekNextTime(double currenttime, bool reverse) override;
   ///@}
 
   vtkAnimationPlayer* GetActivePlayer();
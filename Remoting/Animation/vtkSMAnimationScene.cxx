@@ -6,6 +6,7 @@
 #include "vtkEventForwarderCommand.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkPVAnimationCue.h"
 #include "vtkPVCameraAnimationCue.h"
 #include "vtkPVLogger.h"
 #include "vtkSMProperty.h"
@@ -36,6 +37,19 @@ bool vtkSMAnimationScene::GetGlobalUseGeometryCache()
   return vtkSMAnimationScene::GlobalUseGeometryCache;
 }
 
+bool vtkSMAnimationScene::GlobalPrefetchNextFrame;
+//----------------------------------------------------------------------------
+void vtkSMAnimationScene::SetGlobalPrefetchNextFrame(bool val)
+{
+  vtkSMAnimationScene::GlobalPrefetchNextFrame = val;
+}
+
+//----------------------------------------------------------------------------
+bool vtkSMAnimationScene::GetGlobalPrefetchNextFrame()
+{
+  return vtkSMAnimationScene::GlobalPrefetchNextFrame;
+}
+
 //----------------------------------------------------------------------------
 class vtkSMAnimationScene::vtkInternals
 {
@@ -108,6 +122,43 @@ public:
       iter->GetPointer()->UpdateProperty("UseCache");
     }
   }
+
+  // Returns true if the data shown for a frame depends on nothing but the
+  // frame's time, i.e. the only enabled cues are the cue animating time using
+  // the animation time and camera cues. Only then can a frame be prepared
+  // before its tick.
+  bool CanPrefetch() const
+  {
+    bool animatesTime = false;
+    for (const auto& cue : this->AnimationCues)
+    {
+      auto pvcue = vtkPVAnimationCue::SafeDownCast(cue);
+      if (pvcue == nullptr)
+      {
+        return false;
+      }
+      if (!pvcue->GetEnabled() || vtkPVCameraAnimationCue::SafeDownCast(pvcue))
+      {
+        continue;
+      }
+      if (!pvcue->GetUseAnimationTime())
+      {
+        return false;
+      }
+      animatesTime = true;
+    }
+    return animatesTime;
+  }
+
+  void PrefetchAllViews(double time)
+  {
+    vtkVLogScopeF(PARAVIEW_LOG_APPLICATION_VERBOSITY(), "prefetch time %f for animation", time);
+    for (const auto& view : this->ViewModules)
+    {
+      // the time is also the cache key, see PassCacheTime().
+      view->Prefetch(time, time);
+    }
+  }
 };
 
 namespace
@@ -233,6 +284,8 @@ vtkSMAnimationScene::vtkSMAnimationScene()
   this->PlaybackTimeWindow[0] = 1.0;
   this->PlaybackTimeWindow[1] = -1.0;
   this->ForceDisableCaching = false;
+  this->PrefetchTimeValid = false;
+  this->PrefetchTime = 0.0;
   this->InTick = false;
   this->LockEndTime = false;
   this->LockStartTime = false;
@@ -496,6 +549,13 @@ void vtkSMAnimationScene::TickInternal(double currenttime, double deltatime, dou
   {
     this->Internals->StillRenderAllViews();
   }
+
+  // prefetch while caching is still enabled on the views.
+  if (caching_enabled && vtkSMAnimationScene::GlobalPrefetchNextFrame &&
+    this->PrefetchTimeValid && this->Internals->CanPrefetch())
+  {
+    this->Internals->PrefetchAllViews(this->PrefetchTime);
+  }
   this->InTick = false;
 
   if (caching_enabled)
@@ -509,6 +569,21 @@ void vtkSMAnimationScene::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
   os << indent << "ForceDisableCaching: " << this->ForceDisableCaching << endl;
+  os << indent << "PrefetchTimeValid: " << this->PrefetchTimeValid << endl;
+  os << indent << "PrefetchTime: " << this->PrefetchTime << endl;
+}
+
+//----------------------------------------------------------------------------
+void vtkSMAnimationScene::SetPrefetchTime(double time)
+{
+  this->PrefetchTimeValid = true;
+  this->PrefetchTime = time;
+}
+
+//----------------------------------------------------------------------------
+void vtkSMAnimationScene::ResetPrefetchTime()
+{
+  this->PrefetchTimeValid = false;
 }
 
 //----------------------------------------------------------------------------
@@ -190,6 +190,33 @@ public:
   static bool GetGlobalUseGeometryCache();
   ///@}
 
+  ///@{
+  /**
+   * Turn prefetching of the next frame on/off globally. When on and caching
+   * is enabled, the server processes update the views for the next frame as
+   * soon as the current frame is rendered, storing the results in the cache.
+   * Reading and processing the data for the next frame then overlaps with the
+   * work the client does for the current frame. Frames are prefetched only
+   * if the scene animates nothing but time (and cameras), since the values
+   * of other animated properties are not known ahead of the tick. Off by
+   * default.
+   */
+  static void SetGlobalPrefetchNextFrame(bool);
+  static bool GetGlobalPrefetchNextFrame();
+  ///@}
+
+  ///@{
+  /**
+   * Set by the animation player during playback to the time of the frame
+   * that will be played after the current one. ResetPrefetchTime() indicates
+   * that there is no such frame.
+   */
+  void SetPrefetchTime(double time);
+  void ResetPrefetchTime();
+  vtkGetMacro(PrefetchTimeValid, bool);
+  vtkGetMacro(PrefetchTime, double);
+  ///@}
+
 protected:
   vtkSMAnimationScene();
   ~vtkSMAnimationScene() override;
@@ -218,6 +245,8 @@ protected:
   double SceneTime;
   double PlaybackTimeWindow[2];
   bool ForceDisableCaching;
+  bool PrefetchTimeValid;
+  double PrefetchTime;
   vtkSMProxy* TimeKeeper;
   vtkCompositeAnimationPlayer* AnimationPlayer;
   vtkEventForwarderCommand* Forwarder;
@@ -234,6 +263,7 @@ private:
   unsigned long TimestepValuesObserverID;
 
   static bool GlobalUseGeometryCache;
+  static bool GlobalPrefetchNextFrame;
 };
 
 #endif
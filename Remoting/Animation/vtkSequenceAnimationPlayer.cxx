@@ -85,6 +85,15 @@ double vtkSequenceAnimationPlayer::GetPreviousTime(double curtime)
   return this->GetTimeFromTimestep(this->StartTime, this->EndTime, this->FrameNo);
 }
 
+//----------------------------------------------------------------------------
+double vtkSequenceAnimationPlayer::PeekNextTime(double curtime, bool reverse)
+{
+  const int frameNo = this->FrameNo;
+  const double time = reverse ? this->GetPreviousTime(curtime) : this->GetNextTime(curtime);
+  this->FrameNo = frameNo;
+  return time;
+}
+
 //----------------------------------------------------------------------------
 int vtkSequenceAnimationPlayer::GetTimestep(double start, double end, double current)
 {
@@ -37,6 +37,8 @@ protected:
   double GetNextTime(double currentime) override;
   // Get previous time in loop. Overriden to update FrameNo, and use StartTime, EndTime.
   double GetPreviousTime(double currenttime) override;
+  // Overridden to not change FrameNo.
+  double PeekNextTime(double currenttime, bool reverse) override;
   ///@}
 
   ///@{
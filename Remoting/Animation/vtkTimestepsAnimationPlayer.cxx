@@ -95,6 +95,15 @@ double vtkTimestepsAnimationPlayer::GetPreviousTime(double currentime)
   return this->GetPreviousTimeStep(currentime);
 }
 
+//-----------------------------------------------------------------------------
+double vtkTimestepsAnimationPlayer::PeekNextTime(double currentime, bool reverse)
+{
+  const unsigned long count = this->Count;
+  const double time = reverse ? this->GetPreviousTime(currentime) : this->GetNextTime(currentime);
+  this->Count = count;
+  return time;
+}
+
 //-----------------------------------------------------------------------------
 double vtkTimestepsAnimationPlayer::GetNextTimeStep(double timestep)
 {
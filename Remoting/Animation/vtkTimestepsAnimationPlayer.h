@@ -79,6 +79,8 @@ protected:
   double GetNextTime(double currentime) override;
   // Get previous time in loop. Take Count and Stride into account.
   double GetPreviousTime(double currenttime) override;
+  // Overridden to not change Count.
+  double PeekNextTime(double currenttime, bool reverse) override;
   ///@}
 
   double GoToNext(double, double, double currenttime) override
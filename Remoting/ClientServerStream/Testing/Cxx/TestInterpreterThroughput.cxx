@@ -0,0 +1,167 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Micro-benchmark for the client-server stream and interpreter. It reports
+// the number of Invoke messages per second that can be encoded, parsed and
+// dispatched, similar to what happens when loading a state file with many
+// property pushes.
+
+#include "vtkClientServerInterpreter.h"
+#include "vtkClientServerStream.h"
+#include "vtkDoubleArray.h"
+#include "vtkNew.h"
+#include "vtkTimerLog.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+namespace
+{
+vtkObjectBase* NewDoubleArray(void*)
+{
+  return vtkDoubleArray::New();
+}
+
+// Hand written command function for the few vtkDoubleArray methods used by
+// the benchmark.
+int DoubleArrayCommand(vtkClientServerInterpreter*, vtkObjectBase* ptr, const char* method,
+  const vtkClientServerStream& msg, vtkClientServerStream& result, void*)
+{
+  vtkDoubleArray* array = vtkDoubleArray::SafeDownCast(ptr);
+  if (!strcmp("SetNumberOfComponents", method) && msg.GetNumberOfArguments(0) == 3)
+  {
+    int numComps;
+    if (msg.GetArgument(0, 2, &numComps))
+    {
+      array->SetNumberOfComponents(numComps);
+      return 1;
+    }
+  }
+  if (!strcmp("SetNumberOfTuples", method) && msg.GetNumberOfArguments(0) == 3)
+  {
+    vtkIdType numTuples;
+    if (msg.GetArgument(0, 2, &numTuples))
+    {
+      array->SetNumberOfTuples(numTuples);
+      return 1;
+    }
+  }
+  if (!strcmp("SetTuple", method) && msg.GetNumberOfArguments(0) == 4)
+  {
+    // consume the array argument in place.
+    vtkIdType index;
+    vtkClientServerStream::Array values;
+    if (msg.GetArgument(0, 2, &index) && msg.GetArgument(0, 3, &values) &&
+      values.Type == vtkClientServerStream::float64_array &&
+      static_cast<int>(values.Length) == array->GetNumberOfComponents())
+    {
+      memcpy(array->GetPointer(index * values.Length), values.Data, values.Size);
+      return 1;
+    }
+  }
+  result << vtkClientServerStream::Error << "Invalid method." << vtkClientServerStream::End;
+  return 0;
+}
+
+double Rate(int count, double seconds)
+{
+  return seconds > 0 ? count / seconds : 0.0;
+}
+}
+
+int TestInterpreterThroughput(int argc, char* argv[])
+{
+  int numberOfMessages = 100000;
+  for (int cc = 1; cc + 1 < argc; ++cc)
+  {
+    if (!strcmp(argv[cc], "--messages"))
+    {
+      numberOfMessages = std::max(1, atoi(argv[++cc]));
+    }
+  }
+  const int numberOfComponents = 3;
+
+  vtkNew<vtkClientServerInterpreter> interp;
+  interp->AddNewInstanceFunction("vtkDoubleArray", NewDoubleArray);
+  interp->AddCommandFunction("vtkDoubleArray", DoubleArrayCommand);
+
+  // populate the interpreter with as many classes as a typical session so
+  // that class lookups are representative.
+  for (int cc = 0; cc < 2000; ++cc)
+  {
+    const std::string name = "vtkBenchmarkClass" + std::to_string(cc);
+    interp->AddCommandFunction(name.c_str(), DoubleArrayCommand);
+  }
+
+  vtkNew<vtkTimerLog> timer;
+
+  // encode.
+  const vtkClientServerID id(1);
+  vtkClientServerStream stream;
+  timer->StartTimer();
+  stream << vtkClientServerStream::New << "vtkDoubleArray" << id << vtkClientServerStream::End;
+  stream << vtkClientServerStream::Invoke << id << "SetNumberOfComponents" << numberOfComponents
+         << vtkClientServerStream::End;
+  stream << vtkClientServerStream::Invoke << id << "SetNumberOfTuples"
+         << static_cast<vtkIdType>(numberOfMessages) << vtkClientServerStream::End;
+  for (int cc = 0; cc < numberOfMessages; ++cc)
+  {
+    const double tuple[numberOfComponents] = { 1.0 * cc, 2.0 * cc, 3.0 * cc };
+    stream << vtkClientServerStream::Invoke << id << "SetTuple" << static_cast<vtkIdType>(cc)
+           << vtkClientServerStream::InsertArray(tuple, numberOfComponents)
+           << vtkClientServerStream::End;
+  }
+  timer->StopTimer();
+  const double encodeTime = timer->GetElapsedTime();
+
+  // parse, as done when receiving a stream.
+  const unsigned char* data;
+  size_t length;
+  stream.GetData(&data, &length);
+  vtkClientServerStream received;
+  timer->StartTimer();
+  if (!received.SetData(data, length))
+  {
+    std::cerr << "Failed to parse the stream." << std::endl;
+    return EXIT_FAILURE;
+  }
+  timer->StopTimer();
+  const double parseTime = timer->GetElapsedTime();
+
+  // dispatch.
+  timer->StartTimer();
+  if (!interp->ProcessStream(received))
+  {
+    std::cerr << "Failed to process the stream." << std::endl;
+    return EXIT_FAILURE;
+  }
+  timer->StopTimer();
+  const double processTime = timer->GetElapsedTime();
+
+  // validate.
+  auto array = vtkDoubleArray::SafeDownCast(interp->GetObjectFromID(id));
+  if (!array || array->GetNumberOfTuples() != numberOfMessages)
+  {
+    std::cerr << "Unexpected array." << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (int cc = 0; cc < numberOfMessages; ++cc)
+  {
+    const double* tuple = array->GetTuple3(cc);
+    if (tuple[0] != 1.0 * cc || tuple[1] != 2.0 * cc || tuple[2] != 3.0 * cc)
+    {
+      std::cerr << "Unexpected value at tuple " << cc << "." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  std::cout << "Messages: " << numberOfMessages << " (" << length << " bytes)" << std::endl;
+  printf("Encode:   %12.0f messages/s\n", Rate(numberOfMessages, encodeTime));
+  printf("Parse:    %12.0f messages/s\n", Rate(numberOfMessages, parseTime));
+  printf("Dispatch: %12.0f messages/s\n", Rate(numberOfMessages, processTime));
+  return EXIT_SUCCESS;
+}
@@ -6,6 +6,8 @@
 #include "vtkStringArray.h"
 #include "vtkVariantArray.h"
 
+#include <cstring>
+
 static double dblIni[] = { 904., 906., 917. };
 static const char* strIni[] = { "901", "Turbo", "Targa" };
 
@@ -26,7 +28,17 @@ struct Help
     {
       return false;
     }
-    if (!css.GetArgument(0, arg++, a, 2) || a[0] != 12 || a[1] != 3)
+    if (!css.GetArgument(0, arg, a, 2) || a[0] != 12 || a[1] != 3)
+    {
+      return false;
+    }
+    vtkClientServerStream::Array view;
+    if (!css.GetArgument(0, arg++, &view) || view.Length != 2 || view.Size != sizeof(a))
+    {
+      return false;
+    }
+    memcpy(a, view.Data, sizeof(a));
+    if (a[0] != 12 || a[1] != 3)
     {
       return false;
     }
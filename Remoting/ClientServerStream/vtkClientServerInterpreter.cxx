@@ -13,6 +13,7 @@
 #include <map>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 vtkStandardNewMacro(vtkClientServerInterpreter);
@@ -64,6 +65,33 @@ public:
   NewInstanceFunctionsType NewInstanceFunctions;
   ClassToFunctionMapType ClassToFunctionMap;
   IDToMessageMapType IDToMessageMap;
+
+  // Command functions indexed by the address of the class name returned by
+  // vtkObjectBase::GetClassName(). The class name of a given class is a
+  // string literal, so its address is a cheap interned identifier for the
+  // class. This avoids string comparisons when dispatching Invoke messages.
+  typedef std::unordered_map<const char*, const CommandFunction*> InternedClassToFunctionMapType;
+  InternedClassToFunctionMapType InternedClassToFunctionMap;
+
+  const CommandFunction* GetCommandFunction(vtkObjectBase* obj)
+  {
+    const char* cname = obj->GetClassName();
+    auto iter = this->InternedClassToFunctionMap.find(cname);
+    if (iter != this->InternedClassToFunctionMap.end())
+    {
+      return iter->second;
+    }
+
+    // Fall back to the class name lookup and intern the result. Misses are
+    // not interned since a command function may be added later on.
+    auto fiter = cname ? this->ClassToFunctionMap.find(cname) : this->ClassToFunctionMap.end();
+    if (fiter == this->ClassToFunctionMap.end())
+    {
+      return nullptr;
+    }
+    this->InternedClassToFunctionMap[cname] = fiter->second;
+    return fiter->second;
+  }
 };
 
 //----------------------------------------------------------------------------
@@ -407,10 +435,12 @@ int vtkClientServerInterpreter::ProcessCommandInvoke(const vtkClientServerStream
     }
 
     // Find the command function for this object's type.
-    if (obj && this->HasCommandFunction(obj->GetClassName()))
+    const vtkClientServerInterpreterInternals::CommandFunction* n =
+      obj ? this->Internal->GetCommandFunction(obj) : nullptr;
+    if (n)
     {
-      if (this->CallCommandFunction(
-            obj->GetClassName(), obj, method, msg, *this->LastResultMessage))
+      void* ctx = n->Context ? n->Context->Context : nullptr;
+      if (n->Function(this, obj, method, msg, *this->LastResultMessage, ctx))
       {
         return 1;
       }
@@ -587,18 +617,29 @@ int vtkClientServerInterpreter::ExpandMessage(
     return 0;
   }
 
+  // Reset() releases the memory of the output stream. Reserve enough space
+  // for the unexpanded message up front to avoid growing the buffer one
+  // argument at a time.
+  const int numArguments = in.GetNumberOfArguments(inIndex);
+  size_t size = 2 * sizeof(vtkTypeUInt32);
+  for (int a = 0; a < numArguments; ++a)
+  {
+    size += in.GetArgument(inIndex, a).Size;
+  }
+  out.Reserve(size + 1);
+
   // Copy the command.
   out << in.GetCommand(inIndex);
 
   // Just copy the first arguments.
   int a;
-  for (a = 0; a < startArgument && a < in.GetNumberOfArguments(inIndex); ++a)
+  for (a = 0; a < startArgument && a < numArguments; ++a)
   {
     out << in.GetArgument(inIndex, a);
   }
 
   // Expand id_value for remaining arguments.
-  for (a = startArgument; a < in.GetNumberOfArguments(inIndex); ++a)
+  for (a = startArgument; a < numArguments; ++a)
   {
     if (in.GetArgumentType(inIndex, a) == vtkClientServerStream::id_value)
     {
@@ -766,6 +807,9 @@ void vtkClientServerInterpreter::AddCommandFunction(const char* cname,
 
   this->Internal->ClassToFunctionMap[cname] =
     new vtkClientServerInterpreterInternals::CommandFunction(func, context);
+
+  // A newly loaded module may reuse the address of an unloaded class name.
+  this->Internal->InternedClassToFunctionMap.clear();
 }
 
 //----------------------------------------------------------------------------
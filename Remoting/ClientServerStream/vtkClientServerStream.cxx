@@ -1427,6 +1427,37 @@ int vtkClientServerStream::GetArgumentLength(int message, int argument, vtkTypeU
   return 0;
 }
 
+//----------------------------------------------------------------------------
+int vtkClientServerStream::GetArgument(
+  int message, int argument, vtkClientServerStream::Array* value) const
+{
+  // Get a pointer to the type/value pair in the stream.
+  if (const unsigned char* data = this->GetValue(message, 1 + argument))
+  {
+    // Get the type of the value in the stream.
+    vtkTypeUInt32 tp;
+    memcpy(&tp, data, sizeof(tp));
+    data += sizeof(tp);
+
+    // Find the size of the array elements based on its type.
+    vtkTypeUInt32 wordSize = 0;
+    switch (tp)
+    {
+      VTK_CSS_TEMPLATE_MACRO(array, wordSize = static_cast<vtkTypeUInt32>(sizeof(*T)));
+      default:
+        return 0;
+    }
+
+    // Reference the array values in place.
+    value->Type = static_cast<vtkClientServerStream::Types>(tp);
+    memcpy(&value->Length, data, sizeof(value->Length));
+    value->Size = value->Length * wordSize;
+    value->Data = data + sizeof(value->Length);
+    return 1;
+  }
+  return 0;
+}
+
 //----------------------------------------------------------------------------
 int vtkClientServerStream::GetArgumentObject(
   int message, int argument, vtkObjectBase** value, const char* type) const
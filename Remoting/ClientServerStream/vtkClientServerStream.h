@@ -245,6 +245,18 @@ public:
   };
   ///@}
 
+  /**
+   * Get an array argument of the given message without copying it out of
+   * the stream. On success, \a value describes the array type, its number of
+   * values, its size in bytes and points to the values stored in the stream.
+   * The data is in native byte order but may not be suitably aligned for
+   * its type, hence it should be accessed with memcpy. The pointer is
+   * invalidated by any further writing to the stream. The returned value may
+   * be inserted as is in another stream. Returns whether the argument is
+   * really an array of numeric values.
+   */
+  int GetArgument(int message, int argument, vtkClientServerStream::Array* value) const;
+
   ///@{
   /**
    * Stream operators for special types.
@@ -464,46 +476,65 @@ class vtkClientServerStreamDataArg
 {
 public:
   // Constructor checks the argument type and length, allocates
-  // memory, and extracts the data from the message.
+  // memory, and extracts the data from the message.  Short arrays, which
+  // are the common case for property values, are extracted in a buffer
+  // owned by this object to avoid a heap allocation per call.
   vtkClientServerStreamDataArg(const vtkClientServerStream& msg, int message, int argument)
-    : Data(0)
+    : Data(nullptr)
   {
     // Check the argument length.
     vtkTypeUInt32 length = 0;
     if (msg.GetArgumentLength(message, argument, &length) && length > 0)
     {
-      // Allocate memory without throwing.
-      try
+      if (length <= SmallSize)
       {
-        this->Data = new T[length];
+        this->Data = this->Small;
       }
-      catch (...)
+      else
       {
+        // Allocate memory without throwing.
+        try
+        {
+          this->Data = new T[length];
+        }
+        catch (...)
+        {
+        }
       }
     }
 
     // Extract the data into the allocated memory.
     if (this->Data && !msg.GetArgument(message, argument, this->Data, length))
     {
-      delete[] this->Data;
-      this->Data = 0;
+      this->Free();
     }
   }
 
   // Destructor frees data memory.
-  ~vtkClientServerStreamDataArg()
+  ~vtkClientServerStreamDataArg() { this->Free(); }
+
+  // Allow this object to be passed as if it were a pointer.
+  operator T*() { return this->Data; }
+
+private:
+  void Free()
   {
-    if (this->Data)
+    if (this->Data != this->Small)
     {
       delete[] this->Data;
     }
+    this->Data = nullptr;
   }
 
-  // Allow this object to be passed as if it were a pointer.
-  operator T*() { return this->Data; }
-
-private:
+  enum
+  {
+    SmallSize = 16
+  };
+  T Small[SmallSize];
   T* Data;
+
+  vtkClientServerStreamDataArg(const vtkClientServerStreamDataArg&) = delete;
+  void operator=(const vtkClientServerStreamDataArg&) = delete;
 };
 #endif
 
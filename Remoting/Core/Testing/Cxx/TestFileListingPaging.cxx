@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCollection.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPVFileInformation.h"
+#include "vtkPVFileInformationHelper.h"
+#include "vtkTestUtilities.h"
+
+#include <vtksys/SystemTools.hxx>
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#define VERIFY(x, ...)                                                                             \
+  if (!(x))                                                                                        \
+  {                                                                                                \
+    vtkLogF(ERROR, __VA_ARGS__);                                                                   \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+namespace
+{
+vtkPVFileInformation* GetItem(vtkPVFileInformation* info, int index)
+{
+  return vtkPVFileInformation::SafeDownCast(info->GetContents()->GetItemAsObject(index));
+}
+}
+
+int TestFileListingPaging(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  const std::string directory = std::string(tempDir) + "/TestFileListingPaging";
+  delete[] tempDir;
+  vtksys::SystemTools::RemoveADirectory(directory);
+  vtksys::SystemTools::MakeDirectory(directory);
+  vtksys::SystemTools::MakeDirectory(directory + "/sub");
+  for (const char* name :
+    { "data_3.vtk", "data_0.vtk", "file_c.txt", "data_2.vtk", "File_b.txt", "data_1.vtk" })
+  {
+    std::ofstream file(directory + "/" + name);
+    file << name;
+  }
+
+  vtkNew<vtkPVFileInformationHelper> helper;
+  vtkNew<vtkPVFileInformation> info;
+  helper->SetPath(directory.c_str());
+  helper->SetDirectoryListing(1);
+
+  // the complete listing, directories first then sorted by case-insensitive
+  // name with the sequence grouped. It is listed twice so that the second
+  // listing may come from the cache.
+  for (int cc = 0; cc < 2; ++cc)
+  {
+    info->CopyFromObject(helper);
+    VERIFY(info->GetTotalNumberOfContents() == 4 && info->GetContents()->GetNumberOfItems() == 4,
+      "Unexpected number of entries %d.", info->GetContents()->GetNumberOfItems());
+    VERIFY(strcmp(GetItem(info, 0)->GetName(), "sub") == 0 &&
+        GetItem(info, 0)->GetType() == vtkPVFileInformation::DIRECTORY,
+      "Unexpected entry '%s'.", GetItem(info, 0)->GetName());
+    vtkPVFileInformation* group = GetItem(info, 1);
+    VERIFY(group->GetType() == vtkPVFileInformation::FILE_GROUP &&
+        group->GetContents()->GetNumberOfItems() == 4,
+      "Expected a group of 4 files, got '%s'.", group->GetName());
+    VERIFY(strcmp(GetItem(group, 0)->GetName(), "data_0.vtk") == 0 &&
+        strcmp(GetItem(group, 3)->GetName(), "data_3.vtk") == 0,
+      "Unexpected group order.");
+    VERIFY(strcmp(GetItem(info, 2)->GetName(), "File_b.txt") == 0 &&
+        GetItem(info, 2)->GetType() == vtkPVFileInformation::SINGLE_FILE,
+      "Unexpected entry '%s'.", GetItem(info, 2)->GetName());
+  }
+
+  // a page in the middle of the listing.
+  helper->SetListingOffset(2);
+  helper->SetListingLimit(2);
+  info->CopyFromObject(helper);
+  VERIFY(info->GetTotalNumberOfContents() == 4 && info->GetContents()->GetNumberOfItems() == 2,
+    "Unexpected number of entries %d.", info->GetContents()->GetNumberOfItems());
+  VERIFY(strcmp(GetItem(info, 0)->GetName(), "File_b.txt") == 0 &&
+      strcmp(GetItem(info, 1)->GetName(), "file_c.txt") == 0,
+    "Unexpected page.");
+
+  // a page past the end of the listing.
+  helper->SetListingOffset(10);
+  info->CopyFromObject(helper);
+  VERIFY(info->GetTotalNumberOfContents() == 4 && info->GetContents()->GetNumberOfItems() == 0,
+    "Unexpected number of entries %d.", info->GetContents()->GetNumberOfItems());
+
+  // adding a file must not serve a stale listing.
+  {
+    std::ofstream file(directory + "/file_a.txt");
+    file << "file_a.txt";
+  }
+  helper->SetListingOffset(0);
+  helper->SetListingLimit(1);
+  info->CopyFromObject(helper);
+  VERIFY(info->GetTotalNumberOfContents() == 5, "Stale listing.");
+
+  vtksys::SystemTools::RemoveADirectory(directory);
+  return EXIT_SUCCESS;
+}
@@ -7,6 +7,8 @@
 #include "vtkPVArrayInformation.h"
 #include "vtkSmartPointer.h"
 
+#include <cmath>
+
 vtkSmartPointer<vtkFloatArray> GetPolyData()
 {
   vtkIdType numPts = 101;
@@ -130,5 +132,95 @@ int TestPVArrayInformation(int, char*[])
     return EXIT_FAILURE;
   }
 
+  // Multiple components: the magnitude range is computed along with the
+  // component ranges, NaNs are ignored.
+  vtkNew<vtkFloatArray> vectors;
+  vectors->SetName("vectors");
+  vectors->SetNumberOfComponents(3);
+  vectors->SetNumberOfTuples(1000);
+  for (vtkIdType cc = 0; cc < 1000; ++cc)
+  {
+    vectors->SetTuple3(cc, cc, -2.0 * cc, 0.0);
+  }
+  vectors->SetTuple3(10, vtkMath::Nan(), 0.0, 0.0);
+  vectors->SetTuple3(20, 0.0, 0.0, vtkMath::Inf());
+  fd->AddArray(vectors);
+  info->Initialize();
+  info->CopyFromArray(vectors, fd);
+  range = info->GetComponentRange(1);
+  if (range[0] != -2.0 * 999 || range[1] != 0.0)
+  {
+    cerr << "ERROR: incorrect component range: " << range[0] << ", " << range[1] << endl;
+    return EXIT_FAILURE;
+  }
+  range = info->GetComponentRange(2);
+  if (range[0] != 0.0 || range[1] != vtkMath::Inf())
+  {
+    cerr << "ERROR: incorrect component range: " << range[0] << ", " << range[1] << endl;
+    return EXIT_FAILURE;
+  }
+  range = info->GetComponentFiniteRange(-1);
+  if (range[0] != 0.0 || !vtkMathUtilities::FuzzyCompare(range[1], std::sqrt(5.0) * 999))
+  {
+    cerr << "ERROR: incorrect magnitude range: " << range[0] << ", " << range[1] << endl;
+    return EXIT_FAILURE;
+  }
+
+  // ranges can be skipped.
+  info->Initialize();
+  info->CopyFromArray(vectors, fd, false);
+  range = info->GetComponentRange(0);
+  if (info->GetNumberOfComponents() != 3 || range[0] <= range[1])
+  {
+    cerr << "ERROR: ranges must not be computed." << endl;
+    return EXIT_FAILURE;
+  }
+
+  // ranges are memoized in the array until it is modified. Change a value
+  // without marking the array as modified to detect the reuse.
+  info->Initialize();
+  info->CopyFromArray(vectors, fd);
+  if (info->GetNumberOfInformationKeys() != 0)
+  {
+    cerr << "ERROR: the ranges cache must not be reported as an information key." << endl;
+    return EXIT_FAILURE;
+  }
+  vectors->GetPointer(0)[1] = 5000.0;
+  info->Initialize();
+  info->CopyFromArray(vectors, fd);
+  if (info->GetComponentRange(1)[1] != 0.0)
+  {
+    cerr << "ERROR: memoized ranges were not reused." << endl;
+    return EXIT_FAILURE;
+  }
+  vectors->Modified();
+  info->Initialize();
+  info->CopyFromArray(vectors, fd);
+  if (info->GetComponentRange(1)[1] != 5000.0)
+  {
+    cerr << "ERROR: memoized ranges were not updated: " << info->GetComponentRange(1)[1] << endl;
+    return EXIT_FAILURE;
+  }
+
+  // a copy shares the information of the array, but not the memoized ranges.
+  vtkNew<vtkFloatArray> copy;
+  copy->DeepCopy(vectors);
+  copy->GetPointer(0)[1] = 6000.0;
+  info->Initialize();
+  info->CopyFromArray(copy, fd);
+  if (info->GetComponentRange(1)[1] != 6000.0)
+  {
+    cerr << "ERROR: ranges of the copied array were reused for the copy." << endl;
+    return EXIT_FAILURE;
+  }
+  vectors->GetPointer(0)[1] = 7000.0;
+  info->Initialize();
+  info->CopyFromArray(vectors, fd);
+  if (info->GetComponentRange(1)[1] != 5000.0)
+  {
+    cerr << "ERROR: ranges memoized for the array were replaced by the copy." << endl;
+    return EXIT_FAILURE;
+  }
+
   return EXIT_SUCCESS;
 }
@@ -0,0 +1,168 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkDoubleArray.h"
+#include "vtkFieldData.h"
+#include "vtkInformation.h"
+#include "vtkImageData.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPVArrayInformation.h"
+#include "vtkPVDataInformation.h"
+#include "vtkPointData.h"
+
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+void AddArray(vtkImageData* img, double value)
+{
+  vtkNew<vtkDoubleArray> array;
+  array->SetName("values");
+  array->SetNumberOfTuples(img->GetNumberOfPoints());
+  array->FillComponent(0, value);
+  img->GetPointData()->AddArray(array);
+}
+
+bool CheckRange(vtkMultiBlockDataSet* mb, double min, double max, vtkIdType numPoints)
+{
+  vtkNew<vtkPVDataInformation> info;
+  info->CopyFromObject(mb);
+  auto ainfo = info->GetArrayInformation("values", vtkDataObject::POINT);
+  if (ainfo == nullptr)
+  {
+    cerr << "ERROR: failed to find `values`." << endl;
+    return false;
+  }
+  const double* range = ainfo->GetComponentRange(0);
+  if (range[0] != min || range[1] != max)
+  {
+    cerr << "ERROR: expected range [" << min << ", " << max << "], got [" << range[0] << ", "
+         << range[1] << "]." << endl;
+    return false;
+  }
+  if (info->GetNumberOfPoints() != numPoints)
+  {
+    cerr << "ERROR: expected " << numPoints << " points, got " << info->GetNumberOfPoints()
+         << "." << endl;
+    return false;
+  }
+  return true;
+}
+
+// Returns the information memoized for each block.
+std::vector<vtkPVDataInformation*> GetLeafInformation(vtkMultiBlockDataSet* mb)
+{
+  std::vector<vtkPVDataInformation*> leaves;
+  for (unsigned int cc = 0; cc < mb->GetNumberOfBlocks(); ++cc)
+  {
+    leaves.push_back(vtkPVDataInformation::SafeDownCast(
+      mb->GetBlock(cc)->GetInformation()->Get(vtkPVDataInformation::LEAF_INFORMATION_CACHE())));
+  }
+  return leaves;
+}
+
+// Checks that only the `scanned` block was scanned again since `leaves` and
+// `mtimes` were recorded.
+bool CheckScanned(vtkMultiBlockDataSet* mb, const std::vector<vtkPVDataInformation*>& leaves,
+  const std::vector<vtkMTimeType>& mtimes, unsigned int scanned)
+{
+  const auto current = GetLeafInformation(mb);
+  for (unsigned int cc = 0; cc < mb->GetNumberOfBlocks(); ++cc)
+  {
+    if (current[cc] != leaves[cc])
+    {
+      cerr << "ERROR: memoized information of block " << cc << " was replaced." << endl;
+      return false;
+    }
+    if ((current[cc]->GetMTime() != mtimes[cc]) != (cc == scanned))
+    {
+      cerr << "ERROR: block " << cc << (cc == scanned ? " was not" : " was")
+           << " scanned again." << endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+std::vector<vtkMTimeType> GetMTimes(const std::vector<vtkPVDataInformation*>& leaves)
+{
+  std::vector<vtkMTimeType> mtimes;
+  for (auto leaf : leaves)
+  {
+    mtimes.push_back(leaf->GetMTime());
+  }
+  return mtimes;
+}
+}
+
+int TestPVDataInformationLeafCache(int, char*[])
+{
+  const unsigned int numBlocks = 100;
+  vtkNew<vtkMultiBlockDataSet> mb;
+  for (unsigned int cc = 0; cc < numBlocks; ++cc)
+  {
+    vtkNew<vtkImageData> img;
+    img->SetDimensions(4, 4, 4);
+    AddArray(img, cc);
+    mb->SetBlock(cc, img);
+  }
+  if (!CheckRange(mb, 0, numBlocks - 1, numBlocks * 64))
+  {
+    return EXIT_FAILURE;
+  }
+
+  const auto leaves = GetLeafInformation(mb);
+  for (unsigned int cc = 0; cc < numBlocks; ++cc)
+  {
+    if (!leaves[cc])
+    {
+      cerr << "ERROR: missing memoized information for block " << cc << "." << endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // gathering again must not change anything, nor scan any block.
+  auto mtimes = GetMTimes(leaves);
+  if (!CheckRange(mb, 0, numBlocks - 1, numBlocks * 64) ||
+    !CheckScanned(mb, leaves, mtimes, numBlocks))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // modify the values of one block, only that block is scanned again.
+  auto img5 = vtkImageData::SafeDownCast(mb->GetBlock(5));
+  auto array5 = vtkDoubleArray::SafeDownCast(img5->GetPointData()->GetArray("values"));
+  array5->SetValue(3, -10.0);
+  array5->Modified();
+  if (!CheckRange(mb, -10, numBlocks - 1, numBlocks * 64) ||
+    !CheckScanned(mb, leaves, mtimes, 5))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // modify the structure of another block.
+  mtimes = GetMTimes(leaves);
+  auto img7 = vtkImageData::SafeDownCast(mb->GetBlock(7));
+  img7->SetDimensions(5, 4, 4);
+  AddArray(img7, 1000.0);
+  if (!CheckRange(mb, -10, 1000, numBlocks * 64 + 16) || !CheckScanned(mb, leaves, mtimes, 7))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // field data is not part of the dataset MTime.
+  auto img3 = vtkImageData::SafeDownCast(mb->GetBlock(3));
+  vtkNew<vtkDoubleArray> fieldArray;
+  fieldArray->SetName("field");
+  fieldArray->InsertNextValue(1.0);
+  img3->GetFieldData()->AddArray(fieldArray);
+  vtkNew<vtkPVDataInformation> info;
+  info->CopyFromObject(mb);
+  if (info->GetArrayInformation("field", vtkDataObject::FIELD) == nullptr)
+  {
+    cerr << "ERROR: failed to find `field`." << endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
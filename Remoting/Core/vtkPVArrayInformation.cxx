@@ -3,21 +3,28 @@
 #include "vtkPVArrayInformation.h"
 
 #include "vtkAbstractArray.h"
+#include "vtkArrayDispatch.h"
 #include "vtkClientServerStream.h"
 #include "vtkDataArray.h"
+#include "vtkDataArrayRange.h"
 #include "vtkFieldData.h"
 #include "vtkGenericAttribute.h"
 #include "vtkInformation.h"
 #include "vtkInformationIterator.h"
 #include "vtkInformationKey.h"
+#include "vtkInformationObjectBaseKey.h"
 #include "vtkNew.h"
 #include "vtkNumberToString.h"
 #include "vtkObjectFactory.h"
 #include "vtkPVLogger.h"
 #include "vtkPVPostFilter.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkStringArray.h"
+#include "vtkUnsignedCharArray.h"
 
 #include <algorithm>
+#include <cmath>
 #include <map>
 #include <set>
 #include <sstream>
@@ -40,9 +47,198 @@ vtkTuple<double, 2> MergeRanges(const vtkTuple<double, 2>& r1, const vtkTuple<do
   return vtkTuple<double, 2>({ std::min(r1[0], r2[0]), std::max(r1[1], r2[1]) });
 }
 
+// Computes the range and the finite range of all components and of the
+// magnitude in a single parallel pass over the array. This replaces the
+// separate passes done by vtkDataArray::GetRange/GetFiniteRange for each
+// component. Ranges are stored as [min, max, finite-min, finite-max], the
+// magnitude first, followed by each component. As with vtkDataArray, NaNs are
+// ignored and the magnitude range of single component arrays is the range of
+// that component.
+template <typename ArrayT>
+class vtkArrayRangesFunctor
+{
+  ArrayT* Array;
+  const int NumberOfComponents;
+  vtkUnsignedCharArray* Ghosts;
+  const unsigned char GhostsToSkip;
+  vtkSMPThreadLocal<std::vector<double>> TLRanges;
+
+public:
+  std::vector<double> Ranges;
+
+  vtkArrayRangesFunctor(ArrayT* array, vtkUnsignedCharArray* ghosts, unsigned char ghostsToSkip)
+    : Array(array)
+    , NumberOfComponents(array->GetNumberOfComponents())
+    , Ghosts(ghosts)
+    , GhostsToSkip(ghostsToSkip)
+  {
+  }
+
+  static void InitializeRanges(std::vector<double>& ranges, int numComps)
+  {
+    ranges.resize(4 * (numComps + 1));
+    for (size_t cc = 0; cc < ranges.size(); cc += 2)
+    {
+      ranges[cc] = VTK_DOUBLE_MAX;
+      ranges[cc + 1] = -VTK_DOUBLE_MAX;
+    }
+  }
+
+  void Initialize() { InitializeRanges(this->TLRanges.Local(), this->NumberOfComponents); }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    double* ranges = this->TLRanges.Local().data();
+    const int numComps = this->NumberOfComponents;
+    const unsigned char* ghosts = this->Ghosts ? this->Ghosts->GetPointer(0) : nullptr;
+    vtkIdType tupleIdx = begin;
+    for (const auto tuple : vtk::DataArrayTupleRange(this->Array, begin, end))
+    {
+      if (ghosts && (ghosts[tupleIdx++] & this->GhostsToSkip) != 0)
+      {
+        continue;
+      }
+      double squaredNorm = 0.0;
+      for (int comp = 0; comp < numComps; ++comp)
+      {
+        const double value = static_cast<double>(tuple[comp]);
+        double* crange = ranges + 4 * (comp + 1);
+        if (!std::isnan(value))
+        {
+          crange[0] = std::min(crange[0], value);
+          crange[1] = std::max(crange[1], value);
+          if (std::isfinite(value))
+          {
+            crange[2] = std::min(crange[2], value);
+            crange[3] = std::max(crange[3], value);
+          }
+        }
+        squaredNorm += value * value;
+      }
+      if (!std::isnan(squaredNorm))
+      {
+        ranges[0] = std::min(ranges[0], squaredNorm);
+        ranges[1] = std::max(ranges[1], squaredNorm);
+        if (std::isfinite(squaredNorm))
+        {
+          ranges[2] = std::min(ranges[2], squaredNorm);
+          ranges[3] = std::max(ranges[3], squaredNorm);
+        }
+      }
+    }
+  }
+
+  void Reduce()
+  {
+    InitializeRanges(this->Ranges, this->NumberOfComponents);
+    for (const auto& local : this->TLRanges)
+    {
+      for (size_t cc = 0; cc < this->Ranges.size(); cc += 2)
+      {
+        this->Ranges[cc] = std::min(this->Ranges[cc], local[cc]);
+        this->Ranges[cc + 1] = std::max(this->Ranges[cc + 1], local[cc + 1]);
+      }
+    }
+
+    if (this->NumberOfComponents == 1)
+    {
+      std::copy(this->Ranges.begin() + 4, this->Ranges.end(), this->Ranges.begin());
+      return;
+    }
+    for (int cc = 0; cc < 4; cc += 2)
+    {
+      if (this->Ranges[cc] <= this->Ranges[cc + 1])
+      {
+        this->Ranges[cc] = std::sqrt(this->Ranges[cc]);
+        this->Ranges[cc + 1] = std::sqrt(this->Ranges[cc + 1]);
+      }
+    }
+  }
+};
+
+struct vtkArrayRangesWorker
+{
+  template <typename ArrayT>
+  void operator()(ArrayT* array, vtkUnsignedCharArray* ghosts, unsigned char ghostsToSkip,
+    std::vector<double>& ranges)
+  {
+    vtkArrayRangesFunctor<ArrayT> functor(array, ghosts, ghostsToSkip);
+    vtkSMPTools::For(0, array->GetNumberOfTuples(), functor);
+    ranges = std::move(functor.Ranges);
+  }
+};
+
 } // end of namespace
 
+// Ranges memoized in an array, see vtkPVArrayInformation::RANGES_CACHE().
+class vtkPVArrayInformationRangesCache : public vtkObject
+{
+public:
+  static vtkPVArrayInformationRangesCache* New();
+  vtkTypeMacro(vtkPVArrayInformationRangesCache, vtkObject);
+
+  std::vector<double> Ranges;
+  // copying an array copies its information, and thus shares this object
+  // with the copy. It is only valid for the array it was computed for.
+  vtkDataArray* Array = nullptr;
+  vtkMTimeType ArrayMTime = 0;
+  vtkMTimeType GhostsMTime = 0;
+  unsigned char GhostsToSkip = 0;
+
+protected:
+  vtkPVArrayInformationRangesCache() = default;
+  ~vtkPVArrayInformationRangesCache() override = default;
+
+private:
+  vtkPVArrayInformationRangesCache(const vtkPVArrayInformationRangesCache&) = delete;
+  void operator=(const vtkPVArrayInformationRangesCache&) = delete;
+};
+vtkStandardNewMacro(vtkPVArrayInformationRangesCache);
+
+namespace
+{
+// Returns the ranges computed by vtkArrayRangesFunctor, reusing the ones
+// memoized in the array when neither the array nor the ghost array changed.
+const std::vector<double>& GetArrayRanges(vtkDataArray* array, vtkFieldData* fd)
+{
+  vtkUnsignedCharArray* ghosts = fd ? fd->GetGhostArray() : nullptr;
+  if (ghosts && ghosts->GetNumberOfTuples() != array->GetNumberOfTuples())
+  {
+    ghosts = nullptr;
+  }
+  const unsigned char ghostsToSkip = ghosts ? fd->GetGhostsToSkip() : 0;
+  const vtkMTimeType ghostsMTime = ghosts ? ghosts->GetMTime() : 0;
+
+  vtkInformation* info = array->GetInformation();
+  auto key = vtkPVArrayInformation::RANGES_CACHE();
+  auto cache = vtkPVArrayInformationRangesCache::SafeDownCast(info->Get(key));
+  if (cache && cache->Array == array && cache->ArrayMTime == array->GetMTime() &&
+    cache->GhostsMTime == ghostsMTime && cache->GhostsToSkip == ghostsToSkip)
+  {
+    return cache->Ranges;
+  }
+  if (!cache || cache->Array != array)
+  {
+    vtkNew<vtkPVArrayInformationRangesCache> newCache;
+    info->Set(key, newCache);
+    cache = newCache;
+  }
+
+  vtkArrayRangesWorker worker;
+  if (!vtkArrayDispatch::Dispatch::Execute(array, worker, ghosts, ghostsToSkip, cache->Ranges))
+  {
+    worker(array, ghosts, ghostsToSkip, cache->Ranges);
+  }
+  cache->Array = array;
+  cache->ArrayMTime = array->GetMTime();
+  cache->GhostsMTime = ghostsMTime;
+  cache->GhostsToSkip = ghostsToSkip;
+  return cache->Ranges;
+}
+}
+
 vtkStandardNewMacro(vtkPVArrayInformation);
+vtkInformationKeyMacro(vtkPVArrayInformation, RANGES_CACHE, ObjectBase);
 //----------------------------------------------------------------------------
 vtkPVArrayInformation::vtkPVArrayInformation() = default;
 
@@ -249,7 +445,8 @@ void vtkPVArrayInformation::DeepCopy(vtkPVArrayInformation* other)
 }
 
 //----------------------------------------------------------------------------
-void vtkPVArrayInformation::CopyFromArray(vtkAbstractArray* array, vtkFieldData* fd)
+void vtkPVArrayInformation::CopyFromArray(
+  vtkAbstractArray* array, vtkFieldData* fd, bool computeRanges)
 {
   assert(array != nullptr);
   this->Name = array->GetName() ? array->GetName() : "";
@@ -280,18 +477,16 @@ void vtkPVArrayInformation::CopyFromArray(vtkAbstractArray* array, vtkFieldData*
   }
 
   auto dataArray = vtkDataArray::SafeDownCast(array);
-  if (dataArray && dataArray->IsNumeric())
+  if (dataArray && dataArray->IsNumeric() && computeRanges &&
+    dataArray->GetNumberOfTuples() > 0)
   {
+    const std::vector<double>& ranges = ::GetArrayRanges(dataArray, fd);
     for (int comp = -1; comp < numComponents; ++comp)
     {
       auto& compInfo = this->Components.at(comp + 1);
-      if (!fd || !array->GetName() ||
-        !fd->GetRange(dataArray->GetName(), compInfo.Range.GetData(), comp) ||
-        !fd->GetFiniteRange(dataArray->GetName(), compInfo.FiniteRange.GetData(), comp))
-      {
-        dataArray->GetRange(compInfo.Range.GetData(), comp);
-        dataArray->GetFiniteRange(compInfo.FiniteRange.GetData(), comp);
-      }
+      const double* crange = &ranges[4 * (comp + 1)];
+      compInfo.Range = vtkTuple<double, 2>({ crange[0], crange[1] });
+      compInfo.FiniteRange = vtkTuple<double, 2>({ crange[2], crange[3] });
     }
   }
   else if (auto sarray = vtkStringArray::SafeDownCast(array))
@@ -315,6 +510,10 @@ void vtkPVArrayInformation::CopyFromArray(vtkAbstractArray* array, vtkFieldData*
     for (it->GoToFirstItem(); !it->IsDoneWithTraversal(); it->GoToNextItem())
     {
       vtkInformationKey* key = it->GetCurrentKey();
+      if (key == vtkPVArrayInformation::RANGES_CACHE())
+      {
+        continue;
+      }
       this->InformationKeys.insert(
         std::make_pair<std::string, std::string>(key->GetLocation(), key->GetName()));
     }
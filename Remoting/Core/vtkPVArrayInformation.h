@@ -24,6 +24,7 @@ class vtkAbstractArray;
 class vtkFieldData;
 class vtkClientServerStream;
 class vtkGenericAttribute;
+class vtkInformationObjectBaseKey;
 
 class VTKREMOTINGCORE_EXPORT vtkPVArrayInformation : public vtkObject
 {
@@ -132,8 +133,24 @@ public:
   const char* GetStringValue(int);
   ///@}
 
-  void CopyFromArray(vtkAbstractArray* array, vtkFieldData* fd = nullptr);
+  /**
+   * Populate the information from the array. The ranges of the components and
+   * of the magnitude are computed in a single parallel pass over the array,
+   * skipping the tuples flagged in the ghost array of \c fd, if any. The
+   * result is memoized in the array, see RANGES_CACHE(). Set \c computeRanges
+   * to false to skip that pass, in which case the ranges are left invalid.
+   */
+  void CopyFromArray(
+    vtkAbstractArray* array, vtkFieldData* fd = nullptr, bool computeRanges = true);
   void CopyFromGenericAttribute(vtkGenericAttribute* array);
+
+  /**
+   * Key used to memoize the ranges computed by CopyFromArray() in the
+   * information of the array. Like the ranges cached by
+   * vtkFieldData::GetRange(), they are reused until the array or the ghost
+   * array is modified. Copies of the array do not reuse them. For internal use.
+   */
+  static vtkInformationObjectBaseKey* RANGES_CACHE();
   void CopyToStream(vtkClientServerStream*) const;
   bool CopyFromStream(const vtkClientServerStream*);
 
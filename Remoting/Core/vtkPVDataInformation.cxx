@@ -24,10 +24,12 @@
 #include "vtkExecutive.h"
 #include "vtkExplicitStructuredGrid.h"
 #include "vtkExtractBlockUsingDataAssembly.h"
+#include "vtkFieldData.h"
 #include "vtkGraph.h"
 #include "vtkHyperTreeGrid.h"
 #include "vtkImageData.h"
 #include "vtkInformation.h"
+#include "vtkInformationObjectBaseKey.h"
 #include "vtkLegacy.h"
 #include "vtkMath.h"
 #include "vtkMultiBlockDataSet.h"
@@ -60,10 +62,90 @@
 #include <string>
 #include <vector>
 
+namespace
+{
+// Returns a time stamp that changes whenever the information collected from a
+// non-composite dataset may change.
+vtkMTimeType GetLeafMTime(vtkDataObject* dobj)
+{
+  vtkMTimeType mtime = dobj->GetMTime();
+  for (int cc = 0; cc < vtkDataObject::NUMBER_OF_ATTRIBUTE_TYPES; ++cc)
+  {
+    // not all data objects include their attributes in their MTime.
+    if (auto fd = dobj->GetAttributesAsFieldData(cc))
+    {
+      mtime = std::max(mtime, fd->GetMTime());
+    }
+  }
+  return mtime;
+}
+}
+
+// Information memoized for a non-composite dataset, see
+// vtkPVDataInformation::LEAF_INFORMATION_CACHE().
+class vtkPVDataInformationLeafCache : public vtkPVDataInformation
+{
+public:
+  static vtkPVDataInformationLeafCache* New();
+  vtkTypeMacro(vtkPVDataInformationLeafCache, vtkPVDataInformation);
+
+  vtkMTimeType DataMTime = 0;
+
+protected:
+  vtkPVDataInformationLeafCache() = default;
+  ~vtkPVDataInformationLeafCache() override = default;
+
+private:
+  vtkPVDataInformationLeafCache(const vtkPVDataInformationLeafCache&) = delete;
+  void operator=(const vtkPVDataInformationLeafCache&) = delete;
+};
+vtkStandardNewMacro(vtkPVDataInformationLeafCache);
+
 class vtkPVDataInformationAccumulator
 {
   vtkNew<vtkPVDataInformation> Current;
 
+  // Returns true if `cached` has the array ranges requested by `owner`.
+  static bool HasRanges(vtkPVDataInformation* cached, vtkPVDataInformation* owner)
+  {
+    return cached->ComputeArrayRanges || !owner->ComputeArrayRanges;
+  }
+
+  // Returns the information for the non-composite dataset, reusing the
+  // information memoized in the dataset if it has not been modified since.
+  vtkPVDataInformation* GetLeafInformation(vtkPVDataInformation* owner, vtkDataObject* dobj)
+  {
+    vtkInformation* dinfo = dobj->GetInformation();
+    if (!dinfo)
+    {
+      this->Current->Initialize();
+      this->Current->ComputeArrayRanges = owner->ComputeArrayRanges;
+      this->Current->CopyFromDataObject(dobj);
+      return this->Current;
+    }
+
+    auto key = vtkPVDataInformation::LEAF_INFORMATION_CACHE();
+    auto cache = vtkPVDataInformationLeafCache::SafeDownCast(dinfo->Get(key));
+    if (cache && cache->DataMTime == ::GetLeafMTime(dobj) &&
+      vtkPVDataInformationAccumulator::HasRanges(cache, owner))
+    {
+      return cache;
+    }
+    if (!cache)
+    {
+      vtkNew<vtkPVDataInformationLeafCache> newCache;
+      dinfo->Set(key, newCache);
+      cache = newCache;
+    }
+    cache->Initialize();
+    cache->ComputeArrayRanges = owner->ComputeArrayRanges;
+    cache->CopyFromDataObject(dobj);
+    cache->Modified();
+    // computed last in case updating the cache modified the dataset.
+    cache->DataMTime = ::GetLeafMTime(dobj);
+    return cache;
+  }
+
 public:
   std::set<int> UniqueBlockTypes;
   vtkPVDataInformation* operator()(vtkPVDataInformation* info, vtkDataObject* dobj)
@@ -74,13 +156,12 @@ public:
     }
     assert(vtkCompositeDataSet::SafeDownCast(dobj) == nullptr);
 
-    this->Current->Initialize();
-    this->Current->CopyFromDataObject(dobj);
-    if (this->Current->GetDataSetType() != -1)
+    vtkPVDataInformation* current = this->GetLeafInformation(info, dobj);
+    if (current->GetDataSetType() != -1)
     {
-      assert(this->Current->GetCompositeDataSetType() == -1);
-      this->UniqueBlockTypes.insert(this->Current->GetDataSetType());
-      info->AddInformation(this->Current);
+      assert(current->GetCompositeDataSetType() == -1);
+      this->UniqueBlockTypes.insert(current->GetDataSetType());
+      info->AddInformation(current);
     }
     return info;
   }
@@ -149,6 +230,7 @@ void MergeRange(double range[2], const double orange[2])
 }
 
 vtkStandardNewMacro(vtkPVDataInformation);
+vtkInformationKeyMacro(vtkPVDataInformation, LEAF_INFORMATION_CACHE, ObjectBase);
 //----------------------------------------------------------------------------
 vtkPVDataInformation::vtkPVDataInformation()
 {
@@ -166,6 +248,7 @@ void vtkPVDataInformation::CopyParametersToStream(vtkMultiProcessStream& str)
 {
   str << 828792 << this->PortNumber << std::string(this->SubsetSelector ? SubsetSelector : "")
       << std::string(this->SubsetAssemblyName ? this->SubsetAssemblyName : "") << this->Rank;
+  str << (this->ComputeArrayRanges ? 1 : 0);
 }
 
 //----------------------------------------------------------------------------
@@ -180,6 +263,10 @@ void vtkPVDataInformation::CopyParametersFromStream(vtkMultiProcessStream& str)
   }
   this->SetSubsetSelector(path.empty() ? nullptr : path.c_str());
   this->SetSubsetAssemblyName(name.empty() ? nullptr : name.c_str());
+
+  int computeArrayRanges;
+  str >> computeArrayRanges;
+  this->ComputeArrayRanges = (computeArrayRanges != 0);
 }
 
 //----------------------------------------------------------------------------
@@ -195,6 +282,7 @@ void vtkPVDataInformation::PrintSelf(ostream& os, vtkIndent indent)
      << endl;
   os << indent << "SubsetAssemblyName: "
      << (this->SubsetAssemblyName ? this->SubsetAssemblyName : "(nullptr)") << endl;
+  os << indent << "ComputeArrayRanges: " << this->ComputeArrayRanges << endl;
   os << indent << "DataSetType: " << this->DataSetType << endl;
   os << indent << "CompositeDataSetType: " << this->CompositeDataSetType << endl;
   os << indent << "FirstLeafCompositeIndex: " << this->FirstLeafCompositeIndex << endl;
@@ -530,7 +618,7 @@ void vtkPVDataInformation::CopyFromDataObject(vtkDataObject* dobj)
 
   for (int cc = 0; cc < vtkDataObject::NUMBER_OF_ATTRIBUTE_TYPES; ++cc)
   {
-    this->AttributeInformations[cc]->CopyFromDataObject(dobj);
+    this->AttributeInformations[cc]->CopyFromDataObject(dobj, this->ComputeArrayRanges);
     switch (cc)
     {
       case vtkDataObject::FIELD:
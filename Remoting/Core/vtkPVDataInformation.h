@@ -32,6 +32,7 @@ class vtkGenericDataSet;
 class vtkGraph;
 class vtkHyperTreeGrid;
 class vtkInformation;
+class vtkInformationObjectBaseKey;
 class vtkPVArrayInformation;
 class vtkPVDataInformationHelper;
 class vtkPVDataSetAttributesInformation;
@@ -86,6 +87,18 @@ public:
   void SetSubsetAssemblyNameToHierarchy();
   ///@}
 
+  ///@{
+  /**
+   * Computing array ranges requires a pass over every array. Set to false when
+   * only the structure of the data is needed, e.g. the memory size or the list
+   * of arrays, to skip that pass. The ranges are then left invalid.
+   * Default is true.
+   */
+  vtkSetMacro(ComputeArrayRanges, bool);
+  vtkGetMacro(ComputeArrayRanges, bool);
+  vtkBooleanMacro(ComputeArrayRanges, bool);
+  ///@}
+
   /**
    * Populate vtkPVDataInformation using `object`. The object can be a
    * `vtkDataObject`, `vtkAlgorithm` or `vtkAlgorithmOutput`.
@@ -461,6 +474,16 @@ public:
    */
   unsigned int ComputeCompositeIndexForAMR(unsigned int level, unsigned int index) const;
 
+  /**
+   * Key used to memoize the information collected from non-composite datasets.
+   * The vtkPVDataInformation for each leaf is stored in the leaf's information
+   * and reused as long as the leaf, its attributes and arrays are not modified.
+   * Thus, gathering information again after a few blocks of a large composite
+   * dataset changed only scans the modified blocks. The MTime of the stored
+   * information changes each time its leaf is scanned again. For internal use.
+   */
+  static vtkInformationObjectBaseKey* LEAF_INFORMATION_CACHE();
+
 protected:
   vtkPVDataInformation();
   ~vtkPVDataInformation() override;
@@ -487,6 +510,7 @@ private:
   int Rank = -1;
   char* SubsetSelector = nullptr;
   char* SubsetAssemblyName = nullptr;
+  bool ComputeArrayRanges = true;
 
   int DataSetType = -1;
   int CompositeDataSetType = -1;
@@ -129,7 +129,7 @@ void vtkPVDataSetAttributesInformation::DeepCopy(vtkPVDataSetAttributesInformati
 }
 
 //----------------------------------------------------------------------------
-void vtkPVDataSetAttributesInformation::CopyFromDataObject(vtkDataObject* dobj)
+void vtkPVDataSetAttributesInformation::CopyFromDataObject(vtkDataObject* dobj, bool computeRanges)
 {
   auto& internals = (*this->Internals);
 
@@ -155,7 +155,7 @@ void vtkPVDataSetAttributesInformation::CopyFromDataObject(vtkDataObject* dobj)
       if (array && !vtkSkipArray(array->GetName()))
       {
         vtkPVArrayInformation* ainfo = vtkPVArrayInformation::New();
-        ainfo->CopyFromArray(array, fd);
+        ainfo->CopyFromArray(array, fd, computeRanges);
         internals.ArrayInformation[array->GetName()].TakeReference(ainfo);
       }
     }
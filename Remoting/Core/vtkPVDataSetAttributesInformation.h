@@ -104,9 +104,10 @@ protected:
   void DeepCopy(vtkPVDataSetAttributesInformation*);
 
   /**
-   * Initializes this instance using the data object.
+   * Initializes this instance using the data object. Array ranges are skipped
+   * when \c computeRanges is false.
    */
-  void CopyFromDataObject(vtkDataObject* dobj);
+  void CopyFromDataObject(vtkDataObject* dobj, bool computeRanges = true);
 
 private:
   vtkPVDataSetAttributesInformation(const vtkPVDataSetAttributesInformation&) = delete;
@@ -22,6 +22,8 @@ vtkPVDataSizeInformation::~vtkPVDataSizeInformation() = default;
 void vtkPVDataSizeInformation::CopyFromObject(vtkObject* object)
 {
   vtkPVDataInformation* dinfo = vtkPVDataInformation::New();
+  // only the memory size is needed.
+  dinfo->SetComputeArrayRanges(false);
 
   vtkAlgorithm* alg = vtkAlgorithm::SafeDownCast(object);
   if (alg)
@@ -31,13 +31,19 @@
 #endif
 #if defined(__APPLE__)
 #include "vtkPVMacFileInformationHelper.h"
-#include <vector>
 #endif
 
 #include <algorithm>
+#include <cctype>
 #include <ctime>
+#include <list>
+#include <memory>
+#include <mutex>
 #include <set>
+#include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 #include <vtksys/Encoding.hxx>
 #include <vtksys/RegularExpression.hxx>
 #include <vtksys/SystemTools.hxx>
@@ -339,6 +345,104 @@ class vtkPVFileInformationSet : public std::set<vtkSmartPointer<vtkPVFileInforma
 {
 };
 
+namespace
+{
+using vtkPVFileListing = std::vector<vtkClientServerStream>;
+
+// Serialized directory listings, most recently used first.
+struct vtkPVFileListingCacheEntry
+{
+  std::string Key;
+  time_t DirectoryTime;
+  std::shared_ptr<const vtkPVFileListing> Entries;
+};
+
+constexpr std::size_t vtkPVFileListingCacheCapacity = 16;
+
+std::mutex& ListingCacheMutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+std::list<vtkPVFileListingCacheEntry>& ListingCache()
+{
+  static std::list<vtkPVFileListingCacheEntry> cache;
+  return cache;
+}
+
+std::shared_ptr<const vtkPVFileListing> FindListing(const std::string& key, time_t directoryTime)
+{
+  std::lock_guard<std::mutex> lock(ListingCacheMutex());
+  auto& cache = ListingCache();
+  for (auto iter = cache.begin(); iter != cache.end(); ++iter)
+  {
+    if (iter->Key == key)
+    {
+      if (iter->DirectoryTime != directoryTime)
+      {
+        cache.erase(iter);
+        return nullptr;
+      }
+      cache.splice(cache.begin(), cache, iter);
+      return cache.front().Entries;
+    }
+  }
+  return nullptr;
+}
+
+void StoreListing(const std::string& key, time_t directoryTime,
+  const std::shared_ptr<const vtkPVFileListing>& entries)
+{
+  std::lock_guard<std::mutex> lock(ListingCacheMutex());
+  auto& cache = ListingCache();
+  cache.remove_if([&key](const vtkPVFileListingCacheEntry& entry) { return entry.Key == key; });
+  cache.push_front(vtkPVFileListingCacheEntry{ key, directoryTime, entries });
+  if (cache.size() > vtkPVFileListingCacheCapacity)
+  {
+    cache.pop_back();
+  }
+}
+
+// Returns the range of entries to return for a listing of `size` entries.
+std::pair<std::size_t, std::size_t> ListingPage(std::size_t size, int offset, int limit)
+{
+  const std::size_t first = std::min(size, static_cast<std::size_t>(std::max(offset, 0)));
+  const std::size_t last =
+    limit > 0 ? std::min(size, first + static_cast<std::size_t>(limit)) : size;
+  return std::make_pair(first, last);
+}
+
+bool NameLess(vtkPVFileInformation* a, vtkPVFileInformation* b)
+{
+  return strcmp(a->GetName(), b->GetName()) < 0;
+}
+
+// Order of the entries of a listing: directories first, then case-insensitive
+// names, which is how file dialogs show them. Clients paging through a
+// listing can then show the pages as they arrive.
+bool ListingLess(vtkPVFileInformation* a, vtkPVFileInformation* b)
+{
+  const bool aIsDirectory =
+    a->IsDirectory() || a->GetType() == vtkPVFileInformation::DIRECTORY_GROUP;
+  const bool bIsDirectory =
+    b->IsDirectory() || b->GetType() == vtkPVFileInformation::DIRECTORY_GROUP;
+  if (aIsDirectory != bIsDirectory)
+  {
+    return aIsDirectory;
+  }
+  for (const char *aName = a->GetName(), *bName = b->GetName();; ++aName, ++bName)
+  {
+    const int aChar = std::tolower(static_cast<unsigned char>(*aName));
+    const int bChar = std::tolower(static_cast<unsigned char>(*bName));
+    if (aChar != bChar || aChar == 0)
+    {
+      return aChar != bChar ? aChar < bChar : NameLess(a, b);
+    }
+  }
+}
+}
+
 //-----------------------------------------------------------------------------
 vtkPVFileInformation::vtkPVFileInformation()
 {
@@ -355,6 +459,9 @@ vtkPVFileInformation::vtkPVFileInformation()
   this->Size = 0;
   this->GroupFileSequences = true;
   this->IncludeExamples = true;
+  this->TotalNumberOfContents = 0;
+  this->ListingOffset = 0;
+  this->ListingLimit = 0;
 #ifdef _WIN32
   this->ModificationTime = _time64(nullptr);
 #else
@@ -407,6 +514,8 @@ void vtkPVFileInformation::CopyFromObject(vtkObject* object)
 
   this->FastFileTypeDetection = helper->GetFastFileTypeDetection();
   this->ReadDetailedFileInformation = helper->GetReadDetailedFileInformation();
+  this->ListingOffset = helper->GetListingOffset();
+  this->ListingLimit = helper->GetListingLimit();
 
   std::string path = helper->GetPath();
   this->SetName(path.c_str());
@@ -661,11 +770,71 @@ void vtkPVFileInformation::GetSpecialDirectories()
 //-----------------------------------------------------------------------------
 void vtkPVFileInformation::FetchDirectoryListing()
 {
+  // Without file details, a listing only depends on the names in the
+  // directory, which is what the modification time of the directory tracks.
+  // Windows listings always include file details, so they are never cached.
+  std::string key;
+  time_t directoryTime = 0;
+#if !defined(_WIN32)
+  vtksys::SystemTools::Stat_t status;
+  if (!this->ReadDetailedFileInformation && this->FullPath &&
+    vtksys::SystemTools::Stat(this->FullPath, &status) == 0)
+  {
+    std::ostringstream stream;
+    stream << this->FullPath << "\n"
+           << this->GroupFileSequences << " " << this->FastFileTypeDetection;
+    key = stream.str();
+    directoryTime = status.st_mtime;
+  }
+#endif
+
+  if (auto listing = key.empty() ? nullptr : FindListing(key, directoryTime))
+  {
+    this->TotalNumberOfContents = static_cast<int>(listing->size());
+    const auto page = ListingPage(listing->size(), this->ListingOffset, this->ListingLimit);
+    for (std::size_t cc = page.first; cc < page.second; ++cc)
+    {
+      vtkNew<vtkPVFileInformation> info;
+      info->CopyFromStream(&(*listing)[cc]);
+      this->Contents->AddItem(info);
+    }
+    return;
+  }
+
+  const time_t listingTime = time(nullptr);
 #if defined(_WIN32)
   this->FetchWindowsDirectoryListing();
 #else
   this->FetchUnixDirectoryListing();
 #endif
+
+  std::vector<vtkSmartPointer<vtkPVFileInformation>> items;
+  items.reserve(this->Contents->GetNumberOfItems());
+  for (int cc = 0; cc < this->Contents->GetNumberOfItems(); ++cc)
+  {
+    items.emplace_back(vtkPVFileInformation::SafeDownCast(this->Contents->GetItemAsObject(cc)));
+  }
+  std::sort(items.begin(), items.end(), ListingLess);
+
+  // The time stamp has a resolution of a second: a listing done during the
+  // second the directory was last modified may miss later changes.
+  if (!key.empty() && directoryTime < listingTime)
+  {
+    auto listing = std::make_shared<vtkPVFileListing>(items.size());
+    for (std::size_t cc = 0; cc < items.size(); ++cc)
+    {
+      items[cc]->CopyToStream(&(*listing)[cc]);
+    }
+    StoreListing(key, directoryTime, listing);
+  }
+
+  this->Contents->RemoveAllItems();
+  this->TotalNumberOfContents = static_cast<int>(items.size());
+  const auto page = ListingPage(items.size(), this->ListingOffset, this->ListingLimit);
+  for (std::size_t cc = page.first; cc < page.second; ++cc)
+  {
+    this->Contents->AddItem(items[cc]);
+  }
 }
 
 //-----------------------------------------------------------------------------
@@ -934,6 +1103,11 @@ void vtkPVFileInformation::FetchUnixDirectoryListing()
     {
       info->Type = DIRECTORY;
     }
+    else if (d->d_type == DT_REG)
+    {
+      // regular files need no further checks, see DetectType().
+      info->Type = SINGLE_FILE;
+    }
 #endif
 
     info->FastFileTypeDetection = this->FastFileTypeDetection;
@@ -1052,9 +1226,13 @@ void vtkPVFileInformation::OrganizeCollection(vtkPVFileInformationSet& info_set)
 
   if (this->GroupFileSequences)
   {
-    for (vtkPVFileInformationSet::iterator iter = info_set.begin(); iter != info_set.end();)
+    // Visit the items sorted by name so that consecutive files of a sequence
+    // are parsed one after the other, which vtkFileSequenceParser handles
+    // without matching its regular expressions again.
+    std::vector<vtkSmartPointer<vtkPVFileInformation>> items(info_set.begin(), info_set.end());
+    std::sort(items.begin(), items.end(), NameLess);
+    for (const auto& obj : items)
     {
-      vtkSmartPointer<vtkPVFileInformation> obj = *iter;
       // we're going to skip non-groupable file types. Note, we may get INVALID
       // here since when this->FastFileTypeDetection is true, the grouping
       // happens before the file types are detected.
@@ -1093,12 +1271,9 @@ void vtkPVFileInformation::OrganizeCollection(vtkPVFileInformationSet& info_set)
           }
 
           iter2->second.Children[std::make_pair(sequenceIndex, suffixString)] = obj;
-
-          iter = info_set.erase(iter);
-          continue; // needed to skip the ++iter, since we already incremented.
+          info_set.erase(obj);
         }
       }
-      ++iter;
     }
   }
 
@@ -1135,7 +1310,7 @@ void vtkPVFileInformation::CopyToStream(vtkClientServerStream* stream)
 {
   *stream << vtkClientServerStream::Reply << this->Name << this->FullPath << this->Type
           << this->Hidden << this->Contents->GetNumberOfItems() << this->Extension << this->Size
-          << this->ModificationTime;
+          << this->ModificationTime << this->TotalNumberOfContents;
 
   vtkSmartPointer<vtkCollectionIterator> iter;
   iter.TakeReference(this->Contents->NewIterator());
@@ -1202,11 +1377,16 @@ void vtkPVFileInformation::CopyFromStream(const vtkClientServerStream* css)
     vtkErrorMacro("Error parsing File extension.");
     return;
   }
+  if (!css->GetArgument(0, 8, &this->TotalNumberOfContents))
+  {
+    vtkErrorMacro("Error parsing TotalNumberOfContents.");
+    return;
+  }
   for (int cc = 0; cc < num_of_children; cc++)
   {
     vtkPVFileInformation* child = vtkPVFileInformation::New();
     vtkClientServerStream childStream;
-    if (!css->GetArgument(0, 8 + cc, &childStream))
+    if (!css->GetArgument(0, 9 + cc, &childStream))
     {
       vtkErrorMacro("Error parsing child #" << cc);
       return;
@@ -1228,6 +1408,7 @@ void vtkPVFileInformation::Initialize()
   this->SetExtension(nullptr);
   this->Size = 0;
   this->GroupFileSequences = true;
+  this->TotalNumberOfContents = 0;
 #ifdef _WIN32
   this->ModificationTime = _time64(nullptr);
 #else
@@ -1305,6 +1486,7 @@ void vtkPVFileInformation::PrintSelf(ostream& os, vtkIndent indent)
   }
   os << indent << "Hidden: " << this->Hidden << endl;
   os << indent << "FastFileTypeDetection: " << this->FastFileTypeDetection << endl;
+  os << indent << "TotalNumberOfContents: " << this->TotalNumberOfContents << endl;
 
   for (int cc = 0; cc < this->Contents->GetNumberOfItems(); cc++)
   {
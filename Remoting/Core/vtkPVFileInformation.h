@@ -151,8 +151,22 @@ public:
   vtkGetMacro(ModificationTime, time_t);
   ///@}
 
+  ///@{
+  /**
+   * Get the number of entries in the directory listing before
+   * vtkPVFileInformationHelper::ListingOffset and ListingLimit were applied.
+   * This is 0 when no directory listing was fetched.
+   */
+  vtkGetMacro(TotalNumberOfContents, int);
+  ///@}
+
   /**
-   * Fetch the directory listing to be able to use GetSize or GetContents with directories
+   * Fetch the directory listing to be able to use GetSize or GetContents with directories.
+   * Directories come first, and entries are then sorted by case-insensitive
+   * name. When file details are not requested, the listing is cached for a
+   * few directories and reused as long as the modification time of the
+   * directory does not change, so that browsing back and forth through huge
+   * directories does not list them again.
    */
   void FetchDirectoryListing();
 
@@ -184,13 +198,16 @@ protected:
   vtkCollection* Contents;
   vtkFileSequenceParser* SequenceParser;
 
-  char* Name;              // Name of this file/directory.
-  char* FullPath;          // Full path for this file/directory.
-  int Type;                // Type i.e. File/Directory/FileGroup.
-  bool Hidden;             // If file/directory is hidden
-  char* Extension;         // File extension
-  long long Size;          // File size
-  time_t ModificationTime; // File modification time
+  char* Name;                // Name of this file/directory.
+  char* FullPath;            // Full path for this file/directory.
+  int Type;                  // Type i.e. File/Directory/FileGroup.
+  bool Hidden;               // If file/directory is hidden
+  char* Extension;           // File extension
+  long long Size;            // File size
+  time_t ModificationTime;   // File modification time
+  int TotalNumberOfContents; // Number of entries in the listing before paging
+  int ListingOffset;         // First entry of the listing to return
+  int ListingLimit;          // Number of entries to return, 0 for all
 
   vtkSetStringMacro(Extension);
   vtkSetStringMacro(Name);
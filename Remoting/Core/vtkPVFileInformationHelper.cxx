@@ -22,6 +22,8 @@ vtkPVFileInformationHelper::vtkPVFileInformationHelper()
   , FastFileTypeDetection(1)
   , GroupFileSequences(true)
   , ReadDetailedFileInformation(false)
+  , ListingOffset(0)
+  , ListingLimit(0)
   , PathSeparator(nullptr)
 {
   this->SetPath(".");
@@ -66,4 +68,7 @@ void vtkPVFileInformationHelper::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "PathSeparator: " << (this->PathSeparator ? this->PathSeparator : "(null)")
      << endl;
   os << indent << "FastFileTypeDetection: " << this->FastFileTypeDetection << endl;
+  os << indent << "ReadDetailedFileInformation: " << this->ReadDetailedFileInformation << endl;
+  os << indent << "ListingOffset: " << this->ListingOffset << endl;
+  os << indent << "ListingLimit: " << this->ListingLimit << endl;
 }
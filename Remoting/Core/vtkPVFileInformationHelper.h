@@ -137,6 +137,26 @@ public:
   vtkSetMacro(ReadDetailedFileInformation, bool);
   ///@}
 
+  ///@{
+  /**
+   * Get/Set the range of entries returned when listing a directory. Entries
+   * are sorted, directories first and then by case-insensitive name, and
+   * only the ones in `[ListingOffset, ListingOffset + ListingLimit)` are
+   * returned, which lets clients page through huge directories. A
+   * ListingLimit of 0 (default) returns all the entries starting at
+   * ListingOffset. vtkPVFileInformation::GetTotalNumberOfContents reports the
+   * number of entries before paging.
+   *
+   * Listings are cached on the server so that successive pages do not list
+   * the directory again, except when ReadDetailedFileInformation is on: the
+   * directory is then listed again for every page.
+   */
+  vtkGetMacro(ListingOffset, int);
+  vtkSetClampMacro(ListingOffset, int, 0, VTK_INT_MAX);
+  vtkGetMacro(ListingLimit, int);
+  vtkSetClampMacro(ListingLimit, int, 0, VTK_INT_MAX);
+  ///@}
+
 protected:
   vtkPVFileInformationHelper();
   ~vtkPVFileInformationHelper() override;
@@ -150,6 +170,8 @@ protected:
   bool ExamplesInSpecialDirectories;
 
   bool ReadDetailedFileInformation;
+  int ListingOffset;
+  int ListingLimit;
   char* PathSeparator;
   vtkSetStringMacro(PathSeparator);
 
@@ -3,9 +3,10 @@
 #include "vtkPVPluginLoader.h"
 
 #include "vtkDynamicLoader.h"
+#include "vtkMultiProcessController.h"
+#include "vtkMultiProcessStream.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
-#include "vtkPDirectory.h"
 #include "vtkPVLogger.h"
 #include "vtkPVPlugin.h"
 #include "vtkPVPluginTracker.h"
@@ -14,6 +15,7 @@
 #include "vtkPVXMLParser.h"
 #include "vtkProcessModule.h"
 
+#include "vtksys/Directory.hxx"
 #include "vtksys/FStream.hxx"
 #include "vtksys/SystemTools.hxx"
 
@@ -192,6 +194,117 @@ private:
   static vtkPVPluginLoaderCleaner* LibCleaner;
 };
 vtkPVPluginLoaderCleaner* vtkPVPluginLoaderCleaner::LibCleaner = nullptr;
+
+// Appends the plugin files found in `path` to `files`.
+void LocatePluginsInPath(const std::string& path, std::vector<std::string>& files)
+{
+  vtkVLogF(PARAVIEW_LOG_PLUGIN_VERBOSITY(), "Loading plugins in Path: %s", path.c_str());
+
+  vtksys::Directory dir;
+  if (!dir.Load(path))
+  {
+    vtkVLogF(PARAVIEW_LOG_PLUGIN_VERBOSITY(), "Invalid directory: %s", path.c_str());
+    return;
+  }
+
+#ifdef _WIN32
+  const char* compiled_extension = ".dll";
+#else
+  const char* compiled_extension = ".so";
+#endif
+
+  for (unsigned long cc = 0; cc < dir.GetNumberOfFiles(); cc++)
+  {
+    const std::string file = dir.GetFile(cc);
+    if (file == "." || file == "..")
+    {
+      continue;
+    }
+    std::string rel_path;
+    bool has_valid_extension;
+    bool assume_exists = false;
+
+    // If we have a directory, search it for a plugin of the same name.
+    if (vtksys::SystemTools::FileIsDirectory(path + '/' + file))
+    {
+      rel_path = file;
+      rel_path += '/';
+      rel_path += file;
+      rel_path += compiled_extension;
+      has_valid_extension = true;
+    }
+    else
+    {
+      // We have a file, check to see if its extension is acceptable.
+      rel_path = file;
+      std::string ext = vtksys::SystemTools::GetFilenameLastExtension(rel_path);
+      has_valid_extension =
+        (ext == compiled_extension || ext == ".xml" || ext == ".sl" || ext == ".py");
+      assume_exists = true;
+    }
+
+    // No extension, not a plugin.
+    if (!has_valid_extension)
+    {
+      continue;
+    }
+
+    // Calculate the full path to the plugin.
+    std::string full_file = dir.GetPath();
+    full_file += '/';
+    full_file += rel_path;
+
+    // Check if it exists and is a file.
+    if (!assume_exists && !vtksys::SystemTools::FileExists(full_file, true))
+    {
+      continue;
+    }
+    files.push_back(full_file);
+  }
+}
+
+// Returns the plugin files found in `paths`. In parallel, the file system is
+// only queried by the first rank of the global controller, which broadcasts
+// the files it found to the other ranks, so that large jobs do not query the
+// same directories from every rank.
+std::vector<std::string> LocatePlugins(const std::vector<std::string>& paths)
+{
+  std::vector<std::string> files;
+  vtkMultiProcessController* controller = vtkMultiProcessController::GetGlobalController();
+  const bool parallel = controller && controller->GetNumberOfProcesses() > 1;
+  if (!parallel || controller->GetLocalProcessId() == 0)
+  {
+    for (const auto& path : paths)
+    {
+      LocatePluginsInPath(path, files);
+    }
+  }
+
+  if (parallel)
+  {
+    vtkMultiProcessStream stream;
+    if (controller->GetLocalProcessId() == 0)
+    {
+      stream << static_cast<unsigned int>(files.size());
+      for (const auto& file : files)
+      {
+        stream << file;
+      }
+    }
+    controller->Broadcast(stream, 0);
+    if (controller->GetLocalProcessId() > 0)
+    {
+      unsigned int count = 0;
+      stream >> count;
+      files.resize(count);
+      for (auto& file : files)
+      {
+        stream >> file;
+      }
+    }
+  }
+  return files;
+}
 };
 
 //=============================================================================
@@ -289,14 +402,19 @@ void vtkPVPluginLoader::LoadPluginsFromPluginSearchPath()
 
   std::vector<std::string> paths;
   vtksys::SystemTools::Split(this->SearchPaths, paths, ENV_PATH_SEP);
+  std::vector<std::string> allpaths;
   for (size_t cc = 0; cc < paths.size(); cc++)
   {
     std::vector<std::string> subpaths;
     vtksys::SystemTools::Split(paths[cc], subpaths, ';');
-    for (size_t scc = 0; scc < subpaths.size(); scc++)
-    {
-      this->LoadPluginsFromPath(subpaths[scc].c_str());
-    }
+    allpaths.insert(allpaths.end(), subpaths.begin(), subpaths.end());
+  }
+
+  // Locate all plugins at once, so that they are broadcast only once in
+  // parallel.
+  for (const auto& file : LocatePlugins(allpaths))
+  {
+    this->LoadPluginSilently(file.c_str());
   }
 #else
   vtkVLogF(PARAVIEW_LOG_PLUGIN_VERBOSITY(), "Static build. Skipping PLUGIN_PATHS.");
@@ -331,66 +449,14 @@ void vtkPVPluginLoader::LoadPluginsFromPluginConfigFile()
 //-----------------------------------------------------------------------------
 void vtkPVPluginLoader::LoadPluginsFromPath(const char* path)
 {
-  vtkVLogIfF(PARAVIEW_LOG_PLUGIN_VERBOSITY(), path != nullptr, "Loading plugins in Path: %s", path);
-
-  vtkNew<vtkPDirectory> dir;
-  if (dir->Load(path) == false)
+  std::vector<std::string> paths;
+  if (path)
   {
-    vtkVLogIfF(PARAVIEW_LOG_PLUGIN_VERBOSITY(), path != nullptr, "Invalid directory: %s", path);
-    return;
+    paths.emplace_back(path);
   }
-
-#ifdef _WIN32
-  const char* compiled_extension = ".dll";
-#else
-  const char* compiled_extension = ".so";
-#endif
-
-  for (vtkIdType cc = 0; cc < dir->GetNumberOfFiles(); cc++)
+  for (const auto& file : LocatePlugins(paths))
   {
-    const char* file = dir->GetFile(cc);
-    std::string rel_path;
-    bool has_valid_extension;
-    bool assume_exists = false;
-
-    // If we have a directory, search it for a plugin of the same name.
-    if (dir->FileIsDirectory(file))
-    {
-      rel_path = file;
-      rel_path += '/';
-      rel_path += file;
-      rel_path += compiled_extension;
-      has_valid_extension = true;
-    }
-    else
-    {
-      // We have a file, check to see if its extension is acceptable.
-      rel_path = file;
-      std::string ext = vtksys::SystemTools::GetFilenameLastExtension(rel_path);
-      has_valid_extension =
-        (ext == compiled_extension || ext == ".xml" || ext == ".sl" || ext == ".py");
-      assume_exists = true;
-    }
-
-    // No extension, not a plugin.
-    if (!has_valid_extension)
-    {
-      continue;
-    }
-
-    // Calculate the full path to the plugin.
-    std::string full_file = dir->GetPath();
-    full_file += '/';
-    full_file += rel_path;
-
-    // Check if it exists and is a file.
-    if (!assume_exists && !vtksys::SystemTools::FileExists(full_file, true))
-    {
-      continue;
-    }
-
-    // Load the plugin.
-    this->LoadPluginSilently(full_file.c_str());
+    this->LoadPluginSilently(file.c_str());
   }
 }
 
@@ -61,6 +61,15 @@ public:
    */
   virtual vtkMultiProcessController* GetController(ServerFlags processType);
 
+  /**
+   * Sends the messages the session holds back, if any, e.g. the state pushed
+   * while a push transaction is open. Code that communicates with the servers
+   * directly through the controllers returned by GetController() must call
+   * this first so that the servers see the messages in order.
+   * Default implementation does nothing.
+   */
+  virtual void FlushPendingMessages() {}
+
   /**
    * This is socket connection, if any to communicate between the data-server
    * and render-server nodes.
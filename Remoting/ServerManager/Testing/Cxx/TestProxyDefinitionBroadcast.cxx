@@ -0,0 +1,136 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Checks that, when the proxy definitions are broadcast, the ranks other than
+// the first one receive the definitions instead of parsing the configuration
+// xmls, that they match the parsed ones, and that the plugins found by the
+// first rank in the plugin search path are loaded by all the ranks.
+
+#include "vtkInitializationHelper.h"
+#include "vtkLogger.h"
+#include "vtkMultiProcessController.h"
+#include "vtkNew.h"
+#include "vtkPVPluginLoader.h"
+#include "vtkPVProxyDefinitionIterator.h"
+#include "vtkPVXMLElement.h"
+#include "vtkProcessModule.h"
+#include "vtkSIProxyDefinitionManager.h"
+#include "vtkSmartPointer.h"
+#include "vtkTestUtilities.h"
+
+#include <vtksys/FStream.hxx>
+#include <vtksys/SystemTools.hxx>
+
+#include <string>
+
+namespace
+{
+const char* PluginXML = R"(<ServerManagerConfiguration>
+  <ProxyGroup name="sources">
+    <SourceProxy name="BroadcastPluginSource" class="vtkSphereSource" />
+  </ProxyGroup>
+</ServerManagerConfiguration>
+)";
+
+bool SameDefinitions(vtkSIProxyDefinitionManager* parsed, vtkSIProxyDefinitionManager* received)
+{
+  int numberOfParsed = 0;
+  int numberOfReceived = 0;
+  vtkSmartPointer<vtkPVProxyDefinitionIterator> iter;
+  iter.TakeReference(received->NewIterator(vtkSIProxyDefinitionManager::CORE_DEFINITIONS));
+  for (iter->GoToFirstItem(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+  {
+    ++numberOfReceived;
+  }
+
+  iter.TakeReference(parsed->NewIterator(vtkSIProxyDefinitionManager::CORE_DEFINITIONS));
+  for (iter->GoToFirstItem(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+  {
+    ++numberOfParsed;
+    const char* group = iter->GetGroupName();
+    const char* name = iter->GetProxyName();
+    if (!iter->GetProxyDefinition()->Equals(received->GetProxyDefinition(group, name, false)))
+    {
+      vtkLogF(ERROR, "Definition of (%s, %s) differs.", group, name);
+      return false;
+    }
+    vtkPVXMLElement* collapsed = parsed->GetCollapsedProxyDefinition(group, name, nullptr, false);
+    if (!collapsed->Equals(received->GetCollapsedProxyDefinition(group, name, nullptr, false)))
+    {
+      vtkLogF(ERROR, "Collapsed definition of (%s, %s) differs.", group, name);
+      return false;
+    }
+  }
+
+  if (numberOfParsed == 0 || numberOfParsed != numberOfReceived)
+  {
+    vtkLogF(ERROR, "Expected %d definitions, got %d.", numberOfParsed, numberOfReceived);
+    return false;
+  }
+  return true;
+}
+}
+
+int TestProxyDefinitionBroadcast(int argc, char* argv[])
+{
+  vtkInitializationHelper::Initialize(argc, argv, vtkProcessModule::PROCESS_BATCH);
+  vtkMultiProcessController* controller = vtkMultiProcessController::GetGlobalController();
+  const int rank = controller->GetLocalProcessId();
+
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  const std::string pluginDirectory = std::string(tempDir) + "/TestProxyDefinitionBroadcast";
+  delete[] tempDir;
+  if (rank == 0)
+  {
+    vtksys::SystemTools::RemoveADirectory(pluginDirectory);
+    vtksys::SystemTools::MakeDirectory(pluginDirectory);
+    vtksys::ofstream file((pluginDirectory + "/BroadcastPlugin.xml").c_str());
+    file << PluginXML;
+  }
+
+  vtkSIProxyDefinitionManager::SetBroadcastDefinitions(false);
+  vtkNew<vtkSIProxyDefinitionManager> parsed;
+
+  // creating the definition manager is collective when broadcasting.
+  vtkSIProxyDefinitionManager::SetBroadcastDefinitions(true);
+  vtkNew<vtkSIProxyDefinitionManager> received;
+  vtkSIProxyDefinitionManager::SetBroadcastDefinitions(false);
+
+  int success = 1;
+  const int expectedSource =
+    rank == 0 ? vtkSIProxyDefinitionManager::PARSED_XMLS : vtkSIProxyDefinitionManager::BROADCAST;
+  if (parsed->GetCoreDefinitionsSource() != vtkSIProxyDefinitionManager::PARSED_XMLS ||
+    received->GetCoreDefinitionsSource() != expectedSource)
+  {
+    vtkLogF(ERROR, "Unexpected source of the core definitions on rank %d.", rank);
+    success = 0;
+  }
+  else if (!SameDefinitions(parsed, received))
+  {
+    success = 0;
+  }
+
+  // only the first rank looks for plugins in its search path, the other ones
+  // get a directory that does not exist.
+  vtkNew<vtkPVPluginLoader> loader;
+  const std::string searchPath = rank == 0 ? pluginDirectory : pluginDirectory + "/missing";
+  loader->LoadPluginsFromPath(searchPath.c_str());
+  if (success &&
+    (!parsed->HasDefinition("sources", "BroadcastPluginSource") ||
+      !received->HasDefinition("sources", "BroadcastPluginSource")))
+  {
+    vtkLogF(ERROR, "The plugin found by the first rank was not loaded on rank %d.", rank);
+    success = 0;
+  }
+
+  int allSuccess = 0;
+  controller->AllReduce(&success, &allSuccess, 1, vtkCommunicator::LOGICAL_AND_OP);
+  controller->Barrier();
+  if (rank == 0)
+  {
+    vtksys::SystemTools::RemoveADirectory(pluginDirectory);
+  }
+  vtkInitializationHelper::Finalize();
+  return allSuccess ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,155 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Checks that the proxy definitions loaded from a definition cache file match
+// the ones parsed from the configuration xmls, that an invalid cache file is
+// replaced, and reports the time to the first proxy when parsing the xmls,
+// when writing the cache and when loading it.
+
+#include "vtkInitializationHelper.h"
+#include "vtkNew.h"
+#include "vtkPVProxyDefinitionIterator.h"
+#include "vtkPVXMLElement.h"
+#include "vtkProcessModule.h"
+#include "vtkSIProxyDefinitionManager.h"
+#include "vtkSMProxy.h"
+#include "vtkSMSession.h"
+#include "vtkSMSessionProxyManager.h"
+#include "vtkSmartPointer.h"
+#include "vtkTestUtilities.h"
+#include "vtkTimerLog.h"
+
+#include <cstdio>
+#include <string>
+
+namespace
+{
+// Returns the time needed to create a session and its first proxy, or a
+// negative value if the proxy could not be created.
+double TimeToFirstProxy()
+{
+  vtkNew<vtkTimerLog> timer;
+  timer->StartTimer();
+  vtkNew<vtkSMSession> session;
+  vtkSmartPointer<vtkSMProxy> proxy;
+  proxy.TakeReference(
+    session->GetSessionProxyManager()->NewProxy("representations", "GeometryRepresentation"));
+  timer->StopTimer();
+  return proxy ? timer->GetElapsedTime() : -1.0;
+}
+
+bool SameDefinitions(vtkSIProxyDefinitionManager* parsed, vtkSIProxyDefinitionManager* cached)
+{
+  int numberOfParsed = 0;
+  int numberOfCached = 0;
+  vtkSmartPointer<vtkPVProxyDefinitionIterator> iter;
+  iter.TakeReference(cached->NewIterator(vtkSIProxyDefinitionManager::CORE_DEFINITIONS));
+  for (iter->GoToFirstItem(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+  {
+    ++numberOfCached;
+  }
+
+  iter.TakeReference(parsed->NewIterator(vtkSIProxyDefinitionManager::CORE_DEFINITIONS));
+  for (iter->GoToFirstItem(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+  {
+    ++numberOfParsed;
+    const char* group = iter->GetGroupName();
+    const char* name = iter->GetProxyName();
+    if (!iter->GetProxyDefinition()->Equals(cached->GetProxyDefinition(group, name, false)))
+    {
+      cerr << "Definition of (" << group << ", " << name << ") differs.\n";
+      return false;
+    }
+    vtkPVXMLElement* collapsed = parsed->GetCollapsedProxyDefinition(group, name, nullptr, false);
+    if (!collapsed->Equals(cached->GetCollapsedProxyDefinition(group, name, nullptr, false)))
+    {
+      cerr << "Collapsed definition of (" << group << ", " << name << ") differs.\n";
+      return false;
+    }
+  }
+
+  if (numberOfParsed == 0 || numberOfParsed != numberOfCached)
+  {
+    cerr << "Expected " << numberOfParsed << " definitions, got " << numberOfCached << ".\n";
+    return false;
+  }
+  return true;
+}
+}
+
+int TestProxyDefinitionCache(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  if (!tempDir)
+  {
+    cerr << "Could not determine temporary directory.\n";
+    return EXIT_FAILURE;
+  }
+  const std::string cacheFileName = std::string(tempDir) + "/TestProxyDefinitionCache.pvpdc";
+  delete[] tempDir;
+  std::remove(cacheFileName.c_str());
+
+  vtkInitializationHelper::Initialize(argv[0], vtkProcessModule::PROCESS_CLIENT);
+
+  vtkSIProxyDefinitionManager::SetDefinitionCacheFileName(std::string());
+  const double parseTime = TimeToFirstProxy();
+  vtkNew<vtkSIProxyDefinitionManager> parsed;
+
+  vtkSIProxyDefinitionManager::SetDefinitionCacheFileName(cacheFileName);
+  const double writeTime = TimeToFirstProxy();
+  FILE* file = fopen(cacheFileName.c_str(), "rb");
+  const bool written = file != nullptr;
+  if (file)
+  {
+    fclose(file);
+  }
+  const double loadTime = TimeToFirstProxy();
+  vtkNew<vtkSIProxyDefinitionManager> cached;
+
+  // an invalid cache file is ignored and written again.
+  file = fopen(cacheFileName.c_str(), "wb");
+  if (file)
+  {
+    fputs("invalid", file);
+    fclose(file);
+  }
+  vtkNew<vtkSIProxyDefinitionManager> invalid;
+  vtkNew<vtkSIProxyDefinitionManager> rewritten;
+
+  int status = EXIT_SUCCESS;
+  if (parseTime < 0 || writeTime < 0 || loadTime < 0)
+  {
+    cerr << "Failed to create the first proxy.\n";
+    status = EXIT_FAILURE;
+  }
+  else if (!written)
+  {
+    cerr << "Failed to write the definition cache '" << cacheFileName << "'.\n";
+    status = EXIT_FAILURE;
+  }
+  else if (parsed->GetCoreDefinitionsSource() != vtkSIProxyDefinitionManager::PARSED_XMLS ||
+    cached->GetCoreDefinitionsSource() != vtkSIProxyDefinitionManager::DEFINITION_CACHE)
+  {
+    cerr << "The definition cache was not used.\n";
+    status = EXIT_FAILURE;
+  }
+  else if (invalid->GetCoreDefinitionsSource() != vtkSIProxyDefinitionManager::PARSED_XMLS ||
+    rewritten->GetCoreDefinitionsSource() != vtkSIProxyDefinitionManager::DEFINITION_CACHE)
+  {
+    cerr << "The invalid definition cache was not replaced.\n";
+    status = EXIT_FAILURE;
+  }
+  else if (!SameDefinitions(parsed, cached) || !SameDefinitions(parsed, rewritten))
+  {
+    status = EXIT_FAILURE;
+  }
+
+  printf("Time to first proxy, parsing xmls (s):   %f\n", parseTime);
+  printf("Time to first proxy, writing cache (s):  %f\n", writeTime);
+  printf("Time to first proxy, loading cache (s):  %f\n", loadTime);
+
+  vtkSIProxyDefinitionManager::SetDefinitionCacheFileName(std::string());
+  vtkInitializationHelper::Finalize();
+  return status;
+}
@@ -30,6 +30,7 @@
 #include <set>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #define LOG(x)                                                                                     \
   if (this->LogStream)                                                                             \
@@ -857,106 +858,70 @@ void vtkPVSessionCore::GatherInformationStatelliteCallback()
 }
 
 //----------------------------------------------------------------------------
-#define SafeDeleteArray(array_ptr)                                                                 \
-  {                                                                                                \
-    if ((array_ptr) != nullptr)                                                                    \
-    {                                                                                              \
-      delete[](array_ptr);                                                                         \
-      (array_ptr) = nullptr;                                                                       \
-    }                                                                                              \
-  }
-
 bool vtkPVSessionCore::CollectInformation(vtkPVInformation* info)
 {
-  // Sanity checks
-  assert("pre: nullptr PV information!" && (info != nullptr));
-
-  // STEP 0: temporary variables
-  int rank = this->ParallelController->GetLocalProcessId();
-  int nranks = this->ParallelController->GetNumberOfProcesses();
-
+  auto controller = this->ParallelController;
+  const int rank = controller->GetLocalProcessId();
+  const int nranks = controller->GetNumberOfProcesses();
   if (nranks == 1)
   {
     /* short-circuit */
     return true;
   }
 
-  vtkIdType* rcvcounts = nullptr;     /* significant only at rank 0 */
-  vtkIdType* offSet = nullptr;        /* significant only at rank 0 */
-  int rbufsize = 0;                   /* significant only at rank 0 */
-  unsigned char* rcvbuffer = nullptr; /* significant only at rank 0 */
-
-  // STEP 1: Initialize data-structures at rank 0
-  if (rank == 0)
-  {
-    rcvcounts = new vtkIdType[nranks];
-    offSet = new vtkIdType[nranks];
-  } // END if rank == 0
-
-  // STEP 2: Serialize the vtkPVInformation object
-  vtkClientServerStream stream;
-  info->CopyToStream(&stream);
-
-  const unsigned char* data;
-  size_t length;
-
-  // Get pointer to the raw stream data. Note, this is a shallow copy, no
-  // need to delete the data.
-  stream.GetData(&data, &length);
-  vtkIdType local_length = static_cast<vtkIdType>(length);
-
-  // STEP 3: Get number of bytes that each process will send
-  this->ParallelController->Gather(&local_length, rcvcounts, 1, 0);
-
-  // STEP 4: Allocate temporary arrays at rank 0
-  if (rank == 0)
+  // Reduce the information using a binomial tree. At a given step, a rank that
+  // is a multiple of 2*step receives the information reduced over the ranks
+  // [rank + step, rank + 2*step) and adds it to its own. Thus the information is
+  // added in rank order, as before, but the reduction takes log2(nranks) steps
+  // and rank 0 only deserializes log2(nranks) messages instead of one message
+  // per rank.
+  std::vector<unsigned char> buffer;
+  for (int step = 1; step < nranks; step *= 2)
   {
-    // STEP 4.1: Calculate rcvbuffer size & allocate rcvbuffer
-    rbufsize = rcvcounts[0];
-    for (int i = 1; i < nranks; ++i)
+    if (rank % (2 * step) != 0)
     {
-      rbufsize += rcvcounts[i];
+      // send the information reduced so far to the parent, and we're done.
+      vtkClientServerStream stream;
+      if (info)
+      {
+        info->CopyToStream(&stream);
+      }
+      const unsigned char* data;
+      size_t length;
+      stream.GetData(&data, &length);
+
+      // an empty message lets the parent know that the gather failed here,
+      // otherwise root will hang.
+      vtkIdType local_length = info ? static_cast<vtkIdType>(length) : 0;
+      controller->Send(&local_length, 1, rank - step, ROOT_SATELLITE_INFO_TAG);
+      if (local_length > 0)
+      {
+        controller->Send(data, local_length, rank - step, ROOT_SATELLITE_INFO_TAG);
+      }
+      break;
     }
-    rcvbuffer = new unsigned char[rbufsize];
 
-    // STEP 4.2: populate offset array
-    offSet[0] = 0;
-    for (int i = 1; i < nranks; ++i)
+    const int child = rank + step;
+    if (child < nranks)
     {
-      offSet[i] = offSet[i - 1] + rcvcounts[i - 1];
+      vtkIdType length = 0;
+      controller->Receive(&length, 1, child, ROOT_SATELLITE_INFO_TAG);
+      if (length > 0)
+      {
+        buffer.resize(static_cast<size_t>(length));
+        controller->Receive(buffer.data(), length, child, ROOT_SATELLITE_INFO_TAG);
+        if (info)
+        {
+          vtkClientServerStream stream;
+          stream.SetData(buffer.data(), buffer.size());
+          vtkSmartPointer<vtkPVInformation> tempInfo;
+          tempInfo.TakeReference(info->NewInstance());
+          tempInfo->CopyFromStream(&stream);
+          info->AddInformation(tempInfo);
+        }
+      }
     }
-  } // END if rank==0
-
-  // STEP 5: GatherV all data from satellites
-  this->ParallelController->GatherV(data, rcvbuffer, local_length, rcvcounts, offSet, 0);
-
-  // STEP 6: Deserialize data from other ranks at rank 0 and add them to
-  // the information object associated with rank 0.
-  if (rank == 0)
-  {
-    vtkClientServerStream rcvStream;
-    for (int i = 1; i < nranks; ++i)
-    {
-      rcvStream.SetData(&rcvbuffer[offSet[i]], rcvcounts[i]);
-      vtkPVInformation* tempInfo = info->NewInstance();
-      tempInfo->CopyFromStream(&rcvStream);
-      info->AddInformation(tempInfo);
-      tempInfo->Delete();
-    } // END for all remote ranks
-  }   // END if rank == 0
-
-  // STEP 7: De-allocate temporary arrays at rank 0
-  SafeDeleteArray(rcvcounts);
-  SafeDeleteArray(offSet);
-  SafeDeleteArray(rcvbuffer);
-
-  // Sanity checks -- ensure we return all dynamically allocated memory
-  assert("post: rcvcounts should be nullptr" && (rcvcounts == nullptr));
-  assert("post: offSet should be nullptr" && (offSet == nullptr));
-  assert("post: rcvbuffer should be nullptr" && (rcvbuffer == nullptr));
-
-  // STEP 8: Barrier synchronization
-  this->ParallelController->Barrier();
+  }
   return true;
 }
 
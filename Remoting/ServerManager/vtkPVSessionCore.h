@@ -199,7 +199,8 @@ protected:
   bool GatherInformationInternal(vtkPVInformation* information, vtkTypeUInt32 globalid);
 
   /**
-   * Gather information across MPI satellites.
+   * Gather information across MPI satellites. The information is reduced
+   * to the root node using a binomial tree i.e. in log2(number of ranks) steps.
    */
   bool CollectInformation(vtkPVInformation*);
 
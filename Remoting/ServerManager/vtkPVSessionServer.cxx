@@ -513,22 +513,22 @@ void vtkPVSessionServer::OnClientServerMessageRMI(void* message, int message_len
     {
       std::string string;
       stream >> string;
-      vtkSMMessage msg;
-      msg.ParseFromString(string);
-
-      //      cout << "=================================" << endl;
-      //      msg.PrintDebugString();
-      //      cout << "=================================" << endl;
+      this->PushStateFromClient(string);
+    }
+    break;
 
-      // Do we skip the processing ?
-      if (!this->Internal->StoreShareOnly(&msg))
+    case vtkPVSessionServer::PUSH_BATCH:
+    {
+      // messages accumulated by a push transaction on the client, to be
+      // applied in order.
+      int count;
+      stream >> count;
+      for (int cc = 0; cc < count; ++cc)
       {
-        this->PushState(&msg);
+        std::string string;
+        stream >> string;
+        this->PushStateFromClient(string);
       }
-
-      // Notify when ProxyManager state has changed
-      // or any other state change
-      this->NotifyOtherClients(&msg);
     }
     break;
 
@@ -598,9 +598,40 @@ void vtkPVSessionServer::OnClientServerMessageRMI(void* message, int message_len
       this->GatherInformationInternal(location, classname.c_str(), globalid, stream);
     }
     break;
+
+    case vtkPVSessionServer::GATHER_INFORMATION_ASYNC:
+    {
+      std::string classname;
+      vtkTypeUInt32 requestId, location, globalid;
+      stream >> requestId >> location >> classname >> globalid;
+      this->GatherInformationAsyncInternal(
+        requestId, location, classname.c_str(), globalid, stream);
+    }
+    break;
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkPVSessionServer::PushStateFromClient(const std::string& serialized)
+{
+  vtkSMMessage msg;
+  msg.ParseFromString(serialized);
+
+  //      cout << "=================================" << endl;
+  //      msg.PrintDebugString();
+  //      cout << "=================================" << endl;
+
+  // Do we skip the processing ?
+  if (!this->Internal->StoreShareOnly(&msg))
+  {
+    this->PushState(&msg);
+  }
+
+  // Notify when ProxyManager state has changed
+  // or any other state change
+  this->NotifyOtherClients(&msg);
+}
+
 //----------------------------------------------------------------------------
 void vtkPVSessionServer::SendLastResultToClient()
 {
@@ -655,6 +686,41 @@ void vtkPVSessionServer::GatherInformationInternal(vtkTypeUInt32 location, const
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkPVSessionServer::GatherInformationAsyncInternal(vtkTypeUInt32 requestId,
+  vtkTypeUInt32 location, const char* classname, vtkTypeUInt32 globalid,
+  vtkMultiProcessStream& stream)
+{
+  vtkClientServerStream reply;
+  reply << vtkClientServerStream::Reply << requestId;
+
+  vtkSmartPointer<vtkObjectBase> o;
+  o.TakeReference(vtkClientServerStreamInstantiator::CreateInstance(classname));
+  vtkPVInformation* info = vtkPVInformation::SafeDownCast(o);
+  if (info)
+  {
+    info->CopyParametersFromStream(stream);
+    this->GatherInformation(location, info, globalid);
+
+    vtkClientServerStream css;
+    info->CopyToStream(&css);
+    reply << css;
+  }
+  else
+  {
+    // the reply without information lets the client know that gather failed.
+    vtkErrorMacro(
+      "Could not create information object: `" << (classname ? classname : "(nullptr)") << "`.");
+  }
+  reply << vtkClientServerStream::End;
+
+  const unsigned char* data;
+  size_t length;
+  reply.GetData(&data, &length);
+  this->Internal->GetActiveController()->TriggerRMI(1, const_cast<unsigned char*>(data),
+    static_cast<int>(length), vtkPVSessionServer::GATHER_INFORMATION_REPLY_RMI);
+}
+
 //----------------------------------------------------------------------------
 void vtkPVSessionServer::OnCloseSessionRMI()
 {
@@ -16,6 +16,8 @@
 #include "vtkPVSessionBase.h"
 #include "vtkRemotingServerManagerModule.h" //needed for exports
 
+#include <string> // for std::string
+
 class vtkMultiProcessController;
 class vtkMultiProcessStream;
 
@@ -71,13 +73,16 @@ public:
     REGISTER_SI = 16,
     UNREGISTER_SI = 17,
     LAST_RESULT = 18,
+    PUSH_BATCH = 19,
+    GATHER_INFORMATION_ASYNC = 20,
     SERVER_NOTIFICATION_MESSAGE_RMI = 55624,
     CLIENT_SERVER_MESSAGE_RMI = 55625,
     CLOSE_SESSION = 55626,
     REPLY_GATHER_INFORMATION_TAG = 55627,
     REPLY_PULL = 55628,
     REPLY_LAST_RESULT = 55629,
-    EXECUTE_STREAM_TAG = 55630
+    EXECUTE_STREAM_TAG = 55630,
+    GATHER_INFORMATION_REPLY_RMI = 55631
   };
 
   ///@{
@@ -134,11 +139,24 @@ protected:
   void GatherInformationInternal(
     vtkTypeUInt32 location, const char* classname, vtkTypeUInt32 globalid, vtkMultiProcessStream&);
 
+  /**
+   * Called when client triggers GatherInformationAsync(). The information is
+   * sent back to the client using the GATHER_INFORMATION_REPLY_RMI, tagged
+   * with the \c requestId, rather than as a reply the client waits for.
+   */
+  void GatherInformationAsyncInternal(vtkTypeUInt32 requestId, vtkTypeUInt32 location,
+    const char* classname, vtkTypeUInt32 globalid, vtkMultiProcessStream&);
+
   /**
    * Sends the last result to client.
    */
   void SendLastResultToClient();
 
+  /**
+   * Applies a state message pushed by the client.
+   */
+  void PushStateFromClient(const std::string& serialized);
+
   vtkMPIMToNSocketConnection* MPIMToNSocketConnection;
 
   bool MultipleConnection;
@@ -5,13 +5,16 @@
 #include "vtkCollection.h"
 #include "vtkCollectionIterator.h"
 #include "vtkCommand.h"
+#include "vtkMultiProcessController.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkPVLogger.h"
 #include "vtkPVPlugin.h"
 #include "vtkPVPluginTracker.h"
 #include "vtkPVProxyDefinitionIterator.h"
 #include "vtkPVServerManagerPluginInterface.h"
 #include "vtkPVSession.h"
+#include "vtkPVVersion.h"
 #include "vtkPVXMLElement.h"
 #include "vtkPVXMLParser.h"
 #include "vtkProcessModule.h"
@@ -22,13 +25,24 @@
 #include "vtkTimerLog.h"
 
 #include <cassert>
+#include <cstring>
 #include <map>
 #include <set>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include <vtksys/FStream.hxx>
+#include <vtksys/MD5.h>
 #include <vtksys/RegularExpression.hxx>
+#include <vtksys/SystemTools.hxx>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 //****************************************************************************/
 //                    Internal Classes and typedefs
@@ -404,6 +418,186 @@ private:
   bool InvalidCustomIterator;
 };
 
+//****************************************************************************/
+//                    Proxy definition cache
+//****************************************************************************/
+namespace
+{
+// Serialized core definitions, as stored in cache files and broadcast to other
+// ranks, start with this signature, the version of the format, a byte order
+// mark and the key of the core xmls they were produced from. It is followed by
+// the core definitions and the collapsed definitions, each written as a count
+// followed by (group name, proxy name, vtkPVXMLElement::WriteBinary).
+constexpr char DefinitionCacheMagic[8] = { 'v', 't', 'k', 'P', 'V', 'P', 'D', 'C' };
+constexpr vtkTypeUInt32 DefinitionCacheVersion = 1;
+constexpr vtkTypeUInt32 DefinitionCacheByteOrderMark = 0x01020304;
+
+//----------------------------------------------------------------------------
+std::string& DefinitionCacheFileName()
+{
+  static std::string fileName = []() {
+    const char* env = vtksys::SystemTools::GetEnv("PV_PROXY_DEFINITION_CACHE");
+    return std::string(env ? env : "");
+  }();
+  return fileName;
+}
+
+//----------------------------------------------------------------------------
+bool& BroadcastDefinitions()
+{
+  static bool broadcast = vtksys::SystemTools::GetEnv("PV_PROXY_DEFINITION_BROADCAST") != nullptr;
+  return broadcast;
+}
+
+//----------------------------------------------------------------------------
+// Identifies the definitions resulting from `xmls` in this build.
+std::string ComputeDefinitionCacheKey(const std::vector<std::string>& xmls)
+{
+  std::ostringstream prefix;
+  prefix << PARAVIEW_VERSION_FULL << ";" << DefinitionCacheVersion << ";" << sizeof(void*) << ";"
+         << xmls.size();
+
+  vtksysMD5* md5 = vtksysMD5_New();
+  vtksysMD5_Initialize(md5);
+  const std::string prefixStr = prefix.str();
+  vtksysMD5_Append(md5, reinterpret_cast<const unsigned char*>(prefixStr.c_str()),
+    static_cast<int>(prefixStr.size()));
+  for (const auto& xml : xmls)
+  {
+    const std::string length = ";" + std::to_string(xml.size()) + ";";
+    vtksysMD5_Append(
+      md5, reinterpret_cast<const unsigned char*>(length.c_str()), static_cast<int>(length.size()));
+    vtksysMD5_Append(
+      md5, reinterpret_cast<const unsigned char*>(xml.c_str()), static_cast<int>(xml.size()));
+  }
+  char hex[33];
+  vtksysMD5_FinalizeHex(md5, hex);
+  vtksysMD5_Delete(md5);
+  hex[32] = '\0';
+  return hex;
+}
+
+//----------------------------------------------------------------------------
+void AppendUInt32(std::string& buffer, vtkTypeUInt32 value)
+{
+  buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+//----------------------------------------------------------------------------
+void AppendString(std::string& buffer, const std::string& str)
+{
+  AppendUInt32(buffer, static_cast<vtkTypeUInt32>(str.size()));
+  buffer.append(str);
+}
+
+//----------------------------------------------------------------------------
+bool ReadUInt32(const char*& cursor, const char* end, vtkTypeUInt32& value)
+{
+  if (static_cast<size_t>(end - cursor) < sizeof(value))
+  {
+    return false;
+  }
+  memcpy(&value, cursor, sizeof(value));
+  cursor += sizeof(value);
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool ReadString(const char*& cursor, const char* end, std::string& str)
+{
+  vtkTypeUInt32 size;
+  if (!ReadUInt32(cursor, end, size) || static_cast<size_t>(end - cursor) < size)
+  {
+    return false;
+  }
+  str.assign(cursor, size);
+  cursor += size;
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool ReadDefinitions(const char*& cursor, const char* end, StrToStrToXmlMap& definitions)
+{
+  vtkTypeUInt32 count;
+  if (!ReadUInt32(cursor, end, count))
+  {
+    return false;
+  }
+  std::string groupName;
+  std::string proxyName;
+  for (vtkTypeUInt32 cc = 0; cc < count; ++cc)
+  {
+    vtkNew<vtkPVXMLElement> element;
+    if (!ReadString(cursor, end, groupName) || !ReadString(cursor, end, proxyName) ||
+      !element->ReadBinary(cursor, end))
+    {
+      return false;
+    }
+    definitions[groupName][proxyName] = element.GetPointer();
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+// The content of a cache file, memory mapped when possible and read otherwise.
+class vtkDefinitionCacheBuffer
+{
+public:
+  vtkDefinitionCacheBuffer(const std::string& fileName)
+  {
+    const auto size = static_cast<size_t>(vtksys::SystemTools::FileLength(fileName));
+    if (size == 0)
+    {
+      return;
+    }
+#if !defined(_WIN32)
+    int fd = open(fileName.c_str(), O_RDONLY);
+    if (fd >= 0)
+    {
+      void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+      close(fd);
+      if (data != MAP_FAILED)
+      {
+        this->Data = static_cast<const char*>(data);
+        this->Size = size;
+        this->Mapped = true;
+        return;
+      }
+    }
+#endif
+    vtksys::ifstream file(fileName.c_str(), ios::in | ios::binary);
+    this->Copy.resize(size);
+    if (file.read(this->Copy.data(), size))
+    {
+      this->Data = this->Copy.data();
+      this->Size = size;
+    }
+  }
+
+  ~vtkDefinitionCacheBuffer()
+  {
+#if !defined(_WIN32)
+    if (this->Mapped)
+    {
+      munmap(const_cast<char*>(this->Data), this->Size);
+    }
+#endif
+  }
+
+  const char* GetBegin() const { return this->Data; }
+  const char* GetEnd() const { return this->Data + this->Size; }
+
+private:
+  vtkDefinitionCacheBuffer(const vtkDefinitionCacheBuffer&) = delete;
+  void operator=(const vtkDefinitionCacheBuffer&) = delete;
+
+  const char* Data = nullptr;
+  size_t Size = 0;
+  bool Mapped = false;
+  std::vector<char> Copy;
+};
+}
+
 //****************************************************************************
 vtkStandardNewMacro(vtkSIProxyDefinitionManager);
 vtkStandardNewMacro(vtkInternalDefinitionIterator);
@@ -413,6 +607,7 @@ vtkSIProxyDefinitionManager::vtkSIProxyDefinitionManager()
 {
   this->Internals = new vtkInternals;
   this->InternalsFlatten = new vtkInternals;
+  this->CoreDefinitionsSource = PARSED_XMLS;
 
   vtkPVPluginTracker* tracker = vtkPVPluginTracker::GetInstance();
 
@@ -815,6 +1010,12 @@ bool vtkSIProxyDefinitionManager::LoadConfigurationXML(vtkPVXMLElement* root, bo
 void vtkSIProxyDefinitionManager::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent
+     << "DefinitionCacheFileName: " << vtkSIProxyDefinitionManager::GetDefinitionCacheFileName()
+     << endl;
+  os << indent << "BroadcastDefinitions: " << vtkSIProxyDefinitionManager::GetBroadcastDefinitions()
+     << endl;
+  os << indent << "CoreDefinitionsSource: " << this->CoreDefinitionsSource << endl;
 }
 //---------------------------------------------------------------------------
 // vtkSIProxyDefinitionManager::ALL_DEFINITIONS    = 0
@@ -963,8 +1164,15 @@ vtkPVXMLElement* vtkSIProxyDefinitionManager::GetCollapsedProxyDefinition(
 }
 //---------------------------------------------------------------------------
 void vtkSIProxyDefinitionManager::MergeProxyDefinition(
-  vtkPVXMLElement* element, vtkPVXMLElement* elementToFill)
+  vtkPVXMLElement* definition, vtkPVXMLElement* elementToFill)
 {
+  // Overriding elements are moved to elementToFill below. Move them from a
+  // copy so that the registered definition is left untouched: otherwise,
+  // collapsing it again (e.g. after a plugin is loaded) or collapsing another
+  // definition derived from it would lose those overrides.
+  vtkNew<vtkPVXMLElement> element;
+  definition->CopyTo(element);
+
   // Meta-data of elementToFill
   std::map<std::string, vtkSmartPointer<vtkPVXMLElement>> subProxyToFill;
   std::map<std::string, vtkSmartPointer<vtkPVXMLElement>> propertiesToFill;
@@ -973,7 +1181,7 @@ void vtkSIProxyDefinitionManager::MergeProxyDefinition(
   // Meta-data of element that should be merged into the other
   std::map<std::string, vtkSmartPointer<vtkPVXMLElement>> subProxySrc;
   std::map<std::string, vtkSmartPointer<vtkPVXMLElement>> propertiesSrc;
-  vtkInternals::ExtractMetaInformation(element, subProxySrc, propertiesSrc);
+  vtkInternals::ExtractMetaInformation(element.GetPointer(), subProxySrc, propertiesSrc);
 
   // Look for conflicting sub-proxy name and remove their definition if override
   std::map<std::string, vtkSmartPointer<vtkPVXMLElement>>::iterator mapIter;
@@ -996,9 +1204,9 @@ void vtkSIProxyDefinitionManager::MergeProxyDefinition(
         // Replace the overriden sub proxy definition by the new one
         vtkPVXMLElement* subProxyDefToRemove = subProxyToFill[name].GetPointer();
         vtkPVXMLElement* overridingProxyDef = subProxySrc[name].GetPointer();
+        overridingProxyDef->GetParent()->RemoveNestedElement(overridingProxyDef);
         subProxyDefToRemove->GetParent()->ReplaceNestedElement(
           subProxyDefToRemove, overridingProxyDef);
-        overridingProxyDef->GetParent()->RemoveNestedElement(overridingProxyDef);
       }
     }
     // Move to next
@@ -1014,8 +1222,9 @@ void vtkSIProxyDefinitionManager::MergeProxyDefinition(
     {
       if (!propertiesSrc[name]->GetAttribute("override"))
       {
+        vtkPVXMLElement* grandParent = propertiesSrc[name]->GetParent()->GetParent();
         vtkPVXMLElement* parentProxyElem =
-          propertiesSrc[name]->GetParent()->GetParent()->FindNestedElementByName("Proxy");
+          grandParent ? grandParent->FindNestedElementByName("Proxy") : nullptr;
         if (!parentProxyElem || !parentProxyElem->GetAttribute("override"))
         {
           vtkWarningMacro(<< "Find conflict between 2 property name. (" << name.c_str() << ")");
@@ -1028,8 +1237,8 @@ void vtkSIProxyDefinitionManager::MergeProxyDefinition(
         // Replace the overriden property by the new one
         vtkPVXMLElement* subPropDefToRemove = propertiesToFill[name].GetPointer();
         vtkPVXMLElement* overridingProp = propertiesSrc[name].GetPointer();
-        subPropDefToRemove->GetParent()->ReplaceNestedElement(subPropDefToRemove, overridingProp);
         overridingProp->GetParent()->RemoveNestedElement(overridingProp);
+        subPropDefToRemove->GetParent()->ReplaceNestedElement(subPropDefToRemove, overridingProp);
       }
     }
     // Move to next
@@ -1183,24 +1392,264 @@ void vtkSIProxyDefinitionManager::HandlePlugin(vtkPVPlugin* plugin)
     smplugin->GetXMLs(xmls);
 
     // Make sure only the SERVER is processing the XML proxy definition
-    if (this->Internals->EnableXMLProxyDefinitionUpdate)
+    if (this->Internals->EnableXMLProxyDefinitionUpdate && !xmls.empty())
     {
-      bool tmpReplaceOverrideInParent = this->Internals->ReplaceOverrideInParent;
-      this->Internals->ReplaceOverrideInParent = false;
-      for (size_t cc = 0; cc < xmls.size(); cc++)
+      // if GetPluginName() == vtkPVInitializerPlugin, it implies that it's
+      // the ParaView core and should not be treated as plugin.
+      const bool isCore = strcmp(plugin->GetPluginName(), "vtkPVInitializerPlugin") == 0;
+      if (!isCore || !this->LoadCoreDefinitions(xmls))
       {
-        this->LoadConfigurationXMLFromString(xmls[cc].c_str(),
-          // if GetPluginName() == vtkPVInitializerPlugin, it implies that it's
-          // the ParaView core and should not be treated as plugin.
-          strcmp(plugin->GetPluginName(), "vtkPVInitializerPlugin") != 0);
+        this->LoadConfigurationXMLs(xmls, !isCore);
       }
+    }
+  }
+}
+
+//---------------------------------------------------------------------------
+void vtkSIProxyDefinitionManager::LoadConfigurationXMLs(
+  const std::vector<std::string>& xmls, bool attachHints)
+{
+  bool tmpReplaceOverrideInParent = this->Internals->ReplaceOverrideInParent;
+  this->Internals->ReplaceOverrideInParent = false;
+  for (size_t cc = 0; cc < xmls.size(); cc++)
+  {
+    this->LoadConfigurationXMLFromString(xmls[cc].c_str(), attachHints);
+  }
 
-      // Make sure we invalidate any cached flatten version of our proxy definition
-      this->InternalsFlatten->Clear();
-      this->Internals->ReplaceOverrideInParent = tmpReplaceOverrideInParent;
+  // Make sure we invalidate any cached flatten version of our proxy definition
+  this->InternalsFlatten->Clear();
+  this->Internals->ReplaceOverrideInParent = tmpReplaceOverrideInParent;
+}
+
+//---------------------------------------------------------------------------
+bool vtkSIProxyDefinitionManager::LoadCoreDefinitions(const std::vector<std::string>& xmls)
+{
+  const std::string& cacheFileName = vtkSIProxyDefinitionManager::GetDefinitionCacheFileName();
+  vtkMultiProcessController* controller = vtkMultiProcessController::GetGlobalController();
+  const bool broadcast = vtkSIProxyDefinitionManager::GetBroadcastDefinitions() && controller &&
+    controller->GetNumberOfProcesses() > 1;
+  if (cacheFileName.empty() && !broadcast)
+  {
+    return false;
+  }
+
+  const std::string key = ComputeDefinitionCacheKey(xmls);
+  const int rank = controller ? controller->GetLocalProcessId() : 0;
+  if (broadcast && rank > 0)
+  {
+    vtkIdType size = 0;
+    controller->Broadcast(&size, 1, 0);
+    std::vector<char> buffer(static_cast<size_t>(size));
+    if (size > 0)
+    {
+      controller->Broadcast(buffer.data(), size, 0);
+    }
+    if (!this->DeserializeCoreDefinitions(key, buffer.data(), buffer.data() + buffer.size()))
+    {
+      vtkWarningMacro("Failed to load the proxy definitions broadcast by the first rank.");
+      return false;
     }
+    vtkVLogF(PARAVIEW_LOG_APPLICATION_VERBOSITY(), "received proxy definitions from rank 0");
+    this->CoreDefinitionsSource = BROADCAST;
+    return true;
+  }
+
+  const bool cached = !cacheFileName.empty() && this->LoadDefinitionCache(key);
+  if (!cached)
+  {
+    this->LoadConfigurationXMLs(xmls, false);
   }
+  this->CoreDefinitionsSource = cached ? DEFINITION_CACHE : PARSED_XMLS;
+
+  std::string buffer;
+  if (broadcast || (!cached && !cacheFileName.empty() && rank == 0))
+  {
+    this->SerializeCoreDefinitions(key, buffer);
+  }
+  if (broadcast)
+  {
+    vtkIdType size = static_cast<vtkIdType>(buffer.size());
+    controller->Broadcast(&size, 1, 0);
+    if (size > 0)
+    {
+      controller->Broadcast(&buffer[0], size, 0);
+    }
+  }
+  if (!cached && !cacheFileName.empty() && rank == 0)
+  {
+    this->WriteDefinitionCache(buffer);
+  }
+  return true;
+}
+
+//---------------------------------------------------------------------------
+void vtkSIProxyDefinitionManager::SetDefinitionCacheFileName(const std::string& fileName)
+{
+  DefinitionCacheFileName() = fileName;
 }
+
+//---------------------------------------------------------------------------
+const std::string& vtkSIProxyDefinitionManager::GetDefinitionCacheFileName()
+{
+  return DefinitionCacheFileName();
+}
+
+//---------------------------------------------------------------------------
+void vtkSIProxyDefinitionManager::SetBroadcastDefinitions(bool broadcast)
+{
+  BroadcastDefinitions() = broadcast;
+}
+
+//---------------------------------------------------------------------------
+bool vtkSIProxyDefinitionManager::GetBroadcastDefinitions()
+{
+  return BroadcastDefinitions();
+}
+
+//---------------------------------------------------------------------------
+bool vtkSIProxyDefinitionManager::LoadDefinitionCache(const std::string& key)
+{
+  const std::string& fileName = vtkSIProxyDefinitionManager::GetDefinitionCacheFileName();
+  vtkDefinitionCacheBuffer buffer(fileName);
+  if (!this->DeserializeCoreDefinitions(key, buffer.GetBegin(), buffer.GetEnd()))
+  {
+    vtkVLogF(PARAVIEW_LOG_APPLICATION_VERBOSITY(),
+      "proxy definition cache '%s' is missing, outdated or invalid", fileName.c_str());
+    return false;
+  }
+  vtkVLogF(PARAVIEW_LOG_APPLICATION_VERBOSITY(), "loaded proxy definitions from cache '%s'",
+    fileName.c_str());
+  return true;
+}
+
+//---------------------------------------------------------------------------
+void vtkSIProxyDefinitionManager::WriteDefinitionCache(const std::string& buffer)
+{
+  // Write to a temporary file first so that other processes never read a
+  // partial cache.
+  const std::string& fileName = vtkSIProxyDefinitionManager::GetDefinitionCacheFileName();
+  const std::string tmpName = fileName + ".tmp" + std::to_string(vtksys::SystemTools::GetTime());
+  bool written;
+  {
+    vtksys::ofstream file(tmpName.c_str(), ios::out | ios::binary);
+    written = static_cast<bool>(file.write(buffer.data(), buffer.size()));
+  }
+  if (!written || !vtksys::SystemTools::RenameFile(tmpName, fileName))
+  {
+    vtksys::SystemTools::RemoveFile(tmpName);
+    vtkWarningMacro("Failed to write proxy definition cache '" << fileName << "'.");
+    return;
+  }
+  vtkVLogF(PARAVIEW_LOG_APPLICATION_VERBOSITY(), "wrote proxy definition cache '%s'",
+    fileName.c_str());
+}
+
+//---------------------------------------------------------------------------
+bool vtkSIProxyDefinitionManager::DeserializeCoreDefinitions(
+  const std::string& key, const char* begin, const char* end)
+{
+  const char* cursor = begin;
+  bool valid = begin && static_cast<size_t>(end - cursor) >= sizeof(DefinitionCacheMagic) &&
+    memcmp(cursor, DefinitionCacheMagic, sizeof(DefinitionCacheMagic)) == 0;
+  vtkTypeUInt32 version;
+  vtkTypeUInt32 byteOrderMark;
+  std::string bufferKey;
+  if (valid)
+  {
+    cursor += sizeof(DefinitionCacheMagic);
+    valid = ReadUInt32(cursor, end, version) && ReadUInt32(cursor, end, byteOrderMark) &&
+      ReadString(cursor, end, bufferKey) && version == DefinitionCacheVersion &&
+      byteOrderMark == DefinitionCacheByteOrderMark && bufferKey == key;
+  }
+
+  StrToStrToXmlMap coreDefinitions;
+  StrToStrToXmlMap collapsedDefinitions;
+  if (!valid || !ReadDefinitions(cursor, end, coreDefinitions) ||
+    !ReadDefinitions(cursor, end, collapsedDefinitions))
+  {
+    return false;
+  }
+
+  for (const auto& group : coreDefinitions)
+  {
+    for (const auto& proxy : group.second)
+    {
+      this->AddElement(group.first.c_str(), proxy.first.c_str(), proxy.second);
+    }
+  }
+  this->InternalsFlatten->Clear();
+  this->InternalsFlatten->CoreDefinitions = std::move(collapsedDefinitions);
+  this->InvokeEvent(vtkSIProxyDefinitionManager::ProxyDefinitionsUpdated);
+  return true;
+}
+
+//---------------------------------------------------------------------------
+void vtkSIProxyDefinitionManager::SerializeCoreDefinitions(
+  const std::string& key, std::string& buffer)
+{
+  buffer.assign(DefinitionCacheMagic, sizeof(DefinitionCacheMagic));
+  AppendUInt32(buffer, DefinitionCacheVersion);
+  AppendUInt32(buffer, DefinitionCacheByteOrderMark);
+  AppendString(buffer, key);
+
+  // Write the core definitions and collect the ones that are derived from
+  // other definitions, and which are complete.
+  auto isComplete = [this](vtkPVXMLElement* definition) {
+    std::set<vtkPVXMLElement*> visited;
+    while (definition && visited.insert(definition).second)
+    {
+      const char* baseGroup = definition->GetAttribute("base_proxygroup");
+      const char* baseName = definition->GetAttribute("base_proxyname");
+      if (!baseGroup || !baseName || !*baseGroup || !*baseName)
+      {
+        return true;
+      }
+      definition = this->Internals->GetProxyElement(baseGroup, baseName);
+    }
+    return false;
+  };
+  std::vector<std::pair<std::string, std::string>> derivedDefinitions;
+  vtkTypeUInt32 count = 0;
+  for (const auto& group : this->Internals->CoreDefinitions)
+  {
+    count += static_cast<vtkTypeUInt32>(group.second.size());
+  }
+  AppendUInt32(buffer, count);
+  for (const auto& group : this->Internals->CoreDefinitions)
+  {
+    for (const auto& proxy : group.second)
+    {
+      AppendString(buffer, group.first);
+      AppendString(buffer, proxy.first);
+      proxy.second->WriteBinary(buffer);
+      if (proxy.second->GetAttribute("base_proxyname") && isComplete(proxy.second))
+      {
+        derivedDefinitions.emplace_back(group.first, proxy.first);
+      }
+    }
+  }
+
+  // Collapse the derived definitions, so that processes loading the buffer
+  // do not have to.
+  std::string collapsed;
+  count = 0;
+  for (const auto& item : derivedDefinitions)
+  {
+    this->GetCollapsedProxyDefinition(item.first.c_str(), item.second.c_str(), nullptr, false);
+    vtkPVXMLElement* definition =
+      this->InternalsFlatten->GetProxyElement(item.first.c_str(), item.second.c_str());
+    if (definition)
+    {
+      AppendString(collapsed, item.first);
+      AppendString(collapsed, item.second);
+      definition->WriteBinary(collapsed);
+      ++count;
+    }
+  }
+  AppendUInt32(buffer, count);
+  buffer.append(collapsed);
+}
+
 //---------------------------------------------------------------------------
 bool vtkSIProxyDefinitionManager::HasDefinition(const char* groupName, const char* proxyName)
 {
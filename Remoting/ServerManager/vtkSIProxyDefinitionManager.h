@@ -25,6 +25,12 @@
  * \li \c vtkCommand::UnRegisterEvent - Fired when a proxy definition is
  * removed. Since this class only support removing custom proxies, this event is
  * fired only when a custom proxy is removed.
+ *
+ * Parsing the core configuration xmls is a significant part of the startup
+ * time of every process. When a definition cache file is provided (see
+ * SetDefinitionCacheFileName), the core definitions, and the collapsed version
+ * of the ones derived from other definitions, are read from that file in a
+ * single pass instead.
  */
 
 #ifndef vtkSIProxyDefinitionManager_h
@@ -33,6 +39,9 @@
 #include "vtkRemotingServerManagerModule.h" //needed for exports
 #include "vtkSIObject.h"
 
+#include <string> // for std::string
+#include <vector> // for std::vector
+
 class vtkPVPlugin;
 class vtkPVProxyDefinitionIterator;
 class vtkPVXMLElement;
@@ -145,6 +154,52 @@ public:
   bool LoadConfigurationXMLFromString(const char* xmlContent);
   ///@}
 
+  ///@{
+  /**
+   * Get/Set the file used to cache the core proxy definitions, i.e. the ones
+   * provided by ParaView itself rather than by plugins. This is global to the
+   * process and must be set before the definition manager is created, i.e.
+   * before the session. Defaults to the value of the `PV_PROXY_DEFINITION_CACHE`
+   * environment variable. An empty string disables the cache.
+   *
+   * When the file is missing or was produced by another build, the core xmls
+   * are parsed and the first rank writes the file, including the collapsed
+   * version of all the definitions derived from other definitions (see
+   * GetCollapsedProxyDefinition). Processes started afterwards load the file
+   * instead of parsing the xmls.
+   */
+  static void SetDefinitionCacheFileName(const std::string& fileName);
+  static const std::string& GetDefinitionCacheFileName();
+  ///@}
+
+  ///@{
+  /**
+   * Get/Set whether, in parallel runs, only the first rank of the global
+   * controller parses the core configuration xmls (or loads them from the
+   * definition cache) and broadcasts the resulting definitions to the other
+   * ranks, instead of every rank parsing them. This is global to the process.
+   * All the ranks must then create their definition manager, i.e. their
+   * session, together, as pvserver and pvbatch do. Defaults to true if the
+   * `PV_PROXY_DEFINITION_BROADCAST` environment variable is set.
+   */
+  static void SetBroadcastDefinitions(bool broadcast);
+  static bool GetBroadcastDefinitions();
+  ///@}
+
+  enum CoreDefinitionsSources
+  {
+    PARSED_XMLS = 0,
+    DEFINITION_CACHE = 1,
+    BROADCAST = 2
+  };
+
+  /**
+   * Returns where the core definitions of this instance come from: parsed from
+   * the configuration xmls, loaded from the definition cache file or received
+   * from the first rank. See CoreDefinitionsSources.
+   */
+  vtkGetMacro(CoreDefinitionsSource, int);
+
   enum Events
   {
     ProxyDefinitionsUpdated = 2000,
@@ -266,6 +321,40 @@ protected:
   void HandlePlugin(vtkPVPlugin*);
   ///@}
 
+  /**
+   * Parse `xmls` and load the definitions they provide.
+   */
+  void LoadConfigurationXMLs(const std::vector<std::string>& xmls, bool attachHints);
+
+  /**
+   * Load the core definitions provided by `xmls` using the definition cache
+   * and broadcasting them between ranks, as requested. Returns false if
+   * neither is used, in which case `xmls` must be parsed.
+   */
+  bool LoadCoreDefinitions(const std::vector<std::string>& xmls);
+
+  ///@{
+  /**
+   * Load the core definitions from the definition cache file, or write
+   * serialized definitions to it. `key` identifies the core xmls.
+   * LoadDefinitionCache returns false, leaving the definitions untouched, if
+   * the file is missing, invalid or does not match `key`.
+   */
+  bool LoadDefinitionCache(const std::string& key);
+  void WriteDefinitionCache(const std::string& buffer);
+  ///@}
+
+  ///@{
+  /**
+   * Serialize the core definitions, and the collapsed version of the ones
+   * derived from other definitions, to `buffer`, and load them back.
+   * DeserializeCoreDefinitions returns false, leaving the definitions
+   * untouched, if the buffer is invalid or does not match `key`.
+   */
+  void SerializeCoreDefinitions(const std::string& key, std::string& buffer);
+  bool DeserializeCoreDefinitions(const std::string& key, const char* begin, const char* end);
+  ///@}
+
   /**
    * Called by the XML parser to add an element from which a proxy
    * can be created. Called during parsing.
@@ -309,6 +398,8 @@ protected:
    */
   void InvokeCustomDefitionsUpdated();
 
+  int CoreDefinitionsSource;
+
 private:
   vtkSIProxyDefinitionManager(const vtkSIProxyDefinitionManager&) = delete;
   void operator=(const vtkSIProxyDefinitionManager&) = delete;
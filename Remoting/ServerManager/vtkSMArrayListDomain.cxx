@@ -408,6 +408,8 @@ void vtkSMArrayListDomain::Update(vtkSMProperty*)
   {
     vtkNew<vtkPVDataInformation> subsetInfo;
     subsetInfo->SetPortNumber(dataInfo->GetPortNumber());
+    // only the list of arrays is needed.
+    subsetInfo->SetComputeArrayRanges(false);
     subsetInfo->SetSubsetAssemblyName(activeAssemblyProp->GetElement(0));
     for (unsigned int i = 0; i < selectors->GetNumberOfElements(); ++i)
     {
@@ -9,6 +9,7 @@
 #include "vtkDataAssembly.h"
 #include "vtkDataAssemblyUtilities.h"
 #include "vtkDataObject.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPVClassNameInformation.h"
 #include "vtkPVDataInformation.h"
@@ -20,6 +21,7 @@
 #include "vtkSMSession.h"
 #include "vtkTimerLog.h"
 
+#include <algorithm>
 #include <sstream>
 
 //----------------------------------------------------------------------------
@@ -43,6 +45,21 @@ vtkSMOutputPort::vtkSMOutputPort()
 //----------------------------------------------------------------------------
 vtkSMOutputPort::~vtkSMOutputPort()
 {
+  // the session writes the replies to the pending requests in their
+  // information objects, wait for them without updating this port.
+  this->PendingDataInformationValid = false;
+  while (!this->PendingDataInformationRequests.empty() && this->ObservedSession)
+  {
+    const auto requestId = this->PendingDataInformationRequests.front().RequestId;
+    if (!this->ObservedSession->WaitForGatherInformation(requestId))
+    {
+      break;
+    }
+  }
+  if (this->ObservedSession)
+  {
+    this->ObservedSession->RemoveObserver(this->GatherInformationObserverId);
+  }
   this->SetSourceProxy(nullptr);
   this->ClassNameInformation->Delete();
   this->DataInformation->Delete();
@@ -52,6 +69,12 @@ vtkSMOutputPort::~vtkSMOutputPort()
 //----------------------------------------------------------------------------
 vtkPVDataInformation* vtkSMOutputPort::GetDataInformation()
 {
+  if (!this->DataInformationValid && this->PendingDataInformationValid && this->ObservedSession)
+  {
+    // the data information has already been requested.
+    this->ObservedSession->WaitForGatherInformation(
+      this->PendingDataInformationRequests.back().RequestId);
+  }
   if (!this->DataInformationValid)
   {
     std::ostringstream mystr;
@@ -63,6 +86,84 @@ vtkPVDataInformation* vtkSMOutputPort::GetDataInformation()
   return this->DataInformation;
 }
 
+//----------------------------------------------------------------------------
+bool vtkSMOutputPort::UpdateDataInformationAsync()
+{
+  if (this->DataInformationValid || this->PendingDataInformationValid)
+  {
+    return this->DataInformationValid;
+  }
+  if (!this->SourceProxy || !this->SourceProxy->GetSession())
+  {
+    vtkErrorMacro("Invalid vtkSMOutputPort.");
+    return false;
+  }
+
+  vtkSMSession* session = this->SourceProxy->GetSession();
+  if (this->ObservedSession != session)
+  {
+    if (this->ObservedSession)
+    {
+      this->ObservedSession->RemoveObserver(this->GatherInformationObserverId);
+    }
+    this->ObservedSession = session;
+    this->GatherInformationObserverId =
+      session->AddObserver(vtkSMSession::GatherInformationCompletedEvent, this,
+        &vtkSMOutputPort::OnGatherInformationCompleted);
+  }
+
+  vtkNew<vtkPVDataInformation> info;
+  info->Initialize();
+  info->SetPortNumber(this->PortIndex);
+  this->PendingDataInformationRequests.push_back({ 0, info });
+  this->PendingDataInformationValid = true;
+
+  // builtin sessions complete the request before returning.
+  const vtkTypeUInt32 requestId = session->GatherInformationAsync(
+    this->SourceProxy->GetLocation(), info, this->SourceProxy->GetGlobalID());
+  for (auto& request : this->PendingDataInformationRequests)
+  {
+    if (request.Information == info)
+    {
+      request.RequestId = requestId;
+    }
+  }
+  return this->DataInformationValid;
+}
+
+//----------------------------------------------------------------------------
+void vtkSMOutputPort::OnGatherInformationCompleted(vtkObject*, unsigned long, void* calldata)
+{
+  auto data = static_cast<vtkSMSession::GatherInformationCompletedData*>(calldata);
+  auto& requests = this->PendingDataInformationRequests;
+  auto iter = std::find_if(requests.begin(), requests.end(),
+    [data](const PendingDataInformationRequest& request) {
+      return request.Information == data->Information;
+    });
+  if (iter == requests.end())
+  {
+    // not one of ours.
+    return;
+  }
+
+  const bool current = (iter + 1 == requests.end()) && this->PendingDataInformationValid;
+  vtkSmartPointer<vtkPVDataInformation> info = iter->Information;
+  requests.erase(iter);
+  if (!current)
+  {
+    return;
+  }
+
+  this->PendingDataInformationValid = false;
+  if (data->Success)
+  {
+    this->DataInformation->DeepCopy(info);
+    this->DataInformation->Modified();
+    this->DataInformationValid = true;
+    this->InvokeEvent(vtkCommand::UpdateInformationEvent);
+  }
+}
+
 //----------------------------------------------------------------------------
 vtkPVTemporalDataInformation* vtkSMOutputPort::GetTemporalDataInformation()
 {
@@ -198,6 +299,7 @@ const char* vtkSMOutputPort::GetDataClassName()
 void vtkSMOutputPort::InvalidateDataInformation()
 {
   this->DataInformationValid = false;
+  this->PendingDataInformationValid = false;
   this->ClassNameInformationValid = false;
   this->TemporalDataInformationValid = false;
   this->SubsetDataInformations.clear();
@@ -214,6 +316,7 @@ void vtkSMOutputPort::GatherDataInformation()
   }
 
   this->SourceProxy->GetSession()->PrepareProgress();
+  this->PendingDataInformationValid = false;
   this->DataInformation->Initialize();
   this->DataInformation->SetPortNumber(this->PortIndex);
   this->SourceProxy->GatherInformation(this->DataInformation);
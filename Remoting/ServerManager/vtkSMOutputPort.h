@@ -23,7 +23,8 @@
 #include "vtkSmartPointer.h" // needed for vtkSmartPointer
 #include "vtkWeakPointer.h"  // needed for vtkWeakPointer
 
-#include <map> // needed for std::map
+#include <map>    // needed for std::map
+#include <vector> // needed for std::vector
 
 class vtkCollection;
 class vtkPVClassNameInformation;
@@ -48,6 +49,17 @@ public:
    */
   virtual vtkPVDataInformation* GetDataInformation();
 
+  /**
+   * Non-blocking variant of GetDataInformation(). Returns true if the data
+   * information is valid. Otherwise, requests it from the servers using
+   * vtkSMSession::GatherInformationAsync() and returns false.
+   * vtkCommand::UpdateInformationEvent is fired once the data information
+   * has been received, unless it was invalidated in the meantime. Calling
+   * GetDataInformation() before that waits for the pending request instead of
+   * gathering the data information again.
+   */
+  bool UpdateDataInformationAsync();
+
   /**
    * Get rank-specific data information.
    */
@@ -168,6 +180,25 @@ protected:
     SubsetDataInformations;
   std::map<int, vtkSmartPointer<vtkPVDataInformation>> RankDataInformations;
 
+  /**
+   * Called when the session received the reply to a GatherInformationAsync()
+   * request.
+   */
+  void OnGatherInformationCompleted(vtkObject*, unsigned long, void* calldata);
+
+  // Requests sent by UpdateDataInformationAsync() and not replied to yet. The
+  // last one updates DataInformation when PendingDataInformationValid is
+  // true, i.e. when the data information has not been invalidated since.
+  struct PendingDataInformationRequest
+  {
+    vtkTypeUInt32 RequestId;
+    vtkSmartPointer<vtkPVDataInformation> Information;
+  };
+  std::vector<PendingDataInformationRequest> PendingDataInformationRequests;
+  bool PendingDataInformationValid = false;
+  vtkWeakPointer<vtkSMSession> ObservedSession;
+  unsigned long GatherInformationObserverId = 0;
+
 private:
   vtkSMOutputPort(const vtkSMOutputPort&) = delete;
   void operator=(const vtkSMOutputPort&) = delete;
@@ -55,6 +55,7 @@ vtkSMSession::vtkSMSession(bool initialize_during_constructor /*=true*/,
 
   this->SessionProxyManager = nullptr;
   this->StateLocator = vtkSMStateLocator::New();
+  this->LastGatherInformationRequestId = 0;
 
   // Create and setup deserializer for the local ProxyLocator
   vtkNew<vtkSMDeserializerProtobuf> deserializer;
@@ -114,6 +115,29 @@ void vtkSMSession::PushState(vtkSMMessage* msg)
   this->Superclass::PushState(msg);
 }
 
+//----------------------------------------------------------------------------
+vtkTypeUInt32 vtkSMSession::GatherInformationAsync(
+  vtkTypeUInt32 location, vtkPVInformation* information, vtkTypeUInt32 globalid)
+{
+  GatherInformationCompletedData calldata;
+  calldata.RequestId = this->GetNextGatherInformationRequestId();
+  calldata.Information = information;
+  calldata.Success = this->GatherInformation(location, information, globalid);
+  this->InvokeEvent(GatherInformationCompletedEvent, &calldata);
+  return calldata.RequestId;
+}
+
+//----------------------------------------------------------------------------
+vtkTypeUInt32 vtkSMSession::GetNextGatherInformationRequestId()
+{
+  if (++this->LastGatherInformationRequestId == 0)
+  {
+    // 0 is never used as a request id.
+    ++this->LastGatherInformationRequestId;
+  }
+  return this->LastGatherInformationRequestId;
+}
+
 //----------------------------------------------------------------------------
 void vtkSMSession::UpdateStateHistory(vtkSMMessage* msg)
 {
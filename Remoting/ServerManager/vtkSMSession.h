@@ -10,10 +10,12 @@
 #ifndef vtkSMSession_h
 #define vtkSMSession_h
 
+#include "vtkCommand.h"              // needed for vtkCommand::UserEvent.
 #include "vtkNetworkAccessManager.h" // needed for vtkNetworkAccessManager::ConnectionResult.
 #include "vtkPVSessionBase.h"
 #include "vtkRemotingServerManagerModule.h" //needed for exports
 
+class vtkPVInformation;
 class vtkSMCollaborationManager;
 class vtkSMProxyLocator;
 class vtkSMSessionProxyManager;
@@ -132,6 +134,78 @@ public:
    */
   void PushState(vtkSMMessage* msg) override;
 
+  ///@{
+  /**
+   * Begin/commit a push transaction. While a transaction is open, sessions
+   * connected to remote servers may accumulate the state messages pushed to
+   * the servers and send them as a single compound message when the outermost
+   * transaction is committed. The servers apply the messages in the order
+   * they were pushed. Transactions can be nested. Any operation that
+   * communicates with the servers, including renders, flushes the pending
+   * messages first (see vtkPVSession::FlushPendingMessages()). The state
+   * pushed to the client process is applied immediately. The default
+   * implementation does nothing since builtin sessions push states directly.
+   */
+  virtual void BeginPushTransaction() {}
+  virtual void CommitPushTransaction() {}
+  ///@}
+
+  enum
+  {
+    /**
+     * Fired when information requested using GatherInformationAsync() has
+     * been received. The call data is a GatherInformationCompletedData
+     * pointer.
+     */
+    GatherInformationCompletedEvent = vtkCommand::UserEvent + 1,
+
+    /**
+     * Fired when GatherInformationAsync() sent a request to the servers and
+     * returned before the reply was received. The reply is processed when the
+     * application processes the messages from the servers. The call data is
+     * a pointer to the vtkTypeUInt32 request identifier.
+     */
+    GatherInformationRequestedEvent = vtkCommand::UserEvent + 2
+  };
+
+  struct GatherInformationCompletedData
+  {
+    vtkTypeUInt32 RequestId;
+    vtkPVInformation* Information;
+    bool Success;
+  };
+
+  /**
+   * Non-blocking variant of GatherInformation(). Returns a request identifier
+   * (never 0) and fires GatherInformationCompletedEvent once \c information
+   * has been updated. Sessions connected to remote servers send the request
+   * and return immediately, the reply being handled when the client processes
+   * the messages received from the server, e.g. in the application event loop.
+   * \c information must not be modified until the event has been fired.
+   * This is meant for user interface components, such as the Information
+   * panel, that can update when the information arrives instead of blocking.
+   * The default implementation gathers the information synchronously, hence
+   * the event is fired before this method returns.
+   */
+  virtual vtkTypeUInt32 GatherInformationAsync(
+    vtkTypeUInt32 location, vtkPVInformation* information, vtkTypeUInt32 globalid);
+
+  /**
+   * Blocks until the reply for the given GatherInformationAsync() request has
+   * been received and GatherInformationCompletedEvent fired. Returns false if
+   * the request is unknown or the connection to the server was lost. The
+   * default implementation simply returns false since the requests complete
+   * synchronously.
+   */
+  virtual bool WaitForGatherInformation(vtkTypeUInt32 vtkNotUsed(requestId)) { return false; }
+
+  /**
+   * Returns true if replies to GatherInformationAsync() requests are yet to
+   * be received. The default implementation returns false since the requests
+   * complete synchronously.
+   */
+  virtual bool HasPendingGatherInformation() const { return false; }
+
   /**
    * Sends the message to all clients.
    */
@@ -300,6 +374,11 @@ protected:
    */
   void UpdateStateHistory(vtkSMMessage* msg);
 
+  /**
+   * Returns a new identifier for GatherInformationAsync() requests.
+   */
+  vtkTypeUInt32 GetNextGatherInformationRequestId();
+
   vtkSMSessionProxyManager* SessionProxyManager;
   vtkSMStateLocator* StateLocator;
   vtkSMProxyLocator* ProxyLocator;
@@ -307,6 +386,8 @@ protected:
 private:
   vtkSMSession(const vtkSMSession&) = delete;
   void operator=(const vtkSMSession&) = delete;
+
+  vtkTypeUInt32 LastGatherInformationRequestId;
 };
 
 #endif
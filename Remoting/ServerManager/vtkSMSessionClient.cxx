@@ -10,6 +10,7 @@
 #include "vtkNetworkAccessManager.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkPVInformation.h"
 #include "vtkPVMultiClientsInformation.h"
 #include "vtkPVProgressHandler.h"
 #include "vtkPVServerInformation.h"
@@ -49,6 +50,13 @@ void RMICallback(
   vtkSMSessionClient* self = reinterpret_cast<vtkSMSessionClient*>(localArg);
   self->OnServerNotificationMessageRMI(remoteArg, remoteArgLength);
 }
+
+void GatherInformationReplyCallback(
+  void* localArg, void* remoteArg, int remoteArgLength, int vtkNotUsed(remoteProcessId))
+{
+  vtkSMSessionClient* self = reinterpret_cast<vtkSMSessionClient*>(localArg);
+  self->OnGatherInformationReplyRMI(remoteArg, remoteArgLength);
+}
 };
 //****************************************************************************/
 vtkStandardNewMacro(vtkSMSessionClient);
@@ -81,6 +89,8 @@ vtkSMSessionClient::vtkSMSessionClient()
   // Default value
   this->NoMoreDelete = false;
   this->NotBusy = 0;
+  this->PushTransactionDepth = 0;
+  this->PendingPushSize = 0;
 }
 
 //----------------------------------------------------------------------------
@@ -90,6 +100,13 @@ vtkSMSessionClient::~vtkSMSessionClient()
   {
     this->DataServerController->RemoveAllRMICallbacks(
       vtkPVSessionServer::SERVER_NOTIFICATION_MESSAGE_RMI);
+    this->DataServerController->RemoveAllRMICallbacks(
+      vtkPVSessionServer::GATHER_INFORMATION_REPLY_RMI);
+  }
+  if (this->RenderServerController)
+  {
+    this->RenderServerController->RemoveAllRMICallbacks(
+      vtkPVSessionServer::GATHER_INFORMATION_REPLY_RMI);
   }
   if (this->GetIsAlive())
   {
@@ -334,6 +351,8 @@ bool vtkSMSessionClient::Connect(const char* url, int timeout, bool (*callback)(
       vtkCommand::ErrorEvent, this, &vtkSMSessionClient::OnConnectionLost);
     dcontroller->AddRMICallback(
       &RMICallback, this, vtkPVSessionServer::SERVER_NOTIFICATION_MESSAGE_RMI);
+    dcontroller->AddRMICallback(
+      &GatherInformationReplyCallback, this, vtkPVSessionServer::GATHER_INFORMATION_REPLY_RMI);
     dcontroller->Delete();
   }
   if (rcontroller)
@@ -343,6 +362,8 @@ bool vtkSMSessionClient::Connect(const char* url, int timeout, bool (*callback)(
       vtkCommand::WrongTagEvent, this, &vtkSMSessionClient::OnWrongTagEvent);
     rcontroller->GetCommunicator()->AddObserver(
       vtkCommand::ErrorEvent, this, &vtkSMSessionClient::OnConnectionLost);
+    rcontroller->AddRMICallback(
+      &GatherInformationReplyCallback, this, vtkPVSessionServer::GATHER_INFORMATION_REPLY_RMI);
     rcontroller->Delete();
   }
 
@@ -522,6 +543,8 @@ bool vtkSMSessionClient::IsMPIInitialized(vtkTypeUInt32 servers)
 //----------------------------------------------------------------------------
 void vtkSMSessionClient::CloseSession()
 {
+  // Preserve the ordering with pushes accumulated by an open transaction.
+  this->FlushPushMessages();
   if (this->DataServerController)
   {
     this->DataServerController->TriggerRMIOnAllChildren(vtkPVSessionServer::CLOSE_SESSION);
@@ -587,15 +610,10 @@ void vtkSMSessionClient::PushState(vtkSMMessage* message)
   }
   if (num_controllers > 0)
   {
-    vtkMultiProcessStream stream;
-    stream << static_cast<int>(vtkPVSessionServer::PUSH);
-    stream << message->SerializeAsString();
-    std::vector<unsigned char> raw_message;
-    stream.GetRawData(raw_message);
+    const std::string serialized = message->SerializeAsString();
     for (int cc = 0; cc < num_controllers; cc++)
     {
-      controllers[cc]->TriggerRMIOnAllChildren(&raw_message[0],
-        static_cast<int>(raw_message.size()), vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+      this->SendPushMessage(controllers[cc], serialized);
     }
   }
 
@@ -627,13 +645,7 @@ void vtkSMSessionClient::PushState(vtkSMMessage* message)
         msg.set_share_only(true);
         msg.set_client_id(this->ServerInformation->GetClientId());
 
-        vtkMultiProcessStream stream;
-        stream << static_cast<int>(vtkPVSessionServer::PUSH);
-        stream << msg.SerializeAsString();
-        std::vector<unsigned char> raw_message;
-        stream.GetRawData(raw_message);
-        this->DataServerController->TriggerRMIOnAllChildren(&raw_message[0],
-          static_cast<int>(raw_message.size()), vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+        this->SendPushMessage(this->DataServerController, msg.SerializeAsString());
       }
       else if (!remoteObject)
       {
@@ -655,10 +667,102 @@ void vtkSMSessionClient::PushState(vtkSMMessage* message)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkSMSessionClient::SendPushMessage(
+  vtkMultiProcessController* controller, const std::string& message)
+{
+  if (this->PushTransactionDepth > 0)
+  {
+    auto& pending = controller == this->DataServerController ? this->PendingDataServerPushes
+                                                             : this->PendingRenderServerPushes;
+    pending.push_back(message);
+    this->PendingPushSize += message.size();
+
+    // Avoid holding on to arbitrarily large states.
+    if (this->PendingPushSize > 64 * 1024 * 1024)
+    {
+      this->FlushPushMessages();
+    }
+    return;
+  }
+
+  vtkMultiProcessStream stream;
+  stream << static_cast<int>(vtkPVSessionServer::PUSH);
+  stream << message;
+  std::vector<unsigned char> raw_message;
+  stream.GetRawData(raw_message);
+  controller->TriggerRMIOnAllChildren(&raw_message[0], static_cast<int>(raw_message.size()),
+    vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+}
+
+//----------------------------------------------------------------------------
+void vtkSMSessionClient::FlushPushMessages()
+{
+  vtkMultiProcessController* controllers[2] = { this->DataServerController,
+    this->RenderServerController };
+  std::vector<std::string>* pendings[2] = { &this->PendingDataServerPushes,
+    &this->PendingRenderServerPushes };
+  for (int cc = 0; cc < 2; ++cc)
+  {
+    std::vector<std::string>& pending = *pendings[cc];
+    if (pending.empty())
+    {
+      continue;
+    }
+    if (controllers[cc])
+    {
+      vtkMultiProcessStream stream;
+      stream << static_cast<int>(vtkPVSessionServer::PUSH_BATCH);
+      stream << static_cast<int>(pending.size());
+      for (const auto& message : pending)
+      {
+        stream << message;
+      }
+      std::vector<unsigned char> raw_message;
+      stream.GetRawData(raw_message);
+      controllers[cc]->TriggerRMIOnAllChildren(&raw_message[0],
+        static_cast<int>(raw_message.size()), vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+    }
+    pending.clear();
+  }
+  this->PendingPushSize = 0;
+}
+
+//----------------------------------------------------------------------------
+void vtkSMSessionClient::FlushPendingMessages()
+{
+  if (!this->NoMoreDelete)
+  {
+    this->FlushPushMessages();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkSMSessionClient::BeginPushTransaction()
+{
+  ++this->PushTransactionDepth;
+}
+
+//----------------------------------------------------------------------------
+void vtkSMSessionClient::CommitPushTransaction()
+{
+  if (this->PushTransactionDepth <= 0)
+  {
+    vtkErrorMacro("CommitPushTransaction called without matching BeginPushTransaction.");
+    return;
+  }
+  if (--this->PushTransactionDepth == 0 && !this->NoMoreDelete)
+  {
+    this->FlushPushMessages();
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkSMSessionClient::PullState(vtkSMMessage* message)
 {
   this->StartBusyWork();
+  // Preserve the ordering with pushes accumulated by an open transaction.
+  this->FlushPushMessages();
   vtkTypeUInt32 location = this->GetRealLocation(message->location());
   message->set_location(location);
 
@@ -713,6 +817,8 @@ void vtkSMSessionClient::ExecuteStream(
   {
     return;
   }
+  // Preserve the ordering with pushes accumulated by an open transaction.
+  this->FlushPushMessages();
 
   location = this->GetRealLocation(location);
 
@@ -758,6 +864,8 @@ void vtkSMSessionClient::ExecuteStream(
 const vtkClientServerStream& vtkSMSessionClient::GetLastResult(vtkTypeUInt32 location)
 {
   this->StartBusyWork();
+  // Preserve the ordering with pushes accumulated by an open transaction.
+  this->FlushPushMessages();
   location = this->GetRealLocation(location);
 
   vtkMultiProcessController* controller = nullptr;
@@ -806,20 +914,9 @@ bool vtkSMSessionClient::GatherInformation(
   vtkTypeUInt32 location, vtkPVInformation* information, vtkTypeUInt32 globalid)
 {
   this->StartBusyWork();
-  if (this->RenderServerController == nullptr)
-  {
-    // re-route all render-server messages to data-server.
-    if (location & vtkPVSession::RENDER_SERVER)
-    {
-      location |= vtkPVSession::DATA_SERVER;
-      location &= ~vtkPVSession::RENDER_SERVER;
-    }
-    if (location & vtkPVSession::RENDER_SERVER_ROOT)
-    {
-      location |= vtkPVSession::DATA_SERVER_ROOT;
-      location &= ~vtkPVSession::RENDER_SERVER_ROOT;
-    }
-  }
+  // Preserve the ordering with pushes accumulated by an open transaction.
+  this->FlushPushMessages();
+  vtkMultiProcessController* controller = this->GetGatherInformationController(location);
 
   bool add_local_info = false;
   if ((location & vtkPVSession::CLIENT) != 0)
@@ -840,21 +937,6 @@ bool vtkSMSessionClient::GatherInformation(
   std::vector<unsigned char> raw_message;
   stream.GetRawData(raw_message);
 
-  vtkMultiProcessController* controller = nullptr;
-
-  if ((location & vtkPVSession::DATA_SERVER) != 0 ||
-    (location & vtkPVSession::DATA_SERVER_ROOT) != 0)
-  {
-    controller = this->DataServerController;
-  }
-
-  else if (this->RenderServerController != nullptr &&
-    ((location & vtkPVSession::RENDER_SERVER) != 0 ||
-      (location & vtkPVSession::RENDER_SERVER_ROOT) != 0))
-  {
-    controller = this->RenderServerController;
-  }
-
   if (controller)
   {
     controller->TriggerRMIOnAllChildren(&raw_message[0], static_cast<int>(raw_message.size()),
@@ -896,6 +978,153 @@ bool vtkSMSessionClient::GatherInformation(
   return false;
 }
 
+//----------------------------------------------------------------------------
+vtkMultiProcessController* vtkSMSessionClient::GetGatherInformationController(
+  vtkTypeUInt32& location)
+{
+  if (this->RenderServerController == nullptr)
+  {
+    // re-route all render-server messages to data-server.
+    if (location & vtkPVSession::RENDER_SERVER)
+    {
+      location |= vtkPVSession::DATA_SERVER;
+      location &= ~vtkPVSession::RENDER_SERVER;
+    }
+    if (location & vtkPVSession::RENDER_SERVER_ROOT)
+    {
+      location |= vtkPVSession::DATA_SERVER_ROOT;
+      location &= ~vtkPVSession::RENDER_SERVER_ROOT;
+    }
+  }
+
+  if ((location & vtkPVSession::DATA_SERVER) != 0 ||
+    (location & vtkPVSession::DATA_SERVER_ROOT) != 0)
+  {
+    return this->DataServerController;
+  }
+
+  if (this->RenderServerController != nullptr &&
+    ((location & vtkPVSession::RENDER_SERVER) != 0 ||
+      (location & vtkPVSession::RENDER_SERVER_ROOT) != 0))
+  {
+    return this->RenderServerController;
+  }
+  return nullptr;
+}
+
+//----------------------------------------------------------------------------
+vtkTypeUInt32 vtkSMSessionClient::GatherInformationAsync(
+  vtkTypeUInt32 location, vtkPVInformation* information, vtkTypeUInt32 globalid)
+{
+  vtkTypeUInt32 serverLocation = location;
+  vtkMultiProcessController* controller = this->GetGatherInformationController(serverLocation);
+  if (!controller || ((location & vtkPVSession::CLIENT) != 0 && information->GetRootOnly()))
+  {
+    // nothing to request from the servers.
+    return this->Superclass::GatherInformationAsync(location, information, globalid);
+  }
+
+  // Preserve the ordering with pushes accumulated by an open transaction.
+  this->FlushPushMessages();
+
+  bool add_local_info = false;
+  if ((location & vtkPVSession::CLIENT) != 0)
+  {
+    this->Superclass::GatherInformation(location, information, globalid);
+    add_local_info = true;
+  }
+
+  const vtkTypeUInt32 requestId = this->GetNextGatherInformationRequestId();
+  vtkMultiProcessStream stream;
+  stream << static_cast<int>(vtkPVSessionServer::GATHER_INFORMATION_ASYNC) << requestId
+         << serverLocation << information->GetClassName() << globalid;
+  information->CopyParametersToStream(stream);
+  std::vector<unsigned char> raw_message;
+  stream.GetRawData(raw_message);
+
+  PendingGatherRequest& request = this->PendingGatherRequests[requestId];
+  request.Information = information;
+  request.Controller = controller;
+  request.AddLocalInformation = add_local_info;
+
+  controller->TriggerRMIOnAllChildren(&raw_message[0], static_cast<int>(raw_message.size()),
+    vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+
+  vtkTypeUInt32 calldata = requestId;
+  this->InvokeEvent(GatherInformationRequestedEvent, &calldata);
+  return requestId;
+}
+
+//----------------------------------------------------------------------------
+bool vtkSMSessionClient::WaitForGatherInformation(vtkTypeUInt32 requestId)
+{
+  auto iter = this->PendingGatherRequests.find(requestId);
+  if (iter == this->PendingGatherRequests.end())
+  {
+    return false;
+  }
+
+  vtkMultiProcessController* controller = iter->second.Controller;
+  while (this->PendingGatherRequests.find(requestId) != this->PendingGatherRequests.end())
+  {
+    if (controller->ProcessRMIs(1, 1) != vtkMultiProcessController::RMI_NO_ERROR)
+    {
+      vtkErrorMacro("Failed to receive information correctly.");
+      return false;
+    }
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+void vtkSMSessionClient::OnGatherInformationReplyRMI(void* message, int message_length)
+{
+  vtkClientServerStream reply;
+  vtkTypeUInt32 requestId = 0;
+  if (!reply.SetData(reinterpret_cast<const unsigned char*>(message), message_length) ||
+    !reply.GetArgument(0, 0, &requestId))
+  {
+    vtkErrorMacro("Invalid gather information reply.");
+    return;
+  }
+
+  auto iter = this->PendingGatherRequests.find(requestId);
+  if (iter == this->PendingGatherRequests.end())
+  {
+    vtkErrorMacro("Unexpected gather information reply: " << requestId);
+    return;
+  }
+  PendingGatherRequest request = iter->second;
+  this->PendingGatherRequests.erase(iter);
+
+  GatherInformationCompletedData calldata;
+  calldata.RequestId = requestId;
+  calldata.Information = request.Information;
+  calldata.Success = false;
+
+  vtkClientServerStream csstream;
+  if (reply.GetArgument(0, 1, &csstream))
+  {
+    if (request.AddLocalInformation)
+    {
+      vtkSmartPointer<vtkPVInformation> tempInfo;
+      tempInfo.TakeReference(request.Information->NewInstance());
+      tempInfo->CopyFromStream(&csstream);
+      request.Information->AddInformation(tempInfo);
+    }
+    else
+    {
+      request.Information->CopyFromStream(&csstream);
+    }
+    calldata.Success = true;
+  }
+  else
+  {
+    vtkErrorMacro("Server failed to gather information.");
+  }
+  this->InvokeEvent(GatherInformationCompletedEvent, &calldata);
+}
+
 //----------------------------------------------------------------------------
 void vtkSMSessionClient::UnRegisterSIObject(vtkSMMessage* message)
 {
@@ -903,6 +1132,8 @@ void vtkSMSessionClient::UnRegisterSIObject(vtkSMMessage* message)
   {
     return;
   }
+  // Preserve the ordering with pushes accumulated by an open transaction.
+  this->FlushPushMessages();
 
   vtkTypeUInt32 location = this->GetRealLocation(message->location());
   message->set_location(location);
@@ -944,6 +1175,8 @@ void vtkSMSessionClient::RegisterSIObject(vtkSMMessage* message)
   {
     return;
   }
+  // Preserve the ordering with pushes accumulated by an open transaction.
+  this->FlushPushMessages();
 
   vtkTypeUInt32 location = this->GetRealLocation(message->location());
   message->set_location(location);
@@ -1036,18 +1269,18 @@ void vtkSMSessionClient::OnServerNotificationMessageRMI(void* message, int messa
 }
 //-----------------------------------------------------------------------------
 bool vtkSMSessionClient::OnWrongTagEvent(
-  vtkObject* vtkNotUsed(obj), unsigned long vtkNotUsed(event), void* calldata)
+  vtkObject* obj, unsigned long vtkNotUsed(event), void* calldata)
 {
   int tag = -1;
   const char* data = reinterpret_cast<const char*>(calldata);
   const char* ptr = data;
   memcpy(&tag, ptr, sizeof(tag));
 
-  // Just buffer RMI_TAG's
+  // Just buffer RMI_TAG's, on the communicator that received them: RMIs such as
+  // GATHER_INFORMATION_REPLY_RMI may come from the render server too.
   if (tag == vtkMultiProcessController::RMI_TAG || tag == vtkMultiProcessController::RMI_ARG_TAG)
   {
-    vtkSocketCommunicator::SafeDownCast(this->DataServerController->GetCommunicator())
-      ->BufferCurrentMessage();
+    vtkSocketCommunicator::SafeDownCast(obj)->BufferCurrentMessage();
   }
   else
   {
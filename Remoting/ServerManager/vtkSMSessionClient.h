@@ -13,6 +13,11 @@
 
 #include "vtkRemotingServerManagerModule.h" //needed for exports
 #include "vtkSMSession.h"
+#include "vtkSmartPointer.h" // for vtkSmartPointer
+
+#include <map>    // for std::map
+#include <string> // for std::string
+#include <vector> // for std::vector
 
 class vtkMultiProcessController;
 class vtkPVServerInformation;
@@ -108,6 +113,21 @@ public:
   const vtkClientServerStream& GetLastResult(vtkTypeUInt32 location) override;
   ///@}
 
+  ///@{
+  /**
+   * Overridden to accumulate the state messages pushed to the servers while a
+   * transaction is open and send them as a single message on commit.
+   */
+  void BeginPushTransaction() override;
+  void CommitPushTransaction() override;
+  ///@}
+
+  /**
+   * Overridden to send the state messages accumulated by an open push
+   * transaction.
+   */
+  void FlushPendingMessages() override;
+
   ///@{
   /**
    * When Connect() is waiting for a server to connect back to the client (in
@@ -132,6 +152,31 @@ public:
   bool GatherInformation(
     vtkTypeUInt32 location, vtkPVInformation* information, vtkTypeUInt32 globalid) override;
 
+  /**
+   * Overridden to send the request to the server without waiting for the
+   * reply. GatherInformationCompletedEvent is fired when the reply is
+   * processed, which happens when the client processes the messages from the
+   * server or in WaitForGatherInformation(). Locations that do not involve
+   * the servers are handled synchronously.
+   */
+  vtkTypeUInt32 GatherInformationAsync(
+    vtkTypeUInt32 location, vtkPVInformation* information, vtkTypeUInt32 globalid) override;
+
+  /**
+   * Overridden to process the messages from the server until the reply for
+   * the request has been received.
+   */
+  bool WaitForGatherInformation(vtkTypeUInt32 requestId) override;
+
+  /**
+   * Overridden to return true while replies to GatherInformationAsync()
+   * requests sent to the servers are yet to be received.
+   */
+  bool HasPendingGatherInformation() const override
+  {
+    return !this->PendingGatherRequests.empty();
+  }
+
   /**
    * Returns the number of processes on the given server/s. If more than 1
    * server is identified, than it returns the maximum number of processes e.g.
@@ -213,6 +258,7 @@ public:
   vtkTypeUInt32 GetNextChunkGlobalUniqueIdentifier(vtkTypeUInt32 chunkSize) override;
 
   void OnServerNotificationMessageRMI(void* message, int message_length);
+  void OnGatherInformationReplyRMI(void* message, int message_length);
 
 protected:
   vtkSMSessionClient();
@@ -239,6 +285,24 @@ protected:
    */
   vtkTypeUInt32 GetRealLocation(vtkTypeUInt32);
 
+  /**
+   * Sends a serialized push message to the given server, or queues it if a
+   * push transaction is open.
+   */
+  void SendPushMessage(vtkMultiProcessController* controller, const std::string& message);
+
+  /**
+   * Sends all pending push messages as compound messages.
+   */
+  void FlushPushMessages();
+
+  /**
+   * Returns the server location to use for the given location, rerouting the
+   * render-server to the data-server when there is no separate render-server,
+   * and the controller to communicate with it, if any.
+   */
+  vtkMultiProcessController* GetGatherInformationController(vtkTypeUInt32& location);
+
   // Both maybe the same when connected to pvserver.
   vtkMultiProcessController* RenderServerController;
   vtkMultiProcessController* DataServerController;
@@ -278,6 +342,18 @@ private:
   void operator=(const vtkSMSessionClient&) = delete;
 
   int NotBusy;
+  int PushTransactionDepth;
+  size_t PendingPushSize;
+  std::vector<std::string> PendingDataServerPushes;
+  std::vector<std::string> PendingRenderServerPushes;
+
+  struct PendingGatherRequest
+  {
+    vtkSmartPointer<vtkPVInformation> Information;
+    vtkMultiProcessController* Controller;
+    bool AddLocalInformation;
+  };
+  std::map<vtkTypeUInt32, PendingGatherRequest> PendingGatherRequests;
   vtkTypeUInt32 LastGlobalID;
   vtkTypeUInt32 LastGlobalIDAvailable;
 };
@@ -931,6 +931,8 @@ void vtkSMSessionProxyManager::UpdateRegisteredProxies(int modified_only /*=1*/)
 {
   vtksys::RegularExpression prototypesRe("_prototypes$");
 
+  this->BeginPushTransaction();
+
   vtkSMSessionProxyManagerInternals::ProxyGroupType::iterator it =
     this->Internals->RegisteredProxyMap.begin();
   for (; it != this->Internals->RegisteredProxyMap.end(); it++)
@@ -959,6 +961,25 @@ void vtkSMSessionProxyManager::UpdateRegisteredProxies(int modified_only /*=1*/)
       }
     }
   }
+  this->CommitPushTransaction();
+}
+
+//---------------------------------------------------------------------------
+void vtkSMSessionProxyManager::BeginPushTransaction()
+{
+  if (vtkSMSession* session = this->GetSession())
+  {
+    session->BeginPushTransaction();
+  }
+}
+
+//---------------------------------------------------------------------------
+void vtkSMSessionProxyManager::CommitPushTransaction()
+{
+  if (vtkSMSession* session = this->GetSession())
+  {
+    session->CommitPushTransaction();
+  }
 }
 
 //---------------------------------------------------------------------------
@@ -1231,7 +1252,10 @@ void vtkSMSessionProxyManager::LoadXMLState(vtkPVXMLElement* rootElement,
   {
     spLoader = loader;
   }
-  if (spLoader->LoadState(rootElement, keepOriginalIds))
+  this->BeginPushTransaction();
+  const bool loaded = spLoader->LoadState(rootElement, keepOriginalIds);
+  this->CommitPushTransaction();
+  if (loaded)
   {
     vtkSMProxyManager::LoadStateInformation info;
     info.RootElement = rootElement;
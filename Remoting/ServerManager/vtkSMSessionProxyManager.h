@@ -411,6 +411,20 @@ public:
     vtkPVXMLElement* rootElement, vtkSMStateLoader* loader = nullptr, bool keepOriginalIds = false);
   ///@}
 
+  ///@{
+  /**
+   * Begin/commit a push transaction. While a transaction is open, the state
+   * messages pushed by proxies to remote servers (e.g. by
+   * vtkSMProxy::UpdateVTKObjects) are accumulated and sent as a single
+   * compound message when the outermost transaction is committed, instead of
+   * one message per proxy. The servers apply the messages in order.
+   * Transactions can be nested and must be balanced. LoadXMLState() and
+   * UpdateRegisteredProxies() use a transaction internally.
+   */
+  void BeginPushTransaction();
+  void CommitPushTransaction();
+  ///@}
+
   /**
    * Indicates if an XML state is currently being loaded. This may be used by
    * the application to limit updates to the GUI while state is being loaded.
@@ -19,6 +19,7 @@
 #endif
 
 #if VTK_MODULE_ENABLE_ParaView_RemotingViews
+#include "vtkPVGeometryDiskCache.h"
 #include "vtkPVView.h"
 #include "vtkPVXYChartView.h"
 #include "vtkSMChartSeriesSelectionDomain.h"
@@ -93,6 +94,29 @@ bool vtkPVGeneralSettings::GetCacheGeometryForAnimation()
 #endif
 }
 
+//----------------------------------------------------------------------------
+void vtkPVGeneralSettings::SetPrefetchNextFrameForAnimation(bool val)
+{
+  (void)val;
+#if VTK_MODULE_ENABLE_ParaView_RemotingAnimation
+  if (vtkSMAnimationScene::GetGlobalPrefetchNextFrame() != val)
+  {
+    vtkSMAnimationScene::SetGlobalPrefetchNextFrame(val);
+    this->Modified();
+  }
+#endif
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVGeneralSettings::GetPrefetchNextFrameForAnimation()
+{
+#if VTK_MODULE_ENABLE_ParaView_RemotingAnimation
+  return vtkSMAnimationScene::GetGlobalPrefetchNextFrame();
+#else
+  return false;
+#endif
+}
+
 //----------------------------------------------------------------------------
 void vtkPVGeneralSettings::SetAnimationGeometryCacheLimit(unsigned long val)
 {
@@ -103,6 +127,52 @@ void vtkPVGeneralSettings::SetAnimationGeometryCacheLimit(unsigned long val)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkPVGeneralSettings::SetGeometryDiskCacheDirectory(const std::string& directory)
+{
+  (void)directory;
+#if VTK_MODULE_ENABLE_ParaView_RemotingViews
+  if (vtkPVGeometryDiskCache::GetCacheDirectory() != directory)
+  {
+    vtkPVGeometryDiskCache::SetCacheDirectory(directory);
+    this->Modified();
+  }
+#endif
+}
+
+//----------------------------------------------------------------------------
+std::string vtkPVGeneralSettings::GetGeometryDiskCacheDirectory()
+{
+#if VTK_MODULE_ENABLE_ParaView_RemotingViews
+  return vtkPVGeometryDiskCache::GetCacheDirectory();
+#else
+  return std::string();
+#endif
+}
+
+//----------------------------------------------------------------------------
+void vtkPVGeneralSettings::SetGeometryDiskCacheLimit(unsigned long limit)
+{
+  (void)limit;
+#if VTK_MODULE_ENABLE_ParaView_RemotingViews
+  if (vtkPVGeometryDiskCache::GetCacheSizeLimit() != limit)
+  {
+    vtkPVGeometryDiskCache::SetCacheSizeLimit(limit);
+    this->Modified();
+  }
+#endif
+}
+
+//----------------------------------------------------------------------------
+unsigned long vtkPVGeneralSettings::GetGeometryDiskCacheLimit()
+{
+#if VTK_MODULE_ENABLE_ParaView_RemotingViews
+  return vtkPVGeometryDiskCache::GetCacheSizeLimit();
+#else
+  return 0;
+#endif
+}
+
 //----------------------------------------------------------------------------
 void vtkPVGeneralSettings::SetIgnoreNegativeLogAxisWarning(bool val)
 {
@@ -275,7 +345,11 @@ void vtkPVGeneralSettings::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "InterfaceLanguage: " << this->InterfaceLanguage << "\n";
   os << indent << "ScalarBarMode: " << this->ScalarBarMode << "\n";
   os << indent << "CacheGeometryForAnimation: " << this->CacheGeometryForAnimation << "\n";
+  os << indent << "PrefetchNextFrameForAnimation: " << this->GetPrefetchNextFrameForAnimation()
+     << "\n";
   os << indent << "AnimationGeometryCacheLimit: " << this->AnimationGeometryCacheLimit << "\n";
+  os << indent << "GeometryDiskCacheDirectory: " << this->GetGeometryDiskCacheDirectory() << "\n";
+  os << indent << "GeometryDiskCacheLimit: " << this->GetGeometryDiskCacheLimit() << "\n";
   os << indent << "PropertiesPanelMode: " << this->PropertiesPanelMode << "\n";
   os << indent << "LockPanels: " << this->LockPanels << "\n";
 }
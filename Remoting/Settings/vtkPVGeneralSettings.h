@@ -132,6 +132,15 @@ public:
   bool GetCacheGeometryForAnimation();
   ///@}
 
+  ///@{
+  /**
+   * Set when the next frame is to be prefetched while playing animations with
+   * geometry caching enabled.
+   */
+  void SetPrefetchNextFrameForAnimation(bool val);
+  bool GetPrefetchNextFrameForAnimation();
+  ///@}
+
   ///@{
   /**
    * Set the animation cache limit in KBs.
@@ -140,6 +149,24 @@ public:
   vtkGetMacro(AnimationGeometryCacheLimit, unsigned long);
   ///@}
 
+  ///@{
+  /**
+   * Set the directory used to persist geometry prepared for rendering across
+   * sessions. Empty (default) disables the on-disk geometry cache.
+   */
+  void SetGeometryDiskCacheDirectory(const std::string& directory);
+  std::string GetGeometryDiskCacheDirectory();
+  ///@}
+
+  ///@{
+  /**
+   * Set the maximum size, in MiB, of the on-disk geometry cache. 0 means no
+   * limit.
+   */
+  void SetGeometryDiskCacheLimit(unsigned long limit);
+  unsigned long GetGeometryDiskCacheLimit();
+  ///@}
+
   enum RealNumberNotation
   {
     MIXED = 0,
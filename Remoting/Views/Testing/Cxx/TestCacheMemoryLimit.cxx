@@ -0,0 +1,114 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Checks that, when the data cached for animation playback has a different
+// size on each rank, vtkPVView evicts the same least recently used cache keys
+// on all ranks until the largest cache fits in the memory limit.
+
+#include "vtkGeometryRepresentation.h"
+#include "vtkInitializationHelper.h"
+#include "vtkLogger.h"
+#include "vtkMultiProcessController.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPVRenderViewDataDeliveryManager.h"
+#include "vtkPVView.h"
+#include "vtkPolyData.h"
+#include "vtkProcessModule.h"
+#include "vtkSMSession.h"
+
+#include <cstdlib>
+
+namespace
+{
+// A view without rendering, to update the cache as vtkPVView::Update() does.
+class TestCacheView : public vtkPVView
+{
+public:
+  static TestCacheView* New();
+  vtkTypeMacro(TestCacheView, vtkPVView);
+
+  void StillRender() override {}
+  void InteractiveRender() override {}
+
+protected:
+  TestCacheView()
+    : vtkPVView(false)
+  {
+  }
+  ~TestCacheView() override = default;
+
+private:
+  TestCacheView(const TestCacheView&) = delete;
+  void operator=(const TestCacheView&) = delete;
+};
+vtkStandardNewMacro(TestCacheView);
+
+bool Check(bool condition, int rank, const char* message)
+{
+  if (!condition)
+  {
+    vtkLogF(ERROR, "%s (rank %d)", message, rank);
+  }
+  return condition;
+}
+}
+
+int TestCacheMemoryLimit(int argc, char* argv[])
+{
+  vtkInitializationHelper::Initialize(argc, argv, vtkProcessModule::PROCESS_BATCH);
+  vtkMultiProcessController* controller = vtkMultiProcessController::GetGlobalController();
+  const int rank = controller->GetLocalProcessId();
+  const int numberOfRanks = controller->GetNumberOfProcesses();
+
+  auto pm = vtkProcessModule::GetProcessModule();
+  vtkNew<vtkSMSession> session;
+  pm->RegisterSession(session);
+  pm->PushActiveSession(session);
+
+  int success = 1;
+  {
+    vtkNew<TestCacheView> view;
+    vtkNew<vtkPVRenderViewDataDeliveryManager> mgr;
+    view->SetDeliveryManager(mgr);
+    view->SetUseCache(true);
+
+    vtkNew<vtkGeometryRepresentation> repr;
+    repr->Initialize(1, 10);
+    repr->SetForceUseCache(true);
+    mgr->RegisterRepresentation(repr);
+
+    // each cache key takes (rank + 1) MiB, the limit only fits 2 keys on the
+    // last rank while the first rank could keep all of them.
+    const vtkTypeUInt64 size = 1024 * static_cast<vtkTypeUInt64>(rank + 1);
+    view->SetCacheMemoryLimit(2 * 1024 * static_cast<vtkTypeUInt64>(numberOfRanks));
+    const int numberOfKeys = 5;
+    for (int cc = 0; cc < numberOfKeys; ++cc)
+    {
+      view->SetCacheKey(cc);
+      repr->SetForcedCacheKey(cc);
+      vtkNew<vtkPolyData> data;
+      mgr->SetPiece(repr, data, false, size);
+      view->Update();
+    }
+
+    // keys 0, 1 and 2 are evicted everywhere.
+    success = Check(mgr->GetNumberOfCacheEntries() == 2, rank, "Expected 2 cache entries.") &&
+      Check(mgr->GetNumberOfCacheEvictions() == 3, rank, "Expected 3 evictions.") &&
+      Check(mgr->GetCacheSize() == 2 * size, rank, "Unexpected cache size.");
+    for (int cc = 0; success && cc < numberOfKeys; ++cc)
+    {
+      repr->SetForcedCacheKey(cc);
+      success = Check(mgr->HasPiece(repr) == (cc >= 3), rank, "Wrong key evicted.");
+    }
+
+    mgr->UnRegisterRepresentation(repr);
+  }
+
+  int allSuccess = 0;
+  controller->AllReduce(&success, &allSuccess, 1, vtkCommunicator::LOGICAL_AND_OP);
+  pm->PopActiveSession(session);
+  pm->UnRegisterSession(session);
+  vtkInitializationHelper::Finalize();
+  return allSuccess ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkGeometryRepresentation.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPVRenderViewDataDeliveryManager.h"
+#include "vtkPolyData.h"
+
+#include <cstdlib>
+
+#define VERIFY(x, ...)                                                                             \
+  if (!(x))                                                                                        \
+  {                                                                                                \
+    vtkLogF(ERROR, __VA_ARGS__);                                                                   \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+// Tests the least recently used bookkeeping and statistics of the cache kept
+// by vtkPVDataDeliveryManager for animation playback.
+int TestDataDeliveryCacheEviction(int, char*[])
+{
+  vtkNew<vtkPVRenderViewDataDeliveryManager> mgr;
+  vtkNew<vtkGeometryRepresentation> repr;
+  repr->Initialize(1, 10);
+  repr->SetForceUseCache(true);
+  mgr->RegisterRepresentation(repr);
+
+  // cache a piece for 5 time steps.
+  for (int cc = 0; cc < 5; ++cc)
+  {
+    repr->SetForcedCacheKey(cc);
+    mgr->MarkCacheKeyUsed(cc);
+    VERIFY(!mgr->IsCached(repr), "Unexpected cached piece for key %d.", cc);
+    vtkNew<vtkPolyData> data;
+    mgr->SetPiece(repr, data, false, 1024);
+    VERIFY(mgr->HasPiece(repr), "Missing cached piece for key %d.", cc);
+  }
+  VERIFY(mgr->GetNumberOfCacheEntries() == 5, "Expected 5 entries, got %d.",
+    mgr->GetNumberOfCacheEntries());
+  VERIFY(mgr->GetCacheSize() == 5 * 1024, "Unexpected cache size.");
+  // only the lookups done when updating are counted, not HasPiece.
+  VERIFY(mgr->GetNumberOfCacheHits() == 0 && mgr->GetNumberOfCacheMisses() == 5,
+    "Unexpected hits/misses.");
+
+  // replay key 0, key 1 becomes the least recently used one.
+  repr->SetForcedCacheKey(0);
+  mgr->MarkCacheKeyUsed(0);
+  VERIFY(mgr->IsCached(repr), "Key 0 must be cached.");
+  VERIFY(mgr->GetNumberOfCacheHits() == 1 && mgr->GetNumberOfCacheMisses() == 5,
+    "Unexpected hits/misses.");
+
+  double key = -1;
+  VERIFY(mgr->GetLeastRecentlyUsedCacheKey(0, key) && key == 1, "Expected key 1, got %g.", key);
+  mgr->EvictCacheKey(key);
+  VERIFY(mgr->GetNumberOfCacheEntries() == 4, "Expected 4 entries after eviction.");
+  VERIFY(mgr->GetNumberOfCacheEvictions() == 1, "Expected 1 eviction.");
+  VERIFY(mgr->GetLeastRecentlyUsedCacheKey(0, key) && key == 2, "Expected key 2, got %g.", key);
+
+  // the key currently in use by the representation must be preserved.
+  mgr->EvictCacheKey(0);
+  VERIFY(mgr->HasPiece(repr), "Data in use must not be evicted.");
+  VERIFY(mgr->GetNumberOfCacheEvictions() == 1, "Data in use must not be counted as evicted.");
+
+  mgr->ResetCacheStatistics();
+  VERIFY(mgr->GetNumberOfCacheHits() == 0 && mgr->GetNumberOfCacheMisses() == 0 &&
+      mgr->GetNumberOfCacheEvictions() == 0,
+    "Statistics must be reset.");
+
+  mgr->UnRegisterRepresentation(repr);
+  VERIFY(mgr->GetNumberOfCacheEntries() == 0 && mgr->GetCacheSize() == 0,
+    "Cache must be empty once the representation is removed.");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,193 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Transfers images compressed with vtkDeltaImageCompressor between two
+// vtkPVClientServerSynchronizedRenderers connected through a socket in the
+// same process. One image is dropped so that the client can't apply the next
+// changed tiles, and the client must get a key frame on the following
+// transfer.
+
+#include "vtkCommand.h"
+#include "vtkImageCompressor.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPVClientServerSynchronizedRenderers.h"
+#include "vtkServerSocket.h"
+#include "vtkSocketCommunicator.h"
+#include "vtkSocketController.h"
+#include "vtkTestErrorObserver.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <cstdlib>
+#include <thread>
+
+#define VERIFY(x, ...)                                                                             \
+  if (!(x))                                                                                        \
+  {                                                                                                \
+    vtkLogF(ERROR, __VA_ARGS__);                                                                   \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+namespace
+{
+const int Size = 256;
+
+// Only the first bytes change from one frame to the next, so that images
+// after the first one are sent as changed tiles.
+unsigned char Pixel(vtkIdType index, int frame)
+{
+  return static_cast<unsigned char>((index < 64 ? index + frame * 7 : index) % 251);
+}
+
+// Exposes the image transfer of vtkPVClientServerSynchronizedRenderers
+// without rendering anything.
+class vtkTestImageTransport : public vtkPVClientServerSynchronizedRenderers
+{
+public:
+  static vtkTestImageTransport* New();
+  vtkTypeMacro(vtkTestImageTransport, vtkPVClientServerSynchronizedRenderers);
+
+  // server side.
+  void SendImage(int frame)
+  {
+    this->MakeImage(frame);
+    this->SlaveEndRender();
+  }
+
+  // server side, compresses the image as if it was sent but never sends it.
+  void DropImage(int frame)
+  {
+    this->MakeImage(frame);
+    this->Compressor->SetImageResolution(Size, Size);
+    this->Compress(this->Frame.GetRawPtr());
+  }
+
+  // client side.
+  vtkRawImage& ReceiveImage()
+  {
+    this->Image.MarkInValid();
+    this->MasterEndRender();
+    return this->Image;
+  }
+
+  vtkImageCompressor* GetImageCompressor() const { return this->Compressor; }
+
+protected:
+  vtkTestImageTransport() = default;
+  ~vtkTestImageTransport() override = default;
+
+  vtkRawImage& CaptureRenderedImage() override { return this->Frame; }
+
+  void MakeImage(int frame)
+  {
+    this->Frame.Resize(Size, Size, 4);
+    unsigned char* pixels = this->Frame.GetRawPtr()->GetPointer(0);
+    for (vtkIdType cc = 0, max = this->Frame.GetRawPtr()->GetNumberOfValues(); cc < max; ++cc)
+    {
+      pixels[cc] = Pixel(cc, frame);
+    }
+    this->Frame.MarkValid();
+  }
+
+  vtkRawImage Frame;
+
+private:
+  vtkTestImageTransport(const vtkTestImageTransport&) = delete;
+  void operator=(const vtkTestImageTransport&) = delete;
+};
+vtkStandardNewMacro(vtkTestImageTransport);
+
+bool CheckImage(vtkSynchronizedRenderers::vtkRawImage& image, int frame)
+{
+  if (!image.IsValid() || image.GetWidth() != Size || image.GetHeight() != Size)
+  {
+    return false;
+  }
+  const unsigned char* pixels = image.GetRawPtr()->GetPointer(0);
+  for (vtkIdType cc = 0, max = image.GetRawPtr()->GetNumberOfValues(); cc < max; ++cc)
+  {
+    if (pixels[cc] != Pixel(cc, frame))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestDeltaImageKeyFrameRequest(int argc, char* argv[])
+{
+  vtkNew<vtkSocketController> serverController;
+  vtkNew<vtkSocketController> clientController;
+  serverController->Initialize(&argc, &argv);
+
+  vtkNew<vtkServerSocket> serverSocket;
+  VERIFY(serverSocket->CreateServer(0) == 0, "Could not create server socket.");
+  const int port = serverSocket->GetServerPort();
+  std::thread accept([&]() {
+    vtkSocketCommunicator::SafeDownCast(serverController->GetCommunicator())
+      ->WaitForConnection(serverSocket);
+  });
+  const int connected = clientController->ConnectTo("localhost", port);
+  accept.join();
+  VERIFY(connected == 1, "Could not connect to port %d.", port);
+
+  vtkNew<vtkTestImageTransport> server;
+  server->SetParallelController(serverController);
+  server->ConfigureCompressor("vtkDeltaImageCompressor 0 16");
+  vtkNew<vtkTestImageTransport> client;
+  client->SetParallelController(clientController);
+  client->ConfigureCompressor("vtkDeltaImageCompressor 0 16");
+
+  // the expected decompression failure is reported as an error.
+  vtkNew<vtkTest::ErrorObserver> errors;
+  client->AddObserver(vtkCommand::ErrorEvent, errors);
+  client->GetImageCompressor()->AddObserver(vtkCommand::ErrorEvent, errors);
+
+  // frame 2 is dropped, frame 3 applies to it and can't be decompressed.
+  const int numberOfFrames = 6;
+  const int droppedFrame = 2;
+  std::thread sender([&]() {
+    for (int frame = 0; frame < numberOfFrames; ++frame)
+    {
+      if (frame == droppedFrame)
+      {
+        server->DropImage(frame);
+      }
+      else
+      {
+        server->SendImage(frame);
+      }
+    }
+  });
+
+  int status = EXIT_SUCCESS;
+  for (int frame = 0; frame < numberOfFrames; ++frame)
+  {
+    if (frame == droppedFrame)
+    {
+      continue;
+    }
+    errors->Clear();
+    const bool received = CheckImage(client->ReceiveImage(), frame);
+    if (frame == droppedFrame + 1)
+    {
+      if (!errors->GetError())
+      {
+        vtkLogF(ERROR, "Changes against the dropped frame were not rejected.");
+        status = EXIT_FAILURE;
+      }
+    }
+    else if (!received || errors->GetError())
+    {
+      vtkLogF(ERROR, "Frame %d was not received correctly.", frame);
+      status = EXIT_FAILURE;
+    }
+  }
+  sender.join();
+
+  clientController->CloseConnection();
+  serverController->CloseConnection();
+  return status;
+}
@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkCellArray.h"
+#include "vtkGeometryRepresentation.h"
+#include "vtkGlyph3DRepresentation.h"
+#include "vtkLogger.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPVGeometryDiskCache.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkTestUtilities.h"
+
+#include <vtksys/SystemTools.hxx>
+
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+#define VERIFY(x, ...)                                                                             \
+  if (!(x))                                                                                        \
+  {                                                                                                \
+    vtkLogF(ERROR, __VA_ARGS__);                                                                   \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+namespace
+{
+vtkSmartPointer<vtkMultiBlockDataSet> MakeData()
+{
+  vtkNew<vtkPoints> points;
+  points->InsertNextPoint(0, 0, 0);
+  points->InsertNextPoint(1, 0, 0);
+  points->InsertNextPoint(0, 1, 0);
+  vtkNew<vtkCellArray> polys;
+  const vtkIdType ids[3] = { 0, 1, 2 };
+  polys->InsertNextCell(3, ids);
+  vtkNew<vtkPolyData> pd;
+  pd->SetPoints(points);
+  pd->SetPolys(polys);
+
+  auto mb = vtkSmartPointer<vtkMultiBlockDataSet>::New();
+  mb->SetBlock(0, pd);
+  return mb;
+}
+
+void WriteFile(const std::string& fname, const char* content)
+{
+  std::ofstream file(fname);
+  file << content;
+}
+}
+
+int TestGeometryDiskCache(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  const std::string directory = std::string(tempDir) + "/TestGeometryDiskCache";
+  delete[] tempDir;
+  vtksys::SystemTools::RemoveADirectory(directory);
+
+  const std::string inputFile = directory + "-input.txt";
+  WriteFile(inputFile, "first");
+
+  vtkNew<vtkGeometryRepresentation> repr;
+  vtkNew<vtkPVGeometryDiskCache> cache;
+  cache->SetController(nullptr);
+
+  // no signature, no caching.
+  VERIFY(cache->ComputeKey(repr, 0).empty(), "Expected empty key without signature.");
+
+  repr->SetDiskCacheSignature("sources:Reader\nFileName: input\n");
+  repr->AddDiskCacheFileName(inputFile.c_str());
+  const std::string key = cache->ComputeKey(repr, 0);
+  VERIFY(key.size() == 32, "Unexpected key '%s'.", key.c_str());
+  VERIFY(cache->ComputeKey(repr, 1).empty(), "Only port 0 can be cached.");
+
+  // representations that do not opt in are not cached.
+  vtkNew<vtkGlyph3DRepresentation> glyphs;
+  glyphs->SetDiskCacheSignature("sources:Reader\nFileName: input\n");
+  VERIFY(cache->ComputeKey(glyphs, 0).empty(), "Glyphs must not be cached.");
+
+  // parameters of the representation that affect the geometry are part of the
+  // key.
+  repr->SetTriangulate(1);
+  VERIFY(cache->ComputeKey(repr, 0) != key, "Parameters must be part of the key.");
+  repr->SetTriangulate(0);
+  VERIFY(cache->ComputeKey(repr, 0) == key, "Key must be stable.");
+
+  // disabled cache.
+  vtkPVGeometryDiskCache::SetCacheDirectory(std::string());
+  VERIFY(!cache->Store(key, MakeData()), "Store must fail when disabled.");
+
+  vtkPVGeometryDiskCache::SetCacheDirectory(directory);
+  VERIFY(cache->Load(key) == nullptr, "Unexpected hit on an empty cache.");
+  VERIFY(cache->Store(key, MakeData()), "Failed to store data.");
+
+  auto loaded = vtkMultiBlockDataSet::SafeDownCast(cache->Load(key));
+  VERIFY(loaded != nullptr && loaded->GetNumberOfBlocks() == 1, "Failed to load data.");
+  auto pd = vtkPolyData::SafeDownCast(loaded->GetBlock(0));
+  VERIFY(pd != nullptr && pd->GetNumberOfPoints() == 3 && pd->GetNumberOfCells() == 1,
+    "Loaded data does not match.");
+
+  // least recently used entries are evicted when the cache is over its limit,
+  // the entry just stored is kept.
+  const std::string filler = directory + "/filler.0.vtk";
+  WriteFile(filler, std::string(2 * 1024 * 1024, ' ').c_str());
+  vtkPVGeometryDiskCache::SetCacheSizeLimit(1);
+  VERIFY(cache->Store(key, MakeData()), "Failed to store data.");
+  VERIFY(!vtksys::SystemTools::FileExists(filler), "Least recently used entry was not evicted.");
+  VERIFY(cache->Load(key) != nullptr, "Stored entry must not be evicted.");
+  vtkPVGeometryDiskCache::SetCacheSizeLimit(10240);
+
+  // a different time is a different entry.
+  repr->SetUpdateTime(1.5);
+  VERIFY(cache->ComputeKey(repr, 0) != key, "Time must be part of the key.");
+  repr->ResetUpdateTime();
+  VERIFY(cache->ComputeKey(repr, 0) == key, "Key must be stable.");
+
+  // changing the input file invalidates the entry.
+  WriteFile(inputFile, "second version");
+  VERIFY(cache->ComputeKey(repr, 0) != key, "Modified files must change the key.");
+
+  // so does changing the pipeline.
+  repr->SetDiskCacheSignature("sources:Reader\nFileName: other\n");
+  VERIFY(repr->GetDiskCacheFileNames().empty(), "File names must be reset with the signature.");
+  VERIFY(cache->ComputeKey(repr, 0) != key, "Signature must be part of the key.");
+
+  vtkPVGeometryDiskCache::SetCacheDirectory(std::string());
+  vtksys::SystemTools::RemoveADirectory(directory);
+  vtksys::SystemTools::RemoveFile(inputFile);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Renders two small cubes at opposite corners of a box, seen in perspective
+// along the axis the cubes are spread on, and checks that the region IceT
+// composites for each rank (ICET_CONTAINED_VIEWPORT) is smaller than for a
+// single cube filling the box.
+
+#include "vtkActor.h"
+#include "vtkCamera.h"
+#include "vtkCameraPass.h"
+#include "vtkCubeSource.h"
+#include "vtkIceTCompositePass.h"
+#include "vtkLogger.h"
+#include "vtkMPIController.h"
+#include "vtkNew.h"
+#include "vtkPVDefaultPass.h"
+#include "vtkPolyDataMapper.h"
+#include "vtkRenderWindow.h"
+#include "vtkRenderer.h"
+
+#include <cstdlib>
+
+namespace
+{
+void AddCube(vtkRenderer* renderer, double xmin, double xmax, double ymin, double ymax,
+  double zmin, double zmax)
+{
+  vtkNew<vtkCubeSource> cube;
+  cube->SetBounds(xmin, xmax, ymin, ymax, zmin, zmax);
+  vtkNew<vtkPolyDataMapper> mapper;
+  mapper->SetInputConnection(cube->GetOutputPort());
+  vtkNew<vtkActor> actor;
+  actor->SetMapper(mapper);
+  renderer->AddActor(actor);
+}
+
+// Renders a frame and returns the area of the region IceT composited for the
+// local geometry.
+int RenderContainedArea(vtkRenderWindow* window, vtkIceTCompositePass* pass)
+{
+  window->Render();
+  int viewport[4];
+  pass->GetContainedViewport(viewport);
+  return viewport[2] > 0 && viewport[3] > 0 ? viewport[2] * viewport[3] : 0;
+}
+}
+
+int TestIceTContainedViewport(int argc, char* argv[])
+{
+  vtkMPIController* controller = vtkMPIController::New();
+  controller->Initialize(&argc, &argv);
+  vtkMultiProcessController::SetGlobalController(controller);
+
+  int success = 1;
+  {
+    vtkNew<vtkRenderWindow> window;
+    window->SetSize(400, 400);
+    window->SetMultiSamples(0);
+    window->SetOffScreenRendering(1);
+    vtkNew<vtkRenderer> renderer;
+    window->AddRenderer(renderer);
+
+    vtkNew<vtkIceTCompositePass> icetPass;
+    icetPass->SetController(controller);
+    vtkNew<vtkPVDefaultPass> defaultPass;
+    icetPass->SetRenderPass(defaultPass);
+    vtkNew<vtkCameraPass> cameraPass;
+    cameraPass->SetDelegatePass(icetPass);
+    renderer->SetPass(cameraPass);
+
+    vtkCamera* camera = renderer->GetActiveCamera();
+    camera->SetPosition(0, 0, 30);
+    camera->SetFocalPoint(0, 0, 0);
+    camera->SetViewUp(0, 1, 0);
+    camera->SetViewAngle(30);
+    camera->SetClippingRange(1, 100);
+
+    // the cubes are at the near right and far left corners of the box, whose
+    // near left corner projects farther than both.
+    AddCube(renderer, -5.5, -4.5, -0.5, 0.5, -5.5, -4.5);
+    AddCube(renderer, 4.5, 5.5, -0.5, 0.5, 4.5, 5.5);
+    const int sparseArea = RenderContainedArea(window, icetPass);
+
+    renderer->RemoveAllViewProps();
+    AddCube(renderer, -5.5, 5.5, -0.5, 0.5, -5.5, 5.5);
+    const int boxArea = RenderContainedArea(window, icetPass);
+
+    if (sparseArea <= 0 || sparseArea >= boxArea)
+    {
+      vtkLogF(ERROR, "Contained viewport of the sparse props (%d pixels) is not smaller than "
+                     "the one of their bounding box (%d pixels).",
+        sparseArea, boxArea);
+      success = 0;
+    }
+    renderer->SetPass(nullptr);
+  }
+
+  int allSuccess = 0;
+  controller->AllReduce(&success, &allSuccess, 1, vtkCommunicator::LOGICAL_AND_OP);
+  vtkMultiProcessController::SetGlobalController(nullptr);
+  controller->Finalize();
+  controller->Delete();
+  return allSuccess ? EXIT_SUCCESS : EXIT_FAILURE;
+}
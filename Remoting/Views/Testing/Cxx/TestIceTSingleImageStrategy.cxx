@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkDummyController.h"
+#include "vtkIceTCompositePass.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+
+#include <cstdlib>
+
+#define VERIFY(x, ...)                                                                             \
+  if (!(x))                                                                                        \
+  {                                                                                                \
+    vtkLogF(ERROR, __VA_ARGS__);                                                                   \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+namespace
+{
+const int StillSize = 400;
+const int InteractiveSize = 200;
+
+// Compositing time of each strategy, for a still and an interactive image.
+double Time(int strategy, bool still)
+{
+  switch (strategy)
+  {
+    case vtkIceTCompositePass::BINARY_SWAP:
+      return still ? 3.0 : 1.0;
+    case vtkIceTCompositePass::TREE:
+      return still ? 1.0 : 2.0;
+    default:
+      return 2.0;
+  }
+}
+
+// Exposes the strategy selection without an IceT context.
+class TestPass : public vtkIceTCompositePass
+{
+public:
+  static TestPass* New();
+  vtkTypeMacro(TestPass, vtkIceTCompositePass);
+
+  // Selects the strategy for a square image of the given size and records
+  // its compositing time, increased by `penalty`, as done for each frame.
+  int Frame(int size, double penalty = 0.0)
+  {
+    const int image_size[2] = { size, size };
+    const int strategy = this->SelectSingleImageStrategy(image_size, false);
+    this->UpdateSingleImageStrategy(Time(strategy, size == StillSize) + penalty);
+    return strategy;
+  }
+};
+vtkStandardNewMacro(TestPass);
+}
+
+int TestIceTSingleImageStrategy(int, char*[])
+{
+  // warm-up frames are given a large time, which must be ignored.
+  const double warmUp = 100.0;
+
+  vtkNew<vtkDummyController> controller;
+  vtkNew<TestPass> pass;
+  pass->SetController(controller);
+  pass->SetAutoTuneNumberOfFrames(1);
+  pass->SetSingleImageStrategy(vtkIceTCompositePass::RADIX_K);
+  VERIFY(pass->Frame(StillSize) == vtkIceTCompositePass::RADIX_K,
+    "Explicit strategy must be used as is.");
+  pass->SetSingleImageStrategy(vtkIceTCompositePass::AUTO_TUNE);
+
+  // still image: warm-up frame, then binary swap is measured.
+  VERIFY(pass->Frame(StillSize, warmUp) == vtkIceTCompositePass::BINARY_SWAP, "Wrong warm-up.");
+  VERIFY(pass->Frame(StillSize) == vtkIceTCompositePass::BINARY_SWAP, "Wrong first candidate.");
+
+  // interactive images are tuned separately, to the end.
+  VERIFY(pass->Frame(InteractiveSize, warmUp) == vtkIceTCompositePass::BINARY_SWAP,
+    "Wrong interactive warm-up.");
+  VERIFY(pass->Frame(InteractiveSize) == vtkIceTCompositePass::BINARY_SWAP &&
+      pass->Frame(InteractiveSize) == vtkIceTCompositePass::TREE &&
+      pass->Frame(InteractiveSize) == vtkIceTCompositePass::RADIX_K,
+    "Wrong interactive candidates.");
+  VERIFY(pass->Frame(InteractiveSize) == vtkIceTCompositePass::BINARY_SWAP,
+    "Wrong interactive choice.");
+
+  // back to the still image: the tuning resumes after a new warm-up frame
+  // instead of starting over.
+  VERIFY(pass->Frame(StillSize, warmUp) == vtkIceTCompositePass::TREE, "Tuning was not resumed.");
+  VERIFY(pass->Frame(StillSize) == vtkIceTCompositePass::TREE &&
+      pass->Frame(StillSize) == vtkIceTCompositePass::RADIX_K,
+    "Wrong remaining candidates.");
+  VERIFY(pass->Frame(StillSize) == vtkIceTCompositePass::TREE, "Wrong still choice.");
+
+  // both choices are reused when switching back and forth.
+  for (int cc = 0; cc < 2; ++cc)
+  {
+    VERIFY(pass->Frame(InteractiveSize, warmUp) == vtkIceTCompositePass::BINARY_SWAP,
+      "Interactive choice was not reused.");
+    VERIFY(pass->Frame(StillSize, warmUp) == vtkIceTCompositePass::TREE,
+      "Still choice was not reused.");
+  }
+
+  // another number of frames per candidate is another configuration.
+  pass->SetAutoTuneNumberOfFrames(2);
+  VERIFY(pass->Frame(StillSize, warmUp) == vtkIceTCompositePass::BINARY_SWAP,
+    "Tuning did not restart.");
+
+  pass->SetController(nullptr);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkBoundingBox.h"
+#include "vtkLogger.h"
+#include "vtkPVRenderViewDataDeliveryManager.h"
+
+#include <cstdlib>
+#include <vector>
+
+#define VERIFY(x, ...)                                                                             \
+  if (!(x))                                                                                        \
+  {                                                                                                \
+    vtkLogF(ERROR, __VA_ARGS__);                                                                   \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+namespace
+{
+bool HasBounds(const vtkBoundingBox& box, double xmin, double xmax, double ymin, double ymax,
+  double zmin, double zmax)
+{
+  return box == vtkBoundingBox(xmin, xmax, ymin, ymax, zmin, zmax);
+}
+}
+
+int TestIncrementalRedistribution(int, char*[])
+{
+  using Manager = vtkPVRenderViewDataDeliveryManager;
+  const vtkBoundingBox reference(0, 1, 0, 2, 0, 4);
+
+  // reuse: each face moved by less than the tolerance times the length along
+  // its axis.
+  VERIFY(Manager::AreBoundsClose(reference, reference, 0.0), "Same bounds must be close.");
+  VERIFY(Manager::AreBoundsClose(reference, vtkBoundingBox(-0.04, 1, 0, 2.08, 0.1, 4), 0.05),
+    "Bounds within the tolerance must be close.");
+  // rounding errors are not a change, even without tolerance.
+  VERIFY(Manager::AreBoundsClose(vtkBoundingBox(0, 0.3, 0, 1, 0, 1),
+           vtkBoundingBox(0, 0.1 + 0.2, 0, 1, 0, 1), 0.0),
+    "Rounding errors must be ignored.");
+  // flat bounds use the largest length.
+  VERIFY(Manager::AreBoundsClose(vtkBoundingBox(0, 1, 0, 1, 0, 0),
+           vtkBoundingBox(0, 1, 0, 1, -0.04, 0.04), 0.05),
+    "Flat bounds must use the largest length.");
+
+  // regeneration: a face moved farther than the tolerance.
+  VERIFY(!Manager::AreBoundsClose(reference, vtkBoundingBox(-0.06, 1, 0, 2, 0, 4), 0.05),
+    "Bounds past the tolerance on x must not be close.");
+  VERIFY(!Manager::AreBoundsClose(reference, vtkBoundingBox(0, 1, 0, 2, 0, 4.3), 0.05),
+    "Bounds past the tolerance on z must not be close.");
+  VERIFY(!Manager::AreBoundsClose(reference, vtkBoundingBox(0, 1, 0, 1, 0, 4), 0.05),
+    "Shrunk bounds must not be close.");
+  VERIFY(!Manager::AreBoundsClose(vtkBoundingBox(), reference, 0.05),
+    "Invalid bounds must not be close.");
+
+  // two cuts split along y, the x max faces differ by a rounding error.
+  const std::vector<vtkBoundingBox> initial = { vtkBoundingBox(0, 0.1 + 0.2, 0, 0.5, 0, 1),
+    vtkBoundingBox(0, 0.3, 0.5, 1, 0, 1) };
+  std::vector<vtkBoundingBox> cuts = initial;
+
+  // bounds within the cuts, up to rounding errors, leave them unchanged.
+  VERIFY(!Manager::GrowCuts(cuts, vtkBoundingBox(0.1, 0.3 + 1e-12, 0, 1, 0, 1)) && cuts == initial,
+    "Contained bounds must not change the cuts.");
+
+  // only outer faces grow.
+  VERIFY(Manager::GrowCuts(cuts, vtkBoundingBox(-0.01, 0.31, 0.2, 1.02, 0, 1)),
+    "Larger bounds must change the cuts.");
+  VERIFY(HasBounds(cuts[0], -0.01, 0.31, 0, 0.5, 0, 1), "Wrong first cut after growing.");
+  VERIFY(HasBounds(cuts[1], -0.01, 0.31, 0.5, 1.02, 0, 1), "Wrong second cut after growing.");
+
+  VERIFY(!Manager::GrowCuts(cuts, vtkBoundingBox()), "Invalid bounds must not change the cuts.");
+  return EXIT_SUCCESS;
+}
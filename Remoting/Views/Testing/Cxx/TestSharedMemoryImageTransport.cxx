@@ -0,0 +1,150 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Transfers images between two vtkPVClientServerSynchronizedRenderers
+// connected through a socket in the same process, first through the socket
+// and then through shared memory, and checks that the images received match
+// the ones sent.
+
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPVClientServerSynchronizedRenderers.h"
+#include "vtkServerSocket.h"
+#include "vtkSocketCommunicator.h"
+#include "vtkSocketController.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <cstdlib>
+#include <thread>
+
+#define VERIFY(x, ...)                                                                             \
+  if (!(x))                                                                                        \
+  {                                                                                                \
+    vtkLogF(ERROR, __VA_ARGS__);                                                                   \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+namespace
+{
+// Exposes the image transfer of vtkPVClientServerSynchronizedRenderers
+// without rendering anything.
+class vtkTestImageTransport : public vtkPVClientServerSynchronizedRenderers
+{
+public:
+  static vtkTestImageTransport* New();
+  vtkTypeMacro(vtkTestImageTransport, vtkPVClientServerSynchronizedRenderers);
+
+  // server side.
+  void SendImage(int width, int height, int frame)
+  {
+    this->Frame.Resize(width, height, 4);
+    unsigned char* pixels = this->Frame.GetRawPtr()->GetPointer(0);
+    for (vtkIdType cc = 0, max = this->Frame.GetRawPtr()->GetNumberOfValues(); cc < max; ++cc)
+    {
+      pixels[cc] = static_cast<unsigned char>((cc + frame * 7) % 251);
+    }
+    this->Frame.MarkValid();
+    this->SlaveEndRender();
+  }
+
+  // client side.
+  vtkRawImage& ReceiveImage()
+  {
+    this->Image.MarkInValid();
+    this->MasterEndRender();
+    return this->Image;
+  }
+
+protected:
+  vtkTestImageTransport() = default;
+  ~vtkTestImageTransport() override = default;
+
+  vtkRawImage& CaptureRenderedImage() override { return this->Frame; }
+
+  vtkRawImage Frame;
+
+private:
+  vtkTestImageTransport(const vtkTestImageTransport&) = delete;
+  void operator=(const vtkTestImageTransport&) = delete;
+};
+vtkStandardNewMacro(vtkTestImageTransport);
+
+bool CheckImage(vtkSynchronizedRenderers::vtkRawImage& image, int width, int height, int frame)
+{
+  if (!image.IsValid() || image.GetWidth() != width || image.GetHeight() != height)
+  {
+    return false;
+  }
+  const unsigned char* pixels = image.GetRawPtr()->GetPointer(0);
+  for (vtkIdType cc = 0, max = image.GetRawPtr()->GetNumberOfValues(); cc < max; ++cc)
+  {
+    if (pixels[cc] != static_cast<unsigned char>((cc + frame * 7) % 251))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestSharedMemoryImageTransport(int argc, char* argv[])
+{
+  vtkNew<vtkSocketController> serverController;
+  vtkNew<vtkSocketController> clientController;
+  serverController->Initialize(&argc, &argv);
+
+  vtkNew<vtkServerSocket> serverSocket;
+  VERIFY(serverSocket->CreateServer(0) == 0, "Could not create server socket.");
+  const int port = serverSocket->GetServerPort();
+  std::thread accept([&]() {
+    vtkSocketCommunicator::SafeDownCast(serverController->GetCommunicator())
+      ->WaitForConnection(serverSocket);
+  });
+  const int connected = clientController->ConnectTo("localhost", port);
+  accept.join();
+  VERIFY(connected == 1, "Could not connect to port %d.", port);
+
+  vtkNew<vtkTestImageTransport> server;
+  server->SetParallelController(serverController);
+  server->ConfigureCompressor("NULL");
+  vtkNew<vtkTestImageTransport> client;
+  client->SetParallelController(clientController);
+  client->ConfigureCompressor("NULL");
+
+  // frames 0-2 go through the socket, frames 3-9 through shared memory. The
+  // size changes at frame 6 to force a larger segment.
+  const int numberOfFrames = 10;
+  std::thread sender([&]() {
+    for (int frame = 0; frame < numberOfFrames; ++frame)
+    {
+      server->SetUseSharedMemoryImageTransport(frame >= 3);
+      const int size = frame >= 6 ? 1024 : 256;
+      server->SendImage(size, size, frame);
+    }
+  });
+
+  int status = EXIT_SUCCESS;
+  for (int frame = 0; frame < numberOfFrames; ++frame)
+  {
+    client->SetUseSharedMemoryImageTransport(frame >= 3);
+    const int size = frame >= 6 ? 1024 : 256;
+    if (!CheckImage(client->ReceiveImage(), size, size, frame))
+    {
+      vtkLogF(ERROR, "Frame %d was not received correctly.", frame);
+      status = EXIT_FAILURE;
+    }
+#if !defined(_WIN32)
+    if (client->GetSharedMemoryImageTransportActive() != (frame >= 3))
+    {
+      vtkLogF(ERROR, "Unexpected transport for frame %d.", frame);
+      status = EXIT_FAILURE;
+    }
+#endif
+  }
+  sender.join();
+
+  clientController->CloseConnection();
+  serverController->CloseConnection();
+  return status;
+}
@@ -359,6 +359,30 @@ void vtkCompositeRepresentation::SetForcedCacheKey(double val)
   this->Superclass::SetForcedCacheKey(val);
 }
 
+//----------------------------------------------------------------------------
+void vtkCompositeRepresentation::SetDiskCacheSignature(const char* signature)
+{
+  vtkInternals::RepresentationMap::iterator iter;
+  for (iter = this->Internals->Representations.begin();
+       iter != this->Internals->Representations.end(); iter++)
+  {
+    iter->second.GetPointer()->SetDiskCacheSignature(signature);
+  }
+  this->Superclass::SetDiskCacheSignature(signature);
+}
+
+//----------------------------------------------------------------------------
+void vtkCompositeRepresentation::AddDiskCacheFileName(const char* fname)
+{
+  vtkInternals::RepresentationMap::iterator iter;
+  for (iter = this->Internals->Representations.begin();
+       iter != this->Internals->Representations.end(); iter++)
+  {
+    iter->second.GetPointer()->AddDiskCacheFileName(fname);
+  }
+  this->Superclass::AddDiskCacheFileName(fname);
+}
+
 //----------------------------------------------------------------------------
 vtkDataObject* vtkCompositeRepresentation::GetRenderedDataObject(int port)
 {
@@ -106,6 +106,8 @@ public:
   void SetUpdateTime(double time) override;
   void SetForceUseCache(bool val) override;
   void SetForcedCacheKey(double val) override;
+  void SetDiskCacheSignature(const char* signature) override;
+  void AddDiskCacheFileName(const char* fname) override;
   ///@}
 
 protected:
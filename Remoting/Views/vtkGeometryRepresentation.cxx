@@ -54,6 +54,7 @@
 
 #include <memory>
 #include <numeric>
+#include <sstream>
 #include <tuple>
 #include <vector>
 
@@ -329,6 +330,31 @@ int vtkGeometryRepresentation::GetBlockColorsDistinctValues()
   return 2;
 }
 
+//----------------------------------------------------------------------------
+std::string vtkGeometryRepresentation::GetDiskCacheParameters()
+{
+  vtkPVGeometryFilter* geomFilter = vtkPVGeometryFilter::SafeDownCast(this->GeometryFilter);
+  if (!geomFilter)
+  {
+    return std::string();
+  }
+
+  std::ostringstream stream;
+  stream << "UseOutline: " << geomFilter->GetUseOutline() << "\n"
+         << "Triangulate: " << geomFilter->GetTriangulate() << "\n"
+         << "NonlinearSubdivisionLevel: " << geomFilter->GetNonlinearSubdivisionLevel() << "\n"
+         << "GenerateFeatureEdges: " << geomFilter->GetGenerateFeatureEdges() << "\n"
+         << "BlockColorsDistinctValues: " << geomFilter->GetBlockColorsDistinctValues() << "\n";
+  for (int idx = 0; idx < 3; ++idx)
+  {
+    // normals, texture coordinates and tangents, see SetPointArrayToProcess.
+    vtkInformation* info = this->MultiBlockMaker->GetInputArrayInformation(idx);
+    const char* name = info ? info->Get(vtkDataObject::FIELD_NAME()) : nullptr;
+    stream << "PointArrayToProcess " << idx << ": " << (name ? name : "") << "\n";
+  }
+  return stream.str();
+}
+
 //----------------------------------------------------------------------------
 void vtkGeometryRepresentation::SetBlockColorsDistinctValues(int distinctValues)
 {
@@ -394,7 +420,8 @@ int vtkGeometryRepresentation::ProcessViewRequest(
     // information for resetting camera and clip planes. Since this
     // representation allows users to transform the geometry, we need to ensure
     // that the bounds we report include the transformation as well.
-    this->ComputeVisibleDataBounds();
+    auto piece = vtkPVView::GetPiece(inInfo, this);
+    this->ComputeVisibleDataBounds(piece ? piece : this->MultiBlockMaker->GetOutputDataObject(0));
 
     vtkNew<vtkMatrix4x4> matrix;
     this->Actor->GetMatrix(matrix);
@@ -1357,6 +1384,19 @@ void vtkGeometryRepresentation::SetGenerateFeatureEdges(bool val)
   this->MarkModified();
 }
 
+//----------------------------------------------------------------------------
+void vtkGeometryRepresentation::SetExecuteBlocksInParallel(bool val)
+{
+  if (vtkPVGeometryFilter::SafeDownCast(this->GeometryFilter))
+  {
+    vtkPVGeometryFilter::SafeDownCast(this->GeometryFilter)->SetExecuteBlocksInParallel(val);
+  }
+
+  // since geometry filter needs to execute, we need to mark the representation
+  // modified.
+  this->MarkModified();
+}
+
 //----------------------------------------------------------------------------
 void vtkGeometryRepresentation::AddBlockSelector(const char* selector)
 {
@@ -1622,9 +1662,12 @@ void vtkGeometryRepresentation::SetMaterial(const char* val)
 }
 
 //----------------------------------------------------------------------------
-void vtkGeometryRepresentation::ComputeVisibleDataBounds()
+void vtkGeometryRepresentation::ComputeVisibleDataBounds(vtkDataObject* outputData)
 {
+  // data loaded from the disk cache is newer than the bounds even though the
+  // representation itself did not execute.
   if (this->VisibleDataBoundsTime < this->GetPipelineDataTime() ||
+    (outputData && this->VisibleDataBoundsTime < outputData->GetMTime()) ||
     (this->BlockAttrChanged && this->VisibleDataBoundsTime < this->BlockAttributeTime))
   {
     // If the input data is a composite dataset, use the currently set values for block
@@ -1633,7 +1676,6 @@ void vtkGeometryRepresentation::ComputeVisibleDataBounds()
     // REQUEST_RENDER pass.  This constructs a dummy vtkCompositeDataDisplayAttributes
     // with only the visibilities set and calls the helper function to compute the visible
     // bounds with that.
-    vtkDataObject* outputData = this->MultiBlockMaker->GetOutputDataObject(0);
     vtkNew<vtkCompositeDataDisplayAttributes> cdAttributes;
     this->PopulateBlockAttributes(cdAttributes, outputData);
     this->GetBounds(outputData, this->VisibleDataBounds, cdAttributes);
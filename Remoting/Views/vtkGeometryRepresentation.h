@@ -72,6 +72,13 @@ public:
   int GetBlockColorsDistinctValues();
   ///@}
 
+  /**
+   * Overridden to opt in to the on-disk geometry cache. The parameters are
+   * those forwarded to vtkPVGeometryFilter along with the normal, texture
+   * coordinates and tangent arrays.
+   */
+  std::string GetDiskCacheParameters() override;
+
   /**
    * Enable/Disable LOD;
    */
@@ -165,6 +172,7 @@ public:
   void SetTriangulate(int);
   void SetNonlinearSubdivisionLevel(int);
   virtual void SetGenerateFeatureEdges(bool);
+  void SetExecuteBlocksInParallel(bool);
 
   //***************************************************************************
   // Forwarded to vtkProperty.
@@ -424,9 +432,11 @@ protected:
 
   /**
    * Computes the bounds of the visible data based on the block visibilities in the
-   * composite data attributes of the mapper.
+   * composite data attributes of the mapper. `outputData` is the data handed
+   * over to the view which may have been loaded from the view's cache instead
+   * of being produced by this representation.
    */
-  void ComputeVisibleDataBounds();
+  void ComputeVisibleDataBounds(vtkDataObject* outputData);
 
   /**
    * Update the mapper with the shader replacement strings if feature is enabled.
@@ -25,6 +25,13 @@ public:
   int ProcessViewRequest(vtkInformationRequestKey* request_type, vtkInformation* inInfo,
     vtkInformation* outInfo) override;
 
+  /**
+   * The original data bounds are extracted in RequestData which does not
+   * execute when data is loaded from disk, hence the on-disk geometry cache is
+   * not supported.
+   */
+  std::string GetDiskCacheParameters() override { return std::string(); }
+
   enum
   {
     X_SLICE_ONLY,
@@ -34,6 +34,12 @@ public:
   int ProcessViewRequest(vtkInformationRequestKey* request_type, vtkInformation* inInfo,
     vtkInformation* outInfo) override;
 
+  /**
+   * Glyphs are handed over to the view on a second port, hence the on-disk
+   * geometry cache is not supported.
+   */
+  std::string GetDiskCacheParameters() override { return std::string(); }
+
   /**
    * Toggle the visibility of the original mesh.
    * If this->GetVisibility() is false, then this has no effect.
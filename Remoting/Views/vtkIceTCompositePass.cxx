@@ -4,6 +4,7 @@
 
 #include "vtkBoundingBox.h"
 #include "vtkCameraPass.h"
+#include "vtkCommunicator.h"
 #include "vtkFloatArray.h"
 #include "vtkFrameBufferObjectBase.h"
 #include "vtkHardwareSelector.h"
@@ -33,7 +34,14 @@
 
 #include <IceT.h>
 #include <IceTGL.h>
+#include <vtksys/SystemTools.hxx>
+
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <map>
+#include <string>
+#include <vector>
 
 #include "vtkCompositeZPassFS.h"
 #include "vtkOpenGLHelper.h"
@@ -53,6 +61,31 @@ struct vtkIceTCompositePass::IceTDrawParams
   IceTImage Result;
 };
 
+// state of the single image strategy tuning, see
+// vtkIceTCompositePass::SetSingleImageStrategy.
+struct vtkIceTCompositePass::AutoTuneInternals
+{
+  struct State
+  {
+    // index of the candidate being measured, the number of candidates once
+    // tuning is done.
+    int Candidate = 0;
+    int Frames = 0;
+    // true when the next frame must not be measured.
+    bool WarmUp = true;
+    std::vector<double> Times;
+    int Chosen = vtkIceTCompositePass::AUTOMATIC;
+  };
+
+  // States keyed by global viewport size, number of ranks, tile dimensions,
+  // ordered compositing, float compositing and frames per candidate, so that
+  // switching between interactive (reduced) and still renders doesn't restart
+  // the tuning of either size.
+  std::map<std::array<int, 8>, State> States;
+  const std::array<int, 8>* Configuration = nullptr;
+  State* Current = nullptr;
+};
+
 namespace
 {
 static vtkIceTCompositePass* IceTDrawCallbackHandle = nullptr;
@@ -73,32 +106,111 @@ void IceTDrawCallback(const IceTDouble* projection_matrix, const IceTDouble* mod
   }
 }
 
-void MergeCubeAxesBounds(double bounds[6], const vtkRenderState* rState)
+// strategies measured when auto tuning.
+constexpr std::array<int, 3> AutoTuneCandidates = { vtkIceTCompositePass::BINARY_SWAP,
+  vtkIceTCompositePass::TREE, vtkIceTCompositePass::RADIX_K };
+
+IceTEnum GetIceTSingleImageStrategy(int strategy)
+{
+  switch (strategy)
+  {
+    case vtkIceTCompositePass::BINARY_SWAP:
+      return ICET_SINGLE_IMAGE_STRATEGY_BSWAP;
+    case vtkIceTCompositePass::TREE:
+      return ICET_SINGLE_IMAGE_STRATEGY_TREE;
+    case vtkIceTCompositePass::RADIX_K:
+      return ICET_SINGLE_IMAGE_STRATEGY_RADIXK;
+    default:
+      return ICET_SINGLE_IMAGE_STRATEGY_AUTOMATIC;
+  }
+}
+
+const char* GetSingleImageStrategyName(int strategy)
 {
-  vtkBoundingBox bbox(bounds);
+  switch (strategy)
+  {
+    case vtkIceTCompositePass::BINARY_SWAP:
+      return "binary-swap";
+    case vtkIceTCompositePass::TREE:
+      return "tree";
+    case vtkIceTCompositePass::RADIX_K:
+      return "radix-k";
+    case vtkIceTCompositePass::AUTO_TUNE:
+      return "auto-tune";
+    default:
+      return "automatic";
+  }
+}
+
+int GetDefaultSingleImageStrategy()
+{
+  const char* env = vtksys::SystemTools::GetEnv("PV_ICET_SINGLE_IMAGE_STRATEGY");
+  const std::string name = env ? vtksys::SystemTools::LowerCase(env) : std::string();
+  if (name == "bswap")
+  {
+    return vtkIceTCompositePass::BINARY_SWAP;
+  }
+  else if (name == "tree")
+  {
+    return vtkIceTCompositePass::TREE;
+  }
+  else if (name == "radixk")
+  {
+    return vtkIceTCompositePass::RADIX_K;
+  }
+  else if (name == "auto")
+  {
+    return vtkIceTCompositePass::AUTO_TUNE;
+  }
+  return vtkIceTCompositePass::AUTOMATIC;
+}
 
-  // Hande CubeAxes specifically has it wrongly implement the GetBounds()
+// Collects the corners of the bounds of each prop rendered on this rank. IceT
+// projects them to find the region of the image the rank contributes to, and
+// skips the rest of the image when compositing. That region is a single
+// rectangle containing all the projected vertices, so it still spans the gaps
+// between isolated parts. Passing the corners of each prop rather than those
+// of the union of their bounds only keeps it from growing to the corners of
+// the union box that no prop occupies, which perspective and oblique views
+// project farther out.
+void CollectBoundingVertices(const vtkRenderState* rState, std::vector<IceTDouble>& vertices)
+{
+  vertices.clear();
   for (int cc = 0; cc < rState->GetPropArrayCount(); cc++)
   {
     vtkProp* prop = rState->GetPropArray()[cc];
-    if (prop->GetVisibility() && prop->GetUseBounds())
+    if (!prop->GetVisibility() || !prop->GetUseBounds())
     {
-      if (prop->IsA("vtkGridAxes3DActor") || prop->IsA("vtkCubeAxesActor"))
-      {
-        vtkProp3D* prop3D = static_cast<vtkProp3D*>(prop);
-        vtkBoundingBox box(prop3D->GetBounds());
-        // This is the same trick used by vtkCubeAxesActor::GetRenderedBounds():
-        if (box.IsValid())
-        {
-          box.Inflate(box.GetMaxLength());
-          box.GetBounds(bounds);
-          bbox.AddBounds(bounds);
-        }
-      }
+      continue;
+    }
+    // skip props with unknown or infinite bounds, as
+    // vtkRenderer::ComputeVisiblePropBounds() does.
+    const double* bounds = prop->GetBounds();
+    if (!bounds || bounds[0] <= -VTK_DOUBLE_MAX || bounds[1] >= VTK_DOUBLE_MAX ||
+      bounds[2] <= -VTK_DOUBLE_MAX || bounds[3] >= VTK_DOUBLE_MAX ||
+      bounds[4] <= -VTK_DOUBLE_MAX || bounds[5] >= VTK_DOUBLE_MAX)
+    {
+      continue;
+    }
+    vtkBoundingBox box(bounds);
+    if (!box.IsValid())
+    {
+      continue;
+    }
+    // vtkCubeAxesActor overrides GetBounds() to return the inner bounds rather
+    // than the prop bounds, which results in BUG# 13469. Hence, we inflate its
+    // bounds using the same trick as vtkCubeAxesActor::GetRenderedBounds().
+    if (prop->IsA("vtkGridAxes3DActor") || prop->IsA("vtkCubeAxesActor"))
+    {
+      box.Inflate(box.GetMaxLength());
+    }
+    for (int corner = 0; corner < 8; ++corner)
+    {
+      double point[3];
+      box.GetCorner(corner, point);
+      vertices.insert(vertices.end(), point, point + 3);
     }
   }
-
-  bbox.GetBounds(bounds);
 }
 
 } // end of namespace
@@ -117,11 +229,16 @@ vtkIceTCompositePass::vtkIceTCompositePass()
   this->RenderPass = nullptr;
   this->OrderedCompositingHelper = nullptr;
   this->TileMullions[0] = this->TileMullions[1] = 0;
+  this->ContainedViewport[0] = this->ContainedViewport[1] = 0;
+  this->ContainedViewport[2] = this->ContainedViewport[3] = 0;
   this->TileDimensions[0] = 1;
   this->TileDimensions[1] = 1;
 
   this->DataReplicatedOnAllProcesses = false;
   this->ImageReductionFactor = 1;
+  this->SingleImageStrategy = GetDefaultSingleImageStrategy();
+  this->AutoTuneNumberOfFrames = 3;
+  this->AutoTune.reset(new AutoTuneInternals());
 
   this->RenderEmptyImages = false;
   this->UseOrderedCompositing = false;
@@ -213,6 +330,13 @@ void vtkIceTCompositePass::SetupContext(const vtkRenderState* render_state)
   const bool use_ordered_compositing =
     (this->OrderedCompositingHelper && this->UseOrderedCompositing);
 
+  // Set the algorithm used to composite the image, or each tile.
+  IceTInt global_viewport[4];
+  icetGetIntegerv(ICET_GLOBAL_VIEWPORT, global_viewport);
+  const int image_size[2] = { global_viewport[2], global_viewport[3] };
+  icetSingleImageStrategy(GetIceTSingleImageStrategy(
+    this->SelectSingleImageStrategy(image_size, use_ordered_compositing)));
+
   IceTEnum const format =
     this->EnableFloatValuePass ? ICET_IMAGE_COLOR_RGBA_FLOAT : ICET_IMAGE_COLOR_RGBA_UBYTE;
 
@@ -264,14 +388,14 @@ void vtkIceTCompositePass::SetupContext(const vtkRenderState* render_state)
     icetDisable(ICET_ORDERED_COMPOSITE);
   }
 
-  // Let IceT know the data bounds. This allows IceT to make smarter compositing
-  // decisions.
-  double allBounds[6];
-  render_state->GetRenderer()->ComputeVisiblePropBounds(allBounds);
+  // Let IceT know the bounds of the local geometry. This allows IceT to make
+  // smarter compositing decisions and to skip empty regions of the image.
+  std::vector<IceTDouble> vertices;
+  CollectBoundingVertices(render_state, vertices);
 
   // Try to detect when bounds are empty and try to let IceT know that
   // nothing is in bounds.
-  if (allBounds[0] > allBounds[1])
+  if (vertices.empty())
   {
     vtkDebugMacro("nothing visible" << endl);
     IceTFloat tmp = VTK_FLOAT_MAX;
@@ -279,16 +403,8 @@ void vtkIceTCompositePass::SetupContext(const vtkRenderState* render_state)
   }
   else
   {
-    // ComputeVisiblePropBounds() includes bounds from all props, however it
-    // cannot include the "real" bounds from vtkCubeAxesActor. Thanks to
-    // vtkCubeAxesActor overriding the 'GetBounds' method to return the inner
-    // bounds rather that the prop  bounds for the actor. That results in BUG#
-    // 13469. Hence, to overcome that issue, we iterate over the props to locate
-    // vtkCubeAxesActor and include the outer bounds.
-    MergeCubeAxesBounds(allBounds, render_state);
-
-    icetBoundingBoxd(
-      allBounds[0], allBounds[1], allBounds[2], allBounds[3], allBounds[4], allBounds[5]);
+    icetBoundingVertices(3, ICET_DOUBLE, 0, static_cast<IceTSizeType>(vertices.size() / 3),
+      vertices.data());
   }
 
   if (this->DataReplicatedOnAllProcesses)
@@ -329,6 +445,107 @@ void vtkIceTCompositePass::SetupContext(const vtkRenderState* render_state)
   vtkOpenGLCheckErrorMacro("failed after SetupContext");
 }
 
+//----------------------------------------------------------------------------
+int vtkIceTCompositePass::SelectSingleImageStrategy(
+  const int image_size[2], bool use_ordered_compositing)
+{
+  auto& internals = *this->AutoTune;
+  if (this->SingleImageStrategy != AUTO_TUNE)
+  {
+    internals.Configuration = nullptr;
+    internals.Current = nullptr;
+    return this->SingleImageStrategy;
+  }
+
+  // All values are identical on all ranks so that they all switch states on
+  // the same frame.
+  const std::array<int, 8> configuration = { image_size[0], image_size[1],
+    this->Controller->GetNumberOfProcesses(), this->TileDimensions[0], this->TileDimensions[1],
+    use_ordered_compositing ? 1 : 0, this->EnableFloatValuePass ? 1 : 0,
+    this->AutoTuneNumberOfFrames };
+
+  const int numCandidates = static_cast<int>(AutoTuneCandidates.size());
+  auto iter = internals.States.find(configuration);
+  if (iter == internals.States.end())
+  {
+    // Keep the number of states bounded when the window is resized often.
+    if (internals.States.size() >= 16)
+    {
+      internals.States.clear();
+    }
+    vtkVLogF(PARAVIEW_LOG_RENDERING_VERBOSITY(),
+      "tuning IceT single image strategy for %dx%d image on %d ranks", image_size[0],
+      image_size[1], configuration[2]);
+    iter = internals.States.emplace(configuration, AutoTuneInternals::State()).first;
+    iter->second.Times.assign(AutoTuneCandidates.size(), 0.0);
+  }
+  else if (&iter->second != internals.Current && iter->second.Candidate < numCandidates)
+  {
+    // Resuming an unfinished tuning: buffers are reallocated for this size.
+    iter->second.WarmUp = true;
+  }
+  internals.Configuration = &iter->first;
+  internals.Current = &iter->second;
+
+  const auto& state = iter->second;
+  if (state.Candidate >= numCandidates)
+  {
+    return state.Chosen;
+  }
+  return AutoTuneCandidates[state.Candidate];
+}
+
+//----------------------------------------------------------------------------
+void vtkIceTCompositePass::UpdateSingleImageStrategy(double composite_time)
+{
+  auto& internals = *this->AutoTune;
+  const int numCandidates = static_cast<int>(AutoTuneCandidates.size());
+  if (this->SingleImageStrategy != AUTO_TUNE || internals.Current == nullptr ||
+    internals.Current->Candidate >= numCandidates)
+  {
+    return;
+  }
+
+  // The first frame after a configuration change also pays for allocating
+  // IceT buffers; don't count it.
+  auto& state = *internals.Current;
+  if (state.WarmUp)
+  {
+    state.WarmUp = false;
+    return;
+  }
+
+  state.Times[state.Candidate] += composite_time;
+  if (++state.Frames < this->AutoTuneNumberOfFrames)
+  {
+    return;
+  }
+  state.Frames = 0;
+  if (++state.Candidate < numCandidates)
+  {
+    return;
+  }
+
+  // The slowest rank determines the frame time, and all ranks must agree on
+  // the strategy.
+  std::vector<double> times(state.Times.size(), 0.0);
+  this->Controller->AllReduce(state.Times.data(), times.data(),
+    static_cast<vtkIdType>(times.size()), vtkCommunicator::MAX_OP);
+  const auto fastest = std::min_element(times.begin(), times.end()) - times.begin();
+  state.Chosen = AutoTuneCandidates[fastest];
+
+  for (int cc = 0; cc < numCandidates; ++cc)
+  {
+    vtkVLogF(PARAVIEW_LOG_RENDERING_VERBOSITY(), "IceT %s composite time: %lf",
+      GetSingleImageStrategyName(AutoTuneCandidates[cc]),
+      times[cc] / this->AutoTuneNumberOfFrames);
+  }
+  vtkVLogF(PARAVIEW_LOG_RENDERING_VERBOSITY(),
+    "using IceT %s single image strategy for %dx%d image on %d ranks",
+    GetSingleImageStrategyName(state.Chosen), (*internals.Configuration)[0],
+    (*internals.Configuration)[1], (*internals.Configuration)[2]);
+}
+
 //----------------------------------------------------------------------------
 void vtkIceTCompositePass::CleanupContext(const vtkRenderState*) {}
 
@@ -381,6 +598,13 @@ void vtkIceTCompositePass::Render(const vtkRenderState* render_state)
     icetDrawFrame(this->Projection->Element[0], this->ModelView->Element[0], background);
   vtkOpenGLRenderUtilities::MarkDebugEvent("vtkIceTCompositePass: icetDrawFrame End");
 
+  IceTInt contained_viewport[4];
+  icetGetIntegerv(ICET_CONTAINED_VIEWPORT, contained_viewport);
+  std::copy(contained_viewport, contained_viewport + 4, this->ContainedViewport);
+  vtkVLogF(PARAVIEW_LOG_RENDERING_VERBOSITY(), "local geometry covers %dx%d of %dx%d pixels",
+    std::max(contained_viewport[2], 0), std::max(contained_viewport[3], 0), global_viewport[2],
+    global_viewport[3]);
+
   IceTDrawCallbackHandle = nullptr;
   IceTDrawCallbackState = nullptr;
 
@@ -446,6 +670,7 @@ void vtkIceTCompositePass::Render(const vtkRenderState* render_state)
   icetGetDoublev(ICET_COMPOSITE_TIME, &val);
   vtkTimerLog::InsertTimedEvent("ICET_COMPOSITE_TIME", val, 0);
   vtkVLogF(PARAVIEW_LOG_RENDERING_VERBOSITY(), "ICET_COMPOSITE_TIME: %lf", val);
+  this->UpdateSingleImageStrategy(val);
   icetGetDoublev(ICET_BLEND_TIME, &val);
   vtkTimerLog::InsertTimedEvent("ICET_BLEND_TIME", val, 0);
   vtkVLogF(PARAVIEW_LOG_RENDERING_VERBOSITY(), "ICET_BLEND_TIME: %lf", val);
@@ -870,6 +1095,9 @@ void vtkIceTCompositePass::PrintSelf(ostream& os, vtkIndent indent)
      << endl;
   os << indent << "DataReplicatedOnAllProcesses: " << this->DataReplicatedOnAllProcesses << endl;
   os << indent << "ImageReductionFactor: " << this->ImageReductionFactor << endl;
+  os << indent << "SingleImageStrategy: " << GetSingleImageStrategyName(this->SingleImageStrategy)
+     << endl;
+  os << indent << "AutoTuneNumberOfFrames: " << this->AutoTuneNumberOfFrames << endl;
   os << indent << "OrderedCompositingHelper: " << this->OrderedCompositingHelper << endl;
   os << indent << "UseOrderedCompositing: " << this->UseOrderedCompositing << endl;
   os << indent << "DisplayRGBAResults: " << this->DisplayRGBAResults << endl;
@@ -160,6 +160,55 @@ public:
   vtkBooleanMacro(UseOrderedCompositing, bool);
   ///@}
 
+  /**
+   * Algorithms IceT can use to composite a single image, i.e. the whole image
+   * or, in tile-display mode, each tile.
+   */
+  enum SingleImageStrategies
+  {
+    AUTOMATIC = 0,
+    BINARY_SWAP = 1,
+    TREE = 2,
+    RADIX_K = 3,
+    AUTO_TUNE = 4
+  };
+
+  ///@{
+  /**
+   * Get/Set the algorithm used to composite a single image. AUTOMATIC lets
+   * IceT choose. AUTO_TUNE uses BINARY_SWAP, TREE and RADIX_K in turn for
+   * AutoTuneNumberOfFrames frames each and then keeps the one with the
+   * smallest compositing time on the slowest rank. The choice is made
+   * separately for each image size, number of ranks, tile layout and
+   * compositing mode, and kept when switching between them, e.g. between
+   * interactive and still renders. The chosen algorithm is reported with the
+   * `PARAVIEW_LOG_RENDERING_VERBOSITY()`.
+   *
+   * This must be the same on all ranks. Initial value is AUTOMATIC, unless the
+   * `PV_ICET_SINGLE_IMAGE_STRATEGY` environment variable is set to one of
+   * `bswap`, `tree`, `radixk` or `auto`.
+   */
+  vtkSetClampMacro(SingleImageStrategy, int, AUTOMATIC, AUTO_TUNE);
+  vtkGetMacro(SingleImageStrategy, int);
+  ///@}
+
+  ///@{
+  /**
+   * Get/Set the number of frames over which each algorithm is measured when
+   * SingleImageStrategy is AUTO_TUNE. Initial value is 3.
+   */
+  vtkSetClampMacro(AutoTuneNumberOfFrames, int, 1, VTK_INT_MAX);
+  vtkGetMacro(AutoTuneNumberOfFrames, int);
+  ///@}
+
+  /**
+   * Returns the region of the image, as x, y, width and height in pixels, that
+   * the local geometry covered in the last frame. This is the region IceT
+   * composites for this process (`ICET_CONTAINED_VIEWPORT`); its width and
+   * height are 0 or negative when nothing was visible.
+   */
+  vtkGetVector4Macro(ContainedViewport, int);
+
   /**
    * Returns the last rendered tile from this process, if any.
    * Image is invalid if tile is not available on the current process.
@@ -254,6 +303,20 @@ protected:
    */
   void UpdateMatrices(const vtkRenderState*, double aspect);
 
+  /**
+   * Returns the single image strategy to use for the next frame, given the
+   * size of the global viewport. When auto tuning, the measurements and the
+   * choice are kept for each configuration: switching back to a configuration
+   * resumes its tuning, or reuses its choice if tuning is done.
+   */
+  int SelectSingleImageStrategy(const int image_size[2], bool use_ordered_compositing);
+
+  /**
+   * Records the compositing time of the last frame when auto tuning and picks
+   * the fastest strategy once all of them have been measured.
+   */
+  void UpdateSingleImageStrategy(double composite_time);
+
   vtkMultiProcessController* Controller;
   vtkOrderedCompositingHelper* OrderedCompositingHelper;
   vtkRenderPass* RenderPass;
@@ -265,8 +328,11 @@ protected:
   bool EnableFloatValuePass;
   int TileDimensions[2];
   int TileMullions[2];
+  int ContainedViewport[4];
 
   int ImageReductionFactor;
+  int SingleImageStrategy;
+  int AutoTuneNumberOfFrames;
 
   bool DisplayRGBAResults;
   bool DisplayDepthResults;
@@ -288,6 +354,9 @@ private:
   vtkNew<vtkMatrix4x4> ModelView;
   vtkNew<vtkMatrix4x4> Projection;
   vtkNew<vtkMatrix4x4> IceTProjection;
+
+  struct AutoTuneInternals;
+  std::unique_ptr<AutoTuneInternals> AutoTune;
 };
 
 #endif
@@ -3,10 +3,12 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkPVClientServerSynchronizedRenderers.h"
 
+#include "vtkDeltaImageCompressor.h"
 #include "vtkLZ4Compressor.h"
 #include "vtkMultiProcessController.h"
 #include "vtkObjectFactory.h"
 #include "vtkOpenGLRenderer.h"
+#include "vtkPVSession.h"
 #include "vtkSquirtCompressor.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkZlibImageCompressor.h"
@@ -14,8 +16,283 @@
 #include "vtkNvPipeCompressor.h"
 #endif
 
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <atomic>
 #include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <random>
 #include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+enum
+{
+  IMAGE_TAG = 0x023430,
+  SHARED_MEMORY_ACK_TAG = 0x023431,
+  KEY_FRAME_REQUEST_TAG = 0x023432
+};
+
+// Values for the first component of the header sent for each frame.
+enum HeaderType
+{
+  NO_IMAGE = 0,
+  SOCKET_IMAGE = 1,
+  SHARED_MEMORY_IMAGE = 2,
+  SHARED_MEMORY_OFFER = 3
+};
+
+// Images sent through shared memory bypass the compressor, and images the
+// client failed to decompress are lost. Compressors that rely on the previously
+// transferred image must start over with a key frame on both sides.
+void ResetCompressorReference(vtkImageCompressor* compressor)
+{
+  if (auto delta = vtkDeltaImageCompressor::SafeDownCast(compressor))
+  {
+    delta->ResetReference();
+  }
+}
+
+std::string GetLocalHostName()
+{
+#if !defined(_WIN32)
+  char name[256];
+  if (gethostname(name, sizeof(name)) == 0)
+  {
+    name[sizeof(name) - 1] = '\0';
+    return name;
+  }
+#endif
+  return std::string();
+}
+}
+
+//----------------------------------------------------------------------------
+// Manages the shared-memory segment used to hand images over from the server
+// to the client when both run on the same host. The segment starts with a
+// small header followed by `NumberOfSlots` image slots used as a ring buffer.
+// Only the server writes to the segment. Each slot has a sequence number that
+// is odd while the server writes to it, which lets the client detect a slot
+// that was overwritten while it was reading. The client also acknowledges each
+// image before the server renders the next one, so that does not happen in
+// practice.
+class vtkPVClientServerSynchronizedRenderers::vtkInternals
+{
+public:
+  enum class TransportState
+  {
+    UNKNOWN,
+    ACTIVE,
+    UNAVAILABLE
+  };
+
+  struct SegmentHeader
+  {
+    std::uint64_t Magic;
+    std::uint64_t Nonce;
+    std::uint64_t SlotSize;
+    std::uint64_t NumberOfSlots;
+    std::atomic<std::uint64_t> Sequences[2];
+  };
+
+  static constexpr std::uint64_t Magic = 0x70765f696d616765; // "pv_image"
+  static constexpr std::uint64_t NumberOfSlots = 2;
+  static constexpr std::size_t SlotsOffset = 64;
+  static_assert(sizeof(SegmentHeader) <= SlotsOffset, "header must fit before the slots");
+  static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+    "sequence numbers must be lock free to be shared across processes");
+
+  TransportState State = TransportState::UNKNOWN;
+  std::string SegmentName;
+  void* Mapping = nullptr;
+  std::size_t MappingSize = 0;
+  std::uint64_t SlotSize = 0;
+  unsigned int NextSlot = 0;
+  std::uint64_t NextSequence = 0;
+
+  ~vtkInternals() { this->Release(); }
+
+  // Called on the server to create (and map) a new segment.
+  bool Create(std::uint64_t slotSize, std::uint64_t nonce)
+  {
+    this->Release();
+#if !defined(_WIN32)
+    static std::atomic<unsigned int> counter(0);
+    std::ostringstream name;
+    name << "/paraview-image-" << getpid() << "-" << counter++;
+
+    const std::size_t size = SlotsOffset + NumberOfSlots * slotSize;
+    int fd = shm_open(name.str().c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+    if (fd == -1)
+    {
+      return false;
+    }
+    this->SegmentName = name.str();
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0)
+    {
+      close(fd);
+      this->Unlink();
+      return false;
+    }
+    void* mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED)
+    {
+      this->Unlink();
+      return false;
+    }
+    this->Mapping = mapping;
+    this->MappingSize = size;
+    this->SlotSize = slotSize;
+    this->NextSlot = 0;
+
+    auto header = reinterpret_cast<SegmentHeader*>(this->Mapping);
+    header->Magic = Magic;
+    header->Nonce = nonce;
+    header->SlotSize = slotSize;
+    header->NumberOfSlots = NumberOfSlots;
+    for (auto& sequence : header->Sequences)
+    {
+      new (&sequence) std::atomic<std::uint64_t>(0);
+    }
+    return true;
+#else
+    (void)slotSize;
+    (void)nonce;
+    return false;
+#endif
+  }
+
+  // Called on the client to map a segment created by the server. The nonce
+  // confirms that the segment found is indeed the one the server created i.e.
+  // that both processes share the same host.
+  bool Open(const std::string& name, std::uint64_t nonce)
+  {
+    this->Release();
+#if !defined(_WIN32)
+    int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd == -1)
+    {
+      return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || static_cast<std::size_t>(info.st_size) < SlotsOffset)
+    {
+      close(fd);
+      return false;
+    }
+    const std::size_t size = static_cast<std::size_t>(info.st_size);
+    void* mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED)
+    {
+      return false;
+    }
+    this->Mapping = mapping;
+    this->MappingSize = size;
+
+    auto header = reinterpret_cast<const SegmentHeader*>(this->Mapping);
+    if (header->Magic != Magic || header->Nonce != nonce ||
+      header->NumberOfSlots != NumberOfSlots ||
+      SlotsOffset + header->NumberOfSlots * header->SlotSize > size)
+    {
+      this->Release();
+      return false;
+    }
+    this->SlotSize = header->SlotSize;
+    return true;
+#else
+    (void)name;
+    (void)nonce;
+    return false;
+#endif
+  }
+
+  // Removes the segment name. Existing mappings remain valid.
+  void Unlink()
+  {
+#if !defined(_WIN32)
+    if (!this->SegmentName.empty())
+    {
+      shm_unlink(this->SegmentName.c_str());
+    }
+#endif
+    this->SegmentName.clear();
+  }
+
+  void Release()
+  {
+    this->Unlink();
+#if !defined(_WIN32)
+    if (this->Mapping)
+    {
+      munmap(this->Mapping, this->MappingSize);
+    }
+#endif
+    this->Mapping = nullptr;
+    this->MappingSize = 0;
+    this->SlotSize = 0;
+    this->NextSlot = 0;
+  }
+
+  unsigned char* GetSlot(unsigned int index) const
+  {
+    if (this->Mapping == nullptr || index >= NumberOfSlots)
+    {
+      return nullptr;
+    }
+    return reinterpret_cast<unsigned char*>(this->Mapping) + SlotsOffset +
+      index * this->SlotSize;
+  }
+
+  // Called on the server to copy an image in the next slot. Returns the slot
+  // index and the sequence number the client must find in it.
+  std::pair<unsigned int, std::uint64_t> Write(const unsigned char* data, std::size_t size)
+  {
+    const unsigned int index = this->NextSlot;
+    this->NextSlot = (this->NextSlot + 1) % NumberOfSlots;
+    const std::uint64_t sequence = (this->NextSequence += 2);
+
+    auto& slotSequence = reinterpret_cast<SegmentHeader*>(this->Mapping)->Sequences[index];
+    slotSequence.store(sequence - 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(this->GetSlot(index), data, size);
+    slotSequence.store(sequence, std::memory_order_release);
+    return { index, sequence };
+  }
+
+  // Called on the client to copy an image out of a slot. `sequence` holds the
+  // low 32 bits of the sequence number returned by Write(). Returns false if
+  // the slot does not hold the expected image, or was rewritten during the
+  // copy.
+  bool Read(unsigned int index, std::uint32_t sequence, unsigned char* data, std::size_t size)
+  {
+    const unsigned char* slot = this->GetSlot(index);
+    if (slot == nullptr || size > this->SlotSize)
+    {
+      return false;
+    }
+    const auto& slotSequence =
+      reinterpret_cast<const SegmentHeader*>(this->Mapping)->Sequences[index];
+    if (static_cast<std::uint32_t>(slotSequence.load(std::memory_order_acquire)) != sequence)
+    {
+      return false;
+    }
+    std::memcpy(data, slot, size);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return static_cast<std::uint32_t>(slotSequence.load(std::memory_order_relaxed)) == sequence;
+  }
+};
 
 vtkStandardNewMacro(vtkPVClientServerSynchronizedRenderers);
 vtkCxxSetObjectMacro(vtkPVClientServerSynchronizedRenderers, Compressor, vtkImageCompressor);
@@ -24,6 +301,9 @@ vtkPVClientServerSynchronizedRenderers::vtkPVClientServerSynchronizedRenderers()
   : Compressor(nullptr)
   , LossLessCompression(true)
   , NVPipeSupport(false)
+  , UseSharedMemoryImageTransport(false)
+  , KeyFrameRequested(false)
+  , Internals(new vtkPVClientServerSynchronizedRenderers::vtkInternals())
 {
   this->ConfigureCompressor("vtkLZ4Compressor 0 3");
 }
@@ -34,6 +314,34 @@ vtkPVClientServerSynchronizedRenderers::~vtkPVClientServerSynchronizedRenderers(
   this->SetCompressor(nullptr);
 }
 
+//----------------------------------------------------------------------------
+void vtkPVClientServerSynchronizedRenderers::SetSession(vtkPVSession* session)
+{
+  if (this->Session != session)
+  {
+    this->Session = session;
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+vtkPVSession* vtkPVClientServerSynchronizedRenderers::GetSession() const
+{
+  return this->Session;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVClientServerSynchronizedRenderers::MasterStartRender()
+{
+  // the server must have received all the state pushed so far before it
+  // renders.
+  if (this->Session)
+  {
+    this->Session->FlushPendingMessages();
+  }
+  this->Superclass::MasterStartRender();
+}
+
 //----------------------------------------------------------------------------
 void vtkPVClientServerSynchronizedRenderers::MasterEndRender()
 {
@@ -41,24 +349,59 @@ void vtkPVClientServerSynchronizedRenderers::MasterEndRender()
   assert(this->ParallelController->IsA("vtkSocketController") ||
     this->ParallelController->IsA("vtkCompositeMultiProcessController"));
 
+  // ask for a key frame if the previous image could not be decompressed, e.g.
+  // because its changed tiles apply to an image the client does not have.
+  // Otherwise the server would keep sending changes against it.
+  int requestKeyFrame = this->KeyFrameRequested ? 1 : 0;
+  this->KeyFrameRequested = false;
+  this->ParallelController->Send(&requestKeyFrame, 1, 1, KEY_FRAME_REQUEST_TAG);
+
   vtkRawImage& rawImage = this->Image;
 
-  int header[4];
-  this->ParallelController->Receive(header, 4, 1, 0x023430);
-  if (header[0] > 0)
+  int header[6];
+  this->ParallelController->Receive(header, 6, 1, IMAGE_TAG);
+  while (header[0] == SHARED_MEMORY_OFFER || header[0] == SHARED_MEMORY_IMAGE)
+  {
+    if (header[0] == SHARED_MEMORY_OFFER)
+    {
+      this->HandleSharedMemoryOffer(header[1]);
+    }
+    else
+    {
+      rawImage.Resize(header[1], header[2], header[3]);
+      vtkUnsignedCharArray* buffer = rawImage.GetRawPtr();
+      // acknowledge the image, or ask for it over the socket if the slot did
+      // not hold it.
+      const bool read = this->Internals->Read(static_cast<unsigned int>(header[4]),
+        static_cast<std::uint32_t>(header[5]), buffer->GetPointer(0),
+        static_cast<std::size_t>(buffer->GetNumberOfValues()));
+      int received = read ? 1 : 0;
+      this->ParallelController->Send(&received, 1, 1, SHARED_MEMORY_ACK_TAG);
+      if (received)
+      {
+        ResetCompressorReference(this->Compressor);
+        rawImage.MarkValid();
+        return;
+      }
+      vtkWarningMacro("Shared-memory image was overwritten, receiving it through the socket.");
+    }
+    this->ParallelController->Receive(header, 6, 1, IMAGE_TAG);
+  }
+
+  if (header[0] == SOCKET_IMAGE)
   {
     rawImage.Resize(header[1], header[2], header[3]);
     if (this->Compressor)
     {
       vtkUnsignedCharArray* data = vtkUnsignedCharArray::New();
-      this->ParallelController->Receive(data, 1, 0x023430);
+      this->ParallelController->Receive(data, 1, IMAGE_TAG);
       this->Compressor->SetImageResolution(header[1], header[2]);
       this->Decompress(data, rawImage.GetRawPtr());
       data->Delete();
     }
     else
     {
-      this->ParallelController->Receive(rawImage.GetRawPtr(), 1, 0x023430);
+      this->ParallelController->Receive(rawImage.GetRawPtr(), 1, IMAGE_TAG);
     }
     rawImage.MarkValid();
   }
@@ -70,31 +413,163 @@ void vtkPVClientServerSynchronizedRenderers::SlaveEndRender()
   assert(this->ParallelController->IsA("vtkSocketController") ||
     this->ParallelController->IsA("vtkCompositeMultiProcessController"));
 
+  int requestKeyFrame = 0;
+  this->ParallelController->Receive(&requestKeyFrame, 1, 1, KEY_FRAME_REQUEST_TAG);
+  if (requestKeyFrame)
+  {
+    ResetCompressorReference(this->Compressor);
+  }
+
   vtkRawImage& rawImage = this->CaptureRenderedImage();
 
-  int header[4];
-  header[0] = rawImage.IsValid() ? 1 : 0;
+  int header[6];
+  header[0] = rawImage.IsValid() ? SOCKET_IMAGE : NO_IMAGE;
   header[1] = rawImage.GetWidth();
   header[2] = rawImage.GetHeight();
   header[3] = rawImage.IsValid() ? rawImage.GetRawPtr()->GetNumberOfComponents() : 0;
+  header[4] = 0;
+  header[5] = 0;
+
+  if (!this->UseSharedMemoryImageTransport)
+  {
+    // let a later toggle renegotiate from scratch.
+    this->Internals->Release();
+    this->Internals->State = vtkInternals::TransportState::UNKNOWN;
+  }
+  else if (rawImage.IsValid())
+  {
+    vtkUnsignedCharArray* buffer = rawImage.GetRawPtr();
+    const vtkIdType imageSize = buffer->GetNumberOfValues();
+    if (this->SetupSharedMemoryTransport(imageSize))
+    {
+      const auto slot = this->Internals->Write(
+        buffer->GetPointer(0), static_cast<std::size_t>(imageSize));
+      header[0] = SHARED_MEMORY_IMAGE;
+      header[4] = static_cast<int>(slot.first);
+      // the client compares the low 32 bits only.
+      header[5] = static_cast<int>(static_cast<unsigned int>(slot.second));
+      this->ParallelController->Send(header, 6, 1, IMAGE_TAG);
+
+      int received = 0;
+      this->ParallelController->Receive(&received, 1, 1, SHARED_MEMORY_ACK_TAG);
+      if (received)
+      {
+        ResetCompressorReference(this->Compressor);
+        return;
+      }
+      header[0] = SOCKET_IMAGE;
+      header[4] = header[5] = 0;
+    }
+  }
 
   // send the image to the client.
-  this->ParallelController->Send(header, 4, 1, 0x023430);
+  this->ParallelController->Send(header, 6, 1, IMAGE_TAG);
 
-  if (rawImage.IsValid())
+  if (header[0] == SOCKET_IMAGE)
   {
     if (this->Compressor)
     {
       this->Compressor->SetImageResolution(header[1], header[2]);
-      this->ParallelController->Send(this->Compress(rawImage.GetRawPtr()), 1, 0x023430);
+      this->ParallelController->Send(this->Compress(rawImage.GetRawPtr()), 1, IMAGE_TAG);
     }
     else
     {
-      this->ParallelController->Send(rawImage.GetRawPtr(), 1, 0x023430);
+      this->ParallelController->Send(rawImage.GetRawPtr(), 1, IMAGE_TAG);
     }
   }
 }
 
+//----------------------------------------------------------------------------
+bool vtkPVClientServerSynchronizedRenderers::GetSharedMemoryImageTransportActive() const
+{
+  return this->UseSharedMemoryImageTransport &&
+    this->Internals->State == vtkInternals::TransportState::ACTIVE;
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVClientServerSynchronizedRenderers::SetupSharedMemoryTransport(vtkIdType imageSize)
+{
+  vtkInternals& internals = *this->Internals;
+  if (internals.State == vtkInternals::TransportState::UNAVAILABLE)
+  {
+    return false;
+  }
+  if (internals.State == vtkInternals::TransportState::ACTIVE &&
+    static_cast<std::uint64_t>(imageSize) <= internals.SlotSize)
+  {
+    return true;
+  }
+
+  // (re)allocate the segment. Round up the slot size so that small resizes of
+  // the view don't require a new negotiation.
+  const std::uint64_t granularity = 1 << 20;
+  const std::uint64_t slotSize =
+    ((static_cast<std::uint64_t>(imageSize) + granularity - 1) / granularity) * granularity;
+  std::random_device rd;
+  const std::uint64_t nonce = (static_cast<std::uint64_t>(rd()) << 32) ^ rd();
+  if (!internals.Create(slotSize, nonce))
+  {
+    vtkDebugMacro("Failed to create shared-memory segment; using regular image transfer.");
+    internals.State = vtkInternals::TransportState::UNAVAILABLE;
+    return false;
+  }
+
+  std::ostringstream offer;
+  offer << GetLocalHostName() << " " << internals.SegmentName << " " << nonce;
+  const std::string offerStr = offer.str();
+
+  int header[6] = { SHARED_MEMORY_OFFER, static_cast<int>(offerStr.size()), 0, 0, 0, 0 };
+  this->ParallelController->Send(header, 6, 1, IMAGE_TAG);
+  this->ParallelController->Send(
+    offerStr.c_str(), static_cast<vtkIdType>(offerStr.size()), 1, IMAGE_TAG);
+
+  int accepted = 0;
+  this->ParallelController->Receive(&accepted, 1, 1, SHARED_MEMORY_ACK_TAG);
+
+  // The client has mapped the segment (or failed to), the name is no longer
+  // needed. Unlinking now ensures the segment is not leaked.
+  internals.Unlink();
+  if (!accepted)
+  {
+    vtkDebugMacro("Client declined shared-memory image transfer.");
+    internals.Release();
+    internals.State = vtkInternals::TransportState::UNAVAILABLE;
+    return false;
+  }
+
+  internals.State = vtkInternals::TransportState::ACTIVE;
+  return true;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVClientServerSynchronizedRenderers::HandleSharedMemoryOffer(int offerLength)
+{
+  std::vector<char> offer(static_cast<size_t>(offerLength) + 1, '\0');
+  if (offerLength > 0)
+  {
+    this->ParallelController->Receive(offer.data(), offerLength, 1, IMAGE_TAG);
+  }
+
+  std::istringstream iss(offer.data());
+  std::string hostName, segmentName;
+  std::uint64_t nonce = 0;
+  iss >> hostName >> segmentName >> nonce;
+
+  int accepted = 0;
+  if (this->UseSharedMemoryImageTransport && !iss.fail() && !hostName.empty() &&
+    hostName == GetLocalHostName())
+  {
+    accepted = this->Internals->Open(segmentName, nonce) ? 1 : 0;
+  }
+  else
+  {
+    this->Internals->Release();
+  }
+  this->Internals->State = accepted ? vtkInternals::TransportState::ACTIVE
+                                    : vtkInternals::TransportState::UNAVAILABLE;
+  this->ParallelController->Send(&accepted, 1, 1, SHARED_MEMORY_ACK_TAG);
+}
+
 //----------------------------------------------------------------------------
 vtkUnsignedCharArray* vtkPVClientServerSynchronizedRenderers::Compress(vtkUnsignedCharArray* data)
 {
@@ -125,6 +600,7 @@ void vtkPVClientServerSynchronizedRenderers::Decompress(
     if (this->Compressor->Decompress() == 0)
     {
       vtkErrorMacro("Image de-compression failed!");
+      this->KeyFrameRequested = true;
     }
   }
   else
@@ -159,6 +635,10 @@ void vtkPVClientServerSynchronizedRenderers::ConfigureCompressor(const char* str
     {
       comp = vtkLZ4Compressor::New();
     }
+    else if (className == "vtkDeltaImageCompressor")
+    {
+      comp = vtkDeltaImageCompressor::New();
+    }
     else if (className == "vtkNvPipeCompressor" && this->NVPipeSupport)
     {
 #if VTK_MODULE_ENABLE_ParaView_nvpipe
@@ -204,4 +684,6 @@ void vtkPVClientServerSynchronizedRenderers::ConfigureCompressor(const char* str
 void vtkPVClientServerSynchronizedRenderers::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "UseSharedMemoryImageTransport: " << this->UseSharedMemoryImageTransport
+     << endl;
 }
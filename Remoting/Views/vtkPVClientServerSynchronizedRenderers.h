@@ -7,6 +7,17 @@
  * vtkPVClientServerSynchronizedRenderers is similar to
  * vtkClientServerSynchronizedRenderers except that it optionally uses image
  * compressors to compress the image before transmitting.
+ *
+ * When UseSharedMemoryImageTransport is enabled and the client and server
+ * processes run on the same host, images are instead handed over through a
+ * POSIX shared-memory ring buffer negotiated on the first frame. This bypasses
+ * both the compressor and the socket. If the shared-memory segment cannot be
+ * setup (different hosts, unsupported platform, etc.), the regular path is
+ * used.
+ *
+ * On the client, the session set with SetSession() is asked to send the
+ * messages it holds back before each render so that the server renders with
+ * the latest state even when the render is not triggered through the session.
  */
 
 #ifndef vtkPVClientServerSynchronizedRenderers_h
@@ -14,8 +25,12 @@
 
 #include "vtkRemotingViewsModule.h" //needed for exports
 #include "vtkSynchronizedRenderers.h"
+#include "vtkWeakPointer.h" // for vtkWeakPointer
+
+#include <memory> // for std::unique_ptr
 
 class vtkImageCompressor;
+class vtkPVSession;
 class vtkUnsignedCharArray;
 
 class VTKREMOTINGVIEWS_EXPORT vtkPVClientServerSynchronizedRenderers
@@ -47,6 +62,33 @@ public:
    */
   virtual void ConfigureCompressor(const char* stream);
 
+  ///@{
+  /**
+   * When set, images are transferred through shared memory, bypassing the
+   * compressor and the socket, if the client and the server run on the same
+   * host. Falls back to the regular transfer otherwise. The value must be
+   * consistent on the client and the server. Default is false.
+   */
+  vtkSetMacro(UseSharedMemoryImageTransport, bool);
+  vtkGetMacro(UseSharedMemoryImageTransport, bool);
+  ///@}
+
+  /**
+   * Returns true when images are currently transferred through shared memory
+   * i.e. when UseSharedMemoryImageTransport is set and the client accepted the
+   * segment offered by the server.
+   */
+  bool GetSharedMemoryImageTransportActive() const;
+
+  ///@{
+  /**
+   * Set the session used to communicate with the server. Pending messages of
+   * the session are flushed before the client starts a render.
+   */
+  void SetSession(vtkPVSession* session);
+  vtkPVSession* GetSession() const;
+  ///@}
+
 protected:
   vtkPVClientServerSynchronizedRenderers();
   ~vtkPVClientServerSynchronizedRenderers() override;
@@ -62,16 +104,41 @@ protected:
   vtkUnsignedCharArray* Compress(vtkUnsignedCharArray*);
   void Decompress(vtkUnsignedCharArray* input, vtkUnsignedCharArray* outputBuffer);
 
+  void MasterStartRender() override;
   void MasterEndRender() override;
   void SlaveEndRender() override;
 
   vtkImageCompressor* Compressor;
   bool LossLessCompression;
   bool NVPipeSupport;
+  bool UseSharedMemoryImageTransport;
+  vtkWeakPointer<vtkPVSession> Session;
+
+  /**
+   * Set on the client when an image could not be decompressed. The server is
+   * then asked to reset its compressor at the start of the next image
+   * transfer, so that the next image is a key frame.
+   */
+  bool KeyFrameRequested;
 
 private:
   vtkPVClientServerSynchronizedRenderers(const vtkPVClientServerSynchronizedRenderers&) = delete;
   void operator=(const vtkPVClientServerSynchronizedRenderers&) = delete;
+
+  /**
+   * Called on the server to ensure a shared-memory segment large enough for
+   * an image of \c imageSize bytes is shared with the client. Returns false if
+   * the shared-memory transport cannot be used.
+   */
+  bool SetupSharedMemoryTransport(vtkIdType imageSize);
+
+  /**
+   * Called on the client to handle a shared-memory offer from the server.
+   */
+  void HandleSharedMemoryOffer(int offerLength);
+
+  class vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
 };
 
 #endif
@@ -5,9 +5,11 @@
 
 #include "vtkAlgorithmOutput.h"
 #include "vtkInformation.h"
+#include "vtkMultiProcessController.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPVDataRepresentation.h"
+#include "vtkPVGeometryDiskCache.h"
 #include "vtkPVLogger.h"
 #include "vtkPVView.h"
 #include "vtkSmartPointer.h"
@@ -109,6 +111,13 @@ void vtkPVDataDeliveryManager::SetPiece(vtkPVDataRepresentation* repr, vtkDataOb
         item->SetActualMemorySize(trueSize, cacheKey);
       }
 
+      if (data && !low_res && !this->Internals->LoadingFromDiskCache &&
+        vtkPVGeometryDiskCache::IsEnabled())
+      {
+        auto& diskCache = this->Internals->DiskCache;
+        diskCache->Store(diskCache->ComputeKey(repr, port), data);
+      }
+
       if (low_res == false)
       {
         // clear low_res data whenever full-res data changes. this ensures that
@@ -123,6 +132,63 @@ void vtkPVDataDeliveryManager::SetPiece(vtkPVDataRepresentation* repr, vtkDataOb
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkPVDataDeliveryManager::LoadPiecesFromDiskCache(
+  const std::vector<vtkPVDataRepresentation*>& reprs, double cacheKey)
+{
+  auto& pieces = this->Internals->DiskCachePieces;
+  pieces.clear();
+  if (!vtkPVGeometryDiskCache::IsEnabled() || reprs.empty())
+  {
+    return;
+  }
+
+  // 1 when this rank does not prevent the representation from skipping its
+  // pipeline: it does not need to update, its data is in memory or it was
+  // found on disk.
+  auto& diskCache = this->Internals->DiskCache;
+  std::vector<int> found(reprs.size(), 1);
+  for (size_t cc = 0; cc < reprs.size(); ++cc)
+  {
+    vtkPVDataRepresentation* repr = reprs[cc];
+    const double key = repr->GetForceUseCache() ? repr->GetForcedCacheKey() : cacheKey;
+    vtkInternals::vtkItem* item =
+      this->Internals->GetItem(repr, /*low_res=*/false, 0, /*create_if_needed=*/false);
+    if (!repr->GetNeedsUpdate() || (item && item->GetDataObject(key) != nullptr))
+    {
+      continue;
+    }
+    if (auto data = diskCache->LoadLocal(diskCache->ComputeKey(repr, 0)))
+    {
+      pieces[repr->GetUniqueIdentifier()] = data;
+    }
+    else
+    {
+      found[cc] = 0;
+    }
+  }
+
+  // all ranks must agree, otherwise ranks that did not find the data would
+  // execute the pipeline alone. This is done once for all representations so
+  // that ranks never disagree on the number of reductions.
+  auto controller = diskCache->GetController();
+  if (controller && controller->GetNumberOfProcesses() > 1)
+  {
+    std::vector<int> allFound(found.size(), 0);
+    controller->AllReduce(found.data(), allFound.data(), static_cast<vtkIdType>(found.size()),
+      vtkCommunicator::MIN_OP);
+    for (size_t cc = 0; cc < reprs.size(); ++cc)
+    {
+      if (allFound[cc] == 0)
+      {
+        pieces.erase(reprs[cc]->GetUniqueIdentifier());
+      }
+    }
+  }
+  vtkVLogF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "disk-cache: %d of %d representations loaded",
+    static_cast<int>(pieces.size()), static_cast<int>(reprs.size()));
+}
+
 //----------------------------------------------------------------------------
 vtkDataObject* vtkPVDataDeliveryManager::GetPiece(
   vtkPVDataRepresentation* repr, bool low_res, int port)
@@ -140,11 +206,43 @@ bool vtkPVDataDeliveryManager::HasPiece(vtkPVDataRepresentation* repr, bool low_
     this->Internals->GetItem(repr, low_res, port, /*create_if_needed=*/false);
   const auto cacheKey = this->GetCacheKey(repr);
   const bool val = item ? (item->GetDataObject(cacheKey) != nullptr) : false;
-
   vtkLogF(TRACE, "HasPiece %s (key=%g) : %d", repr->GetLogName().c_str(), cacheKey, val);
   return val;
 }
 
+//----------------------------------------------------------------------------
+bool vtkPVDataDeliveryManager::IsCached(vtkPVDataRepresentation* repr)
+{
+  bool val = this->HasPiece(repr);
+  auto& pieces = this->Internals->DiskCachePieces;
+  auto iter = pieces.find(repr->GetUniqueIdentifier());
+  if (iter != pieces.end())
+  {
+    if (!val)
+    {
+      vtkLogF(TRACE, "IsCached %s: loaded from disk cache", repr->GetLogName().c_str());
+      this->Internals->LoadingFromDiskCache = true;
+      this->SetPiece(repr, iter->second, /*low_res=*/false);
+      this->Internals->LoadingFromDiskCache = false;
+      val = this->HasPiece(repr);
+    }
+    pieces.erase(iter);
+  }
+  if (!this->RecordCacheStatistics)
+  {
+    return val;
+  }
+  if (val)
+  {
+    ++this->NumberOfCacheHits;
+  }
+  else
+  {
+    ++this->NumberOfCacheMisses;
+  }
+  return val;
+}
+
 //----------------------------------------------------------------------------
 vtkDataObject* vtkPVDataDeliveryManager::GetDeliveredPiece(
   vtkPVDataRepresentation* repr, bool low_res, int port)
@@ -282,11 +380,95 @@ double vtkPVDataDeliveryManager::GetCacheKey(vtkPVDataRepresentation* repr) cons
 //----------------------------------------------------------------------------
 void vtkPVDataDeliveryManager::ClearCache(vtkPVDataRepresentation* repr)
 {
+  this->Internals->DiskCachePieces.erase(repr->GetUniqueIdentifier());
   this->Internals->ClearCache(repr);
 }
 
+//----------------------------------------------------------------------------
+void vtkPVDataDeliveryManager::MarkCacheKeyUsed(double cacheKey)
+{
+  this->Internals->CacheKeyAccessTimes[cacheKey] = ++this->Internals->CacheKeyAccessCounter;
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVDataDeliveryManager::GetLeastRecentlyUsedCacheKey(
+  double currentKey, double& cacheKey) const
+{
+  bool found = false;
+  vtkTypeUInt64 oldest = 0;
+  for (const auto& apair : this->Internals->CacheKeyAccessTimes)
+  {
+    if (apair.first != currentKey && (!found || apair.second < oldest))
+    {
+      found = true;
+      oldest = apair.second;
+      cacheKey = apair.first;
+    }
+  }
+  return found;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVDataDeliveryManager::EvictCacheKey(double cacheKey)
+{
+  vtkVLogScopeF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "evict cache key %g", cacheKey);
+  this->Internals->CacheKeyAccessTimes.erase(cacheKey);
+  for (auto& ipair : this->Internals->ItemsMap)
+  {
+    // representations that have not been updated since `cacheKey` was current
+    // keep using the data cached for it.
+    auto repr = this->GetRepresentation(ipair.first.first);
+    if (repr && this->GetCacheKey(repr) == cacheKey)
+    {
+      continue;
+    }
+    for (auto item : { &ipair.second.first, &ipair.second.second })
+    {
+      if (item->EvictCacheEntry(cacheKey))
+      {
+        ++this->NumberOfCacheEvictions;
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+vtkTypeUInt64 vtkPVDataDeliveryManager::GetCacheSize() const
+{
+  vtkTypeUInt64 size = 0;
+  for (const auto& ipair : this->Internals->ItemsMap)
+  {
+    size += ipair.second.first.GetCacheSize() + ipair.second.second.GetCacheSize();
+  }
+  return size;
+}
+
+//----------------------------------------------------------------------------
+int vtkPVDataDeliveryManager::GetNumberOfCacheEntries() const
+{
+  int count = 0;
+  for (const auto& ipair : this->Internals->ItemsMap)
+  {
+    count += ipair.second.first.GetNumberOfCacheEntries() +
+      ipair.second.second.GetNumberOfCacheEntries();
+  }
+  return count;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVDataDeliveryManager::ResetCacheStatistics()
+{
+  this->NumberOfCacheHits = 0;
+  this->NumberOfCacheMisses = 0;
+  this->NumberOfCacheEvictions = 0;
+}
+
 //----------------------------------------------------------------------------
 void vtkPVDataDeliveryManager::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfCacheHits: " << this->NumberOfCacheHits << endl;
+  os << indent << "NumberOfCacheMisses: " << this->NumberOfCacheMisses << endl;
+  os << indent << "NumberOfCacheEvictions: " << this->NumberOfCacheEvictions << endl;
+  os << indent << "RecordCacheStatistics: " << this->RecordCacheStatistics << endl;
 }
@@ -79,6 +79,28 @@ public:
   bool HasPiece(vtkPVDataRepresentation* repr, bool low_res = false, int port = 0);
   ///@}
 
+  /**
+   * Loads, from the on-disk geometry cache (see vtkPVGeometryDiskCache), the
+   * full-resolution data of the representations in `reprs` that need to
+   * update and whose data is not in memory for `cacheKey`. This is a
+   * collective operation on the data-server ranks, which must pass the same
+   * representations in the same order: the data is only kept for the
+   * representations for which every rank has it, in memory or on disk, so
+   * that all ranks agree on which representations skip executing their
+   * pipeline. The data is added, as if `SetPiece` was called, by the next
+   * `IsCached` call for the representation.
+   */
+  void LoadPiecesFromDiskCache(
+    const std::vector<vtkPVDataRepresentation*>& reprs, double cacheKey);
+
+  /**
+   * Returns true if the full-resolution data for the representation is cached
+   * so that it can skip executing its pipeline, either in memory or loaded
+   * from the disk cache by `LoadPiecesFromDiskCache`. This is where cache hits
+   * and misses are counted.
+   */
+  bool IsCached(vtkPVDataRepresentation* repr);
+
   /**
    * Returns the local data object set by calling `SetPiece` (or from the
    * cache). This is the data object pre-delivery.
@@ -95,6 +117,58 @@ public:
    */
   void ClearCache(vtkPVDataRepresentation* repr);
 
+  /**
+   * Notes that `cacheKey` is being used. vtkPVView calls this on every update
+   * when caching is enabled to keep track of the least recently used keys.
+   */
+  void MarkCacheKeyUsed(double cacheKey);
+
+  /**
+   * Provides the least recently used cache key, ignoring `currentKey`.
+   * Returns false if there is no such key.
+   */
+  bool GetLeastRecentlyUsedCacheKey(double currentKey, double& cacheKey) const;
+
+  /**
+   * Removes the data cached for `cacheKey` for all representations, except
+   * those currently using that key.
+   */
+  void EvictCacheKey(double cacheKey);
+
+  /**
+   * Returns the size, in KiB, of all data cached on this process, delivered
+   * data included.
+   */
+  vtkTypeUInt64 GetCacheSize() const;
+
+  /**
+   * Returns the number of entries in the cache, i.e. the number of data
+   * objects cached for all representations and cache keys.
+   */
+  int GetNumberOfCacheEntries() const;
+
+  ///@{
+  /**
+   * Cache statistics: the number of times a representation found its data in
+   * the cache (hits) or not (misses) when updating, as reported by `IsCached`,
+   * and the number of entries evicted by `EvictCacheKey`.
+   */
+  vtkGetMacro(NumberOfCacheHits, vtkTypeUInt64);
+  vtkGetMacro(NumberOfCacheMisses, vtkTypeUInt64);
+  vtkGetMacro(NumberOfCacheEvictions, vtkTypeUInt64);
+  void ResetCacheStatistics();
+  ///@}
+
+  ///@{
+  /**
+   * When false, `IsCached` does not count hits and misses. vtkPVView turns
+   * this off when it goes back to the current frame after a prefetch, since
+   * that is not an update of the frame being shown. Default is true.
+   */
+  vtkSetMacro(RecordCacheStatistics, bool);
+  vtkGetMacro(RecordCacheStatistics, bool);
+  ///@}
+
   ///@{
   /**
    * Provides access to the producer port for the geometry of a registered
@@ -177,6 +251,11 @@ private:
   void operator=(const vtkPVDataDeliveryManager&) = delete;
 
   vtkWeakPointer<vtkPVView> View;
+
+  vtkTypeUInt64 NumberOfCacheHits = 0;
+  vtkTypeUInt64 NumberOfCacheMisses = 0;
+  vtkTypeUInt64 NumberOfCacheEvictions = 0;
+  bool RecordCacheStatistics = true;
 };
 
 #endif
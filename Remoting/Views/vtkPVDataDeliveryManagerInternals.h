@@ -9,14 +9,16 @@
 #include "vtkNew.h"         // for vtkNew
 #include "vtkPVDataDeliveryManager.h"
 #include "vtkPVDataRepresentation.h" // for vtkPVDataRepresentation
+#include "vtkPVGeometryDiskCache.h"  // for vtkPVGeometryDiskCache
 #include "vtkPVTrivialProducer.h"    // for vtkPVTrivialProducer
 #include "vtkSmartPointer.h"         // for vtkSmartPointer
 #include "vtkWeakPointer.h"          // for vtkWeakPointer
 
-#include <cassert> // for assert
-#include <map>     // for std::map
-#include <numeric> // for std::accumulate
-#include <utility> // for std::pair
+#include <algorithm> // for std::count_if
+#include <cassert>   // for assert
+#include <map>       // for std::map
+#include <numeric>   // for std::accumulate
+#include <utility>   // for std::pair
 
 class vtkPVDataDeliveryManager::vtkInternals
 {
@@ -78,6 +80,47 @@ public:
 
     void ClearCache() { this->Data.clear(); }
 
+    // Removes the data cached for `cacheKey`. Returns true if there was any.
+    bool EvictCacheEntry(double cacheKey)
+    {
+      auto iter = this->Data.find(cacheKey);
+      if (iter == this->Data.end())
+      {
+        return false;
+      }
+      const bool hadData = iter->second.DataObject != nullptr;
+      this->Data.erase(iter);
+      return hadData;
+    }
+
+    int GetNumberOfCacheEntries() const
+    {
+      return static_cast<int>(std::count_if(this->Data.begin(), this->Data.end(),
+        [](const std::pair<const double, vtkRepresentedData>& dpair) {
+          return dpair.second.DataObject != nullptr;
+        }));
+    }
+
+    // Returns the size in KiB of all cached data, including delivered data
+    // objects which are the only non-empty ones on rendering-only processes.
+    vtkTypeUInt64 GetCacheSize() const
+    {
+      vtkTypeUInt64 size = 0;
+      for (const auto& dpair : this->Data)
+      {
+        const auto& store = dpair.second;
+        size += store.ActualMemorySize;
+        for (const auto& delivered : store.DeliveredDataObjects)
+        {
+          if (delivered.second && delivered.second != store.DataObject)
+          {
+            size += delivered.second->GetActualMemorySize();
+          }
+        }
+      }
+      return size;
+    }
+
     void SetDataObject(vtkDataObject* data, vtkInternals* helper, double cacheKey)
     {
       auto& store = this->Data[cacheKey];
@@ -278,6 +321,21 @@ public:
 
   ItemsMapType ItemsMap;
   RepresentationsMapType RepresentationsMap;
+
+  // Last use of each cache key, used to evict the least recently used ones.
+  std::map<double, vtkTypeUInt64> CacheKeyAccessTimes;
+  vtkTypeUInt64 CacheKeyAccessCounter{ 0 };
+
+  // Optional on-disk tier for full-resolution data.
+  vtkNew<vtkPVGeometryDiskCache> DiskCache;
+
+  // Data loaded from the disk cache by LoadPiecesFromDiskCache, per
+  // representation identifier, until IsCached adds it.
+  std::map<unsigned int, vtkSmartPointer<vtkDataObject>> DiskCachePieces;
+
+  // Set while data loaded from the disk cache is being added to avoid writing
+  // it back.
+  bool LoadingFromDiskCache{ false };
 };
 
 #endif // __WRAP__
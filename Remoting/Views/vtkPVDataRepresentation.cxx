@@ -99,6 +99,22 @@ double vtkPVDataRepresentation::GetCacheKey() const
   return this->ForceUseCache ? this->ForcedCacheKey : this->CacheKey;
 }
 
+//----------------------------------------------------------------------------
+void vtkPVDataRepresentation::SetDiskCacheSignature(const char* signature)
+{
+  this->DiskCacheSignature = signature ? signature : "";
+  this->DiskCacheFileNames.clear();
+}
+
+//----------------------------------------------------------------------------
+void vtkPVDataRepresentation::AddDiskCacheFileName(const char* fname)
+{
+  if (fname && fname[0])
+  {
+    this->DiskCacheFileNames.emplace_back(fname);
+  }
+}
+
 //----------------------------------------------------------------------------
 int vtkPVDataRepresentation::ProcessViewRequest(
   vtkInformationRequestKey* request, vtkInformation*, vtkInformation*)
@@ -349,4 +365,5 @@ void vtkPVDataRepresentation::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "ForceUseCache: " << this->ForceUseCache << endl;
   os << indent << "ForcedCacheKey: " << this->ForcedCacheKey << endl;
   os << indent << "CacheKey: " << this->CacheKey << endl;
+  os << indent << "DiskCacheSignature: " << this->DiskCacheSignature << endl;
 }
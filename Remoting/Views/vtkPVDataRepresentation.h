@@ -17,6 +17,7 @@
 #include "vtkRemotingViewsModule.h" // needed for exports
 #include "vtkWeakPointer.h"         // needed for vtkWeakPointer
 #include <string>                   // needed for string
+#include <vector>                   // needed for vector
 
 class vtkInformationRequestKey;
 
@@ -134,6 +135,36 @@ public:
    */
   double GetCacheKey() const;
 
+  ///@{
+  /**
+   * Set the signature of the pipeline producing this representation's input
+   * along with the files that pipeline reads. These are used to identify the
+   * data prepared by the representation in the on-disk geometry cache (see
+   * vtkPVGeometryDiskCache). Setting the signature clears the list of file
+   * names. An empty signature (default) disables the disk cache for this
+   * representation. These are set by vtkSMViewProxy only when the disk cache is
+   * enabled.
+   */
+  virtual void SetDiskCacheSignature(const char* signature);
+  virtual void AddDiskCacheFileName(const char* fname);
+  const std::string& GetDiskCacheSignature() const { return this->DiskCacheSignature; }
+  const std::vector<std::string>& GetDiskCacheFileNames() const
+  {
+    return this->DiskCacheFileNames;
+  }
+  ///@}
+
+  /**
+   * Returns a description of the parameters of this representation that affect
+   * the data it hands over to the view, for use in the on-disk geometry cache
+   * key. Representations opt in to the disk cache by overriding this to return
+   * a non-empty string. They must only hand over data on port 0 and derive all
+   * other state from that data, since their pipeline does not execute when the
+   * data is loaded from disk. The default returns an empty string, i.e. the
+   * disk cache is not used.
+   */
+  virtual std::string GetDiskCacheParameters() { return std::string(); }
+
   ///@{
   /**
    * Making these methods public. When constructing composite representations,
@@ -257,6 +288,8 @@ private:
   bool ForceUseCache;
   double ForcedCacheKey;
   double CacheKey;
+  std::string DiskCacheSignature;
+  std::vector<std::string> DiskCacheFileNames;
 
   bool HasTemporalPipeline;
 
@@ -0,0 +1,293 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkPVGeometryDiskCache.h"
+
+#include "vtkCommunicator.h"
+#include "vtkDataObject.h"
+#include "vtkErrorCode.h"
+#include "vtkGenericDataObjectReader.h"
+#include "vtkGenericDataObjectWriter.h"
+#include "vtkMultiProcessController.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPVDataRepresentation.h"
+#include "vtkPVLogger.h"
+
+#include <vtksys/Directory.hxx>
+#include <vtksys/MD5.h>
+#include <vtksys/SystemTools.hxx>
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+namespace
+{
+std::string& CacheDirectory()
+{
+  static std::string directory;
+  return directory;
+}
+
+unsigned long& CacheSizeLimit()
+{
+  static unsigned long limit = 10240;
+  return limit;
+}
+}
+
+vtkStandardNewMacro(vtkPVGeometryDiskCache);
+//----------------------------------------------------------------------------
+vtkPVGeometryDiskCache::vtkPVGeometryDiskCache()
+  : Controller(vtkMultiProcessController::GetGlobalController())
+{
+}
+
+//----------------------------------------------------------------------------
+vtkPVGeometryDiskCache::~vtkPVGeometryDiskCache() = default;
+
+//----------------------------------------------------------------------------
+void vtkPVGeometryDiskCache::SetCacheDirectory(const std::string& directory)
+{
+  CacheDirectory() = directory;
+}
+
+//----------------------------------------------------------------------------
+const std::string& vtkPVGeometryDiskCache::GetCacheDirectory()
+{
+  return CacheDirectory();
+}
+
+//----------------------------------------------------------------------------
+void vtkPVGeometryDiskCache::SetCacheSizeLimit(unsigned long limit)
+{
+  CacheSizeLimit() = limit;
+}
+
+//----------------------------------------------------------------------------
+unsigned long vtkPVGeometryDiskCache::GetCacheSizeLimit()
+{
+  return CacheSizeLimit();
+}
+
+//----------------------------------------------------------------------------
+void vtkPVGeometryDiskCache::SetController(vtkMultiProcessController* controller)
+{
+  if (this->Controller != controller)
+  {
+    this->Controller = controller;
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+vtkMultiProcessController* vtkPVGeometryDiskCache::GetController() const
+{
+  return this->Controller;
+}
+
+//----------------------------------------------------------------------------
+std::string vtkPVGeometryDiskCache::ComputeKey(vtkPVDataRepresentation* repr, int port) const
+{
+  if (repr == nullptr || port != 0 || repr->GetDiskCacheSignature().empty())
+  {
+    return std::string();
+  }
+  const std::string parameters = repr->GetDiskCacheParameters();
+  if (parameters.empty())
+  {
+    return std::string();
+  }
+
+  std::ostringstream stream;
+  stream.precision(17);
+  stream << repr->GetDiskCacheSignature() << "\n";
+  for (const auto& fname : repr->GetDiskCacheFileNames())
+  {
+    // the file names are already part of the signature, what we're adding here
+    // is the information that tells us if the files changed since the
+    // geometry was cached.
+    const bool exists = vtksys::SystemTools::FileExists(fname, /*isFile=*/true);
+    stream << "file: " << fname << " "
+           << (exists ? vtksys::SystemTools::ModifiedTime(fname) : 0) << " "
+           << (exists ? vtksys::SystemTools::FileLength(fname) : 0) << "\n";
+  }
+  stream << "representation: " << repr->GetClassName() << "\n" << parameters;
+  if (repr->GetUpdateTimeValid())
+  {
+    stream << "time: " << repr->GetUpdateTime() << "\n";
+  }
+  stream << "ranks: " << (this->Controller ? this->Controller->GetNumberOfProcesses() : 1)
+         << "\n";
+
+  const std::string text = stream.str();
+  char hex[32];
+  vtksysMD5* md5 = vtksysMD5_New();
+  vtksysMD5_Initialize(md5);
+  vtksysMD5_Append(
+    md5, reinterpret_cast<const unsigned char*>(text.c_str()), static_cast<int>(text.size()));
+  vtksysMD5_FinalizeHex(md5, hex);
+  vtksysMD5_Delete(md5);
+  return std::string(hex, 32);
+}
+
+//----------------------------------------------------------------------------
+std::string vtkPVGeometryDiskCache::GetFileName(const std::string& key) const
+{
+  const int rank = this->Controller ? this->Controller->GetLocalProcessId() : 0;
+  return vtkPVGeometryDiskCache::GetCacheDirectory() + "/" + key + "." + std::to_string(rank) +
+    ".vtk";
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkDataObject> vtkPVGeometryDiskCache::Load(const std::string& key)
+{
+  vtkSmartPointer<vtkDataObject> result = this->LoadLocal(key);
+
+  // all ranks must agree, otherwise ranks that did not find the data would
+  // execute the pipeline alone.
+  if (this->Controller && this->Controller->GetNumberOfProcesses() > 1)
+  {
+    int found = result != nullptr ? 1 : 0;
+    int allFound = 0;
+    this->Controller->AllReduce(&found, &allFound, 1, vtkCommunicator::MIN_OP);
+    if (allFound == 0)
+    {
+      result = nullptr;
+    }
+  }
+
+  vtkVLogF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "disk-cache %s: %s", key.c_str(),
+    result ? "hit" : "miss");
+  return result;
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkDataObject> vtkPVGeometryDiskCache::LoadLocal(const std::string& key)
+{
+  vtkSmartPointer<vtkDataObject> result;
+  if (!key.empty() && vtkPVGeometryDiskCache::IsEnabled())
+  {
+    const std::string fname = this->GetFileName(key);
+    if (vtksys::SystemTools::FileExists(fname, /*isFile=*/true))
+    {
+      vtkNew<vtkGenericDataObjectReader> reader;
+      reader->SetFileName(fname.c_str());
+      reader->ReadAllScalarsOn();
+      reader->ReadAllVectorsOn();
+      reader->ReadAllNormalsOn();
+      reader->ReadAllTensorsOn();
+      reader->ReadAllColorScalarsOn();
+      reader->ReadAllTCoordsOn();
+      reader->ReadAllFieldsOn();
+      reader->Update();
+      vtkDataObject* output = reader->GetOutputDataObject(0);
+      if (reader->GetErrorCode() == vtkErrorCode::NoError && output != nullptr)
+      {
+        result.TakeReference(output->NewInstance());
+        result->ShallowCopy(output);
+        // keeps recently used entries from being evicted.
+        vtksys::SystemTools::Touch(fname, /*create=*/false);
+      }
+    }
+  }
+  return result;
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVGeometryDiskCache::Store(const std::string& key, vtkDataObject* data)
+{
+  if (key.empty() || data == nullptr || !vtkPVGeometryDiskCache::IsEnabled())
+  {
+    return false;
+  }
+
+  const std::string& directory = vtkPVGeometryDiskCache::GetCacheDirectory();
+  if (!vtksys::SystemTools::FileIsDirectory(directory) &&
+    !vtksys::SystemTools::MakeDirectory(directory))
+  {
+    vtkErrorMacro("Failed to create geometry cache directory '" << directory << "'.");
+    return false;
+  }
+
+  const std::string fname = this->GetFileName(key);
+  const std::string tmpname = fname + ".tmp" + std::to_string(vtksys::SystemTools::GetTime());
+
+  vtkNew<vtkGenericDataObjectWriter> writer;
+  writer->SetInputDataObject(data);
+  writer->SetFileName(tmpname.c_str());
+  writer->SetFileTypeToBinary();
+  if (!writer->Write() || !vtksys::SystemTools::RenameFile(tmpname, fname))
+  {
+    vtksys::SystemTools::RemoveFile(tmpname);
+    vtkErrorMacro("Failed to write geometry cache file '" << fname << "'.");
+    return false;
+  }
+
+  vtkVLogF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "disk-cache %s: stored", key.c_str());
+  this->EnforceSizeLimit(fname);
+  return true;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVGeometryDiskCache::EnforceSizeLimit(const std::string& keep) const
+{
+  const unsigned long limit = vtkPVGeometryDiskCache::GetCacheSizeLimit();
+  const std::string& directory = vtkPVGeometryDiskCache::GetCacheDirectory();
+  vtksys::Directory dir;
+  if (limit == 0 || !dir.Load(directory))
+  {
+    return;
+  }
+
+  const int numRanks = this->Controller ? this->Controller->GetNumberOfProcesses() : 1;
+  const int rank = this->Controller ? this->Controller->GetLocalProcessId() : 0;
+  const unsigned long long rankLimit = (limit * 1024ull * 1024ull) / numRanks;
+  const std::string suffix = "." + std::to_string(rank) + ".vtk";
+
+  struct Entry
+  {
+    long int MTime;
+    unsigned long long Size;
+    std::string FileName;
+  };
+  std::vector<Entry> entries;
+  unsigned long long total = 0;
+  for (unsigned long cc = 0, max = dir.GetNumberOfFiles(); cc < max; ++cc)
+  {
+    const std::string name = dir.GetFile(cc);
+    if (!vtksys::SystemTools::StringEndsWith(name, suffix.c_str()))
+    {
+      continue;
+    }
+    const std::string fname = directory + "/" + name;
+    const unsigned long long size = vtksys::SystemTools::FileLength(fname);
+    entries.push_back(Entry{ vtksys::SystemTools::ModifiedTime(fname), size, fname });
+    total += size;
+  }
+
+  std::sort(entries.begin(), entries.end(),
+    [](const Entry& a, const Entry& b) { return a.MTime < b.MTime; });
+  for (const auto& entry : entries)
+  {
+    if (total <= rankLimit)
+    {
+      break;
+    }
+    if (entry.FileName != keep && vtksys::SystemTools::RemoveFile(entry.FileName))
+    {
+      vtkVLogF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "disk-cache evicted %s",
+        entry.FileName.c_str());
+      total -= entry.Size;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPVGeometryDiskCache::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "CacheDirectory: " << vtkPVGeometryDiskCache::GetCacheDirectory() << endl;
+  os << indent << "CacheSizeLimit: " << vtkPVGeometryDiskCache::GetCacheSizeLimit() << endl;
+  os << indent << "Controller: " << this->Controller << endl;
+}
@@ -0,0 +1,142 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class vtkPVGeometryDiskCache
+ * @brief persistent, on-disk tier for the geometry cached by views.
+ *
+ * vtkPVDataDeliveryManager keeps the geometry prepared by representations in
+ * memory only. vtkPVGeometryDiskCache adds an optional tier that stores that
+ * geometry on disk so that it can be reused across sessions without
+ * re-executing readers and geometry extraction filters.
+ *
+ * Only representations that opt in by overriding
+ * vtkPVDataRepresentation::GetDiskCacheParameters are cached, and only their
+ * data on port 0.
+ *
+ * Entries are identified by a key computed by `ComputeKey`. The key combines
+ * the signature of the pipeline feeding the representation (see
+ * vtkPVDataRepresentation::SetDiskCacheSignature), the names, modification
+ * times and sizes of the files read by that pipeline, the representation type
+ * and its disk cache parameters, the update time and the number of ranks. Each
+ * rank stores its own piece in `<CacheDirectory>/<key>.<rank>.vtk` using the
+ * binary legacy VTK file format.
+ *
+ * The disk cache is disabled unless a cache directory is provided using
+ * `vtkPVGeometryDiskCache::SetCacheDirectory` (which is what the
+ * `GeometryDiskCacheDirectory` general setting does). When the files in the
+ * directory exceed `CacheSizeLimit`, the least recently used ones are removed
+ * after each store. Each rank removes its own files and keeps its share of the
+ * limit.
+ *
+ * A hit only skips the execution of the representation's pipeline, i.e. what
+ * it would have pulled from upstream while updating. Pipelines updated
+ * explicitly, e.g. by vtkSMSourceProxy::UpdatePipeline when changes are
+ * applied in the GUI, still execute their readers and filters.
+ */
+
+#ifndef vtkPVGeometryDiskCache_h
+#define vtkPVGeometryDiskCache_h
+
+#include "vtkObject.h"
+#include "vtkRemotingViewsModule.h" // needed for exports
+#include "vtkSmartPointer.h"        // needed for vtkSmartPointer
+#include "vtkWeakPointer.h"         // needed for vtkWeakPointer
+
+#include <string> // needed for std::string
+
+class vtkDataObject;
+class vtkMultiProcessController;
+class vtkPVDataRepresentation;
+
+class VTKREMOTINGVIEWS_EXPORT vtkPVGeometryDiskCache : public vtkObject
+{
+public:
+  static vtkPVGeometryDiskCache* New();
+  vtkTypeMacro(vtkPVGeometryDiskCache, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Get/Set the directory used to store cached geometry. This is global to
+   * the process. An empty string (default) disables the disk cache.
+   */
+  static void SetCacheDirectory(const std::string& directory);
+  static const std::string& GetCacheDirectory();
+  ///@}
+
+  /**
+   * Returns true if a cache directory has been provided.
+   */
+  static bool IsEnabled() { return !vtkPVGeometryDiskCache::GetCacheDirectory().empty(); }
+
+  ///@{
+  /**
+   * Get/Set the maximum size of the cache directory in MiB. This is global to
+   * the process. 0 means no limit. Default is 10240 (10 GiB).
+   */
+  static void SetCacheSizeLimit(unsigned long limit);
+  static unsigned long GetCacheSizeLimit();
+  ///@}
+
+  ///@{
+  /**
+   * Get/Set the controller used to agree on cache hits across ranks. Defaults
+   * to the global controller.
+   */
+  void SetController(vtkMultiProcessController* controller);
+  vtkMultiProcessController* GetController() const;
+  ///@}
+
+  /**
+   * Computes the key identifying the data produced by `repr` on `port`.
+   * Returns an empty string when the representation has no disk cache
+   * signature, does not support the disk cache or when `port` is not 0, in
+   * which case its data must not be cached on disk.
+   */
+  std::string ComputeKey(vtkPVDataRepresentation* repr, int port) const;
+
+  /**
+   * Loads the local piece for `key`. This is a collective operation: a
+   * non-null data object is returned only if every rank found a valid entry,
+   * so that all ranks agree on whether the pipeline is to be executed.
+   */
+  vtkSmartPointer<vtkDataObject> Load(const std::string& key);
+
+  /**
+   * Loads the local piece for `key`, without agreeing with the other ranks.
+   * Returns nullptr when this rank has no valid entry. Callers are expected
+   * to reduce the result over all ranks, as `Load` does.
+   */
+  vtkSmartPointer<vtkDataObject> LoadLocal(const std::string& key);
+
+  /**
+   * Saves the local piece `data` for `key`. The file is first written under a
+   * temporary name and then renamed so that concurrent sessions never read
+   * partially written entries. Least recently used entries are then removed
+   * if the cache exceeds its size limit. Returns false on failure.
+   */
+  bool Store(const std::string& key, vtkDataObject* data);
+
+protected:
+  vtkPVGeometryDiskCache();
+  ~vtkPVGeometryDiskCache() override;
+
+  /**
+   * Returns the file name used by the local rank for `key`.
+   */
+  std::string GetFileName(const std::string& key) const;
+
+  /**
+   * Removes the least recently used files of the local rank, except `keep`,
+   * until they fit in the rank's share of `CacheSizeLimit`.
+   */
+  void EnforceSizeLimit(const std::string& keep) const;
+
+private:
+  vtkPVGeometryDiskCache(const vtkPVGeometryDiskCache&) = delete;
+  void operator=(const vtkPVGeometryDiskCache&) = delete;
+
+  vtkWeakPointer<vtkMultiProcessController> Controller;
+};
+
+#endif
@@ -2357,6 +2357,12 @@ void vtkPVRenderView::ConfigureCompressor(const char* configuration)
   this->SynchronizedRenderers->ConfigureCompressor(configuration);
 }
 
+//----------------------------------------------------------------------------
+void vtkPVRenderView::SetUseSharedMemoryImageTransport(bool val)
+{
+  this->SynchronizedRenderers->SetUseSharedMemoryImageTransport(val);
+}
+
 //----------------------------------------------------------------------------
 void vtkPVRenderView::InvalidateCachedSelection()
 {
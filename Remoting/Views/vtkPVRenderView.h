@@ -287,6 +287,14 @@ public:
    */
   void ConfigureCompressor(const char* configuration);
 
+  /**
+   * Enables handing rendered images over to the client through shared memory
+   * when the client and the server run on the same host.
+   * See vtkPVClientServerSynchronizedRenderers::SetUseSharedMemoryImageTransport().
+   * \note CallOnAllProcesses
+   */
+  void SetUseSharedMemoryImageTransport(bool);
+
   /**
    * Resets the clipping range. One does not need to call this directly ever. It
    * is called periodically by the vtkRenderer to reset the camera range.
@@ -790,6 +798,12 @@ public:
    */
   void Update() override;
 
+  /**
+   * Overridden to return true since representations in a render view deliver
+   * their data when rendering rather than when updating.
+   */
+  bool SupportsPrefetch() override { return true; }
+
   /**
    * Asks representations to update their LOD geometries.
    */
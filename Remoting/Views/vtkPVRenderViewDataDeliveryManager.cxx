@@ -3,7 +3,10 @@
 #include "vtkPVRenderViewDataDeliveryManager.h"
 #include "vtkPVDataDeliveryManagerInternals.h"
 
+#include "vtkCommunicator.h"
+#include "vtkCompositeDataSet.h"
 #include "vtkDIYKdTreeUtilities.h"
+#include "vtkDataSet.h"
 #include "vtkExtentTranslator.h"
 #include "vtkInformation.h"
 #include "vtkInformationDoubleVectorKey.h"
@@ -23,7 +26,9 @@
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkWeakPointer.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <map>
 #include <numeric>
 #include <queue>
@@ -75,6 +80,45 @@ vtkInformationKeyMacro(vtkPVRVDMKeys, ORDERED_COMPOSITING_CONFIGURATION, Integer
 vtkInformationKeyRestrictedMacro(vtkPVRVDMKeys, ORDERED_COMPOSITING_BOUNDS, DoubleVector, 6);
 vtkInformationKeyRestrictedMacro(vtkPVRVDMKeys, GEOMETRY_BOUNDS, DoubleVector, 6);
 vtkInformationKeyRestrictedMacro(vtkPVRVDMKeys, TRANSFORMED_GEOMETRY_BOUNDS, DoubleVector, 6);
+
+// Returns the bounds of the data used for load balancing, across all ranks.
+vtkBoundingBox GetGlobalBounds(
+  const std::vector<vtkDataObject*>& dobjs, vtkMultiProcessController* controller)
+{
+  vtkBoundingBox local_bounds;
+  for (auto dobj : dobjs)
+  {
+    for (auto ds : vtkCompositeDataSet::GetDataSets<vtkDataSet>(dobj))
+    {
+      if (ds->GetNumberOfPoints() > 0)
+      {
+        local_bounds.AddBounds(ds->GetBounds());
+      }
+    }
+  }
+
+  double lmin[3] = { VTK_DOUBLE_MAX, VTK_DOUBLE_MAX, VTK_DOUBLE_MAX };
+  double lmax[3] = { -VTK_DOUBLE_MAX, -VTK_DOUBLE_MAX, -VTK_DOUBLE_MAX };
+  if (local_bounds.IsValid())
+  {
+    local_bounds.GetMinPoint(lmin);
+    local_bounds.GetMaxPoint(lmax);
+  }
+  double gmin[3], gmax[3];
+  controller->AllReduce(lmin, gmin, 3, vtkCommunicator::MIN_OP);
+  controller->AllReduce(lmax, gmax, 3, vtkCommunicator::MAX_OP);
+
+  vtkBoundingBox global_bounds;
+  if (gmin[0] <= gmax[0] && gmin[1] <= gmax[1] && gmin[2] <= gmax[2])
+  {
+    global_bounds.SetBounds(gmin[0], gmax[0], gmin[1], gmax[1], gmin[2], gmax[2]);
+  }
+  return global_bounds;
+}
+
+// Relative precision, with respect to the size of the bounds, below which
+// two coordinates are considered equal when comparing kd-tree faces.
+constexpr double FaceEpsilon = 1e-9;
 } // end of namespace
 
 //*****************************************************************************
@@ -327,23 +371,48 @@ void vtkPVRenderViewDataDeliveryManager::RedistributeDataForOrderedCompositing(b
         }
         this->RawCuts.clear();
         this->RawCutsRankAssignments.clear();
+        this->CutsMTime.Modified();
       }
       else
       {
-        vtkVLogScopeF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "regenerate kd-tree");
-        this->Cuts = vtkDIYKdTreeUtilities::GenerateCuts(
-          data_for_loadbalacing, num_ranks, /*use_cell_centers*/ false, controller);
-
-        // save raw cuts and assignments.
-        this->RawCuts = this->Cuts;
-        this->RawCutsRankAssignments = vtkDIYKdTreeUtilities::ComputeAssignments(
-          static_cast<int>(this->RawCuts.size()), controller->GetNumberOfProcesses());
-
-        // Now, resize cuts to match the number of ranks we're rendering on.
-        vtkDIYKdTreeUtilities::ResizeCuts(this->Cuts, controller->GetNumberOfProcesses());
+        // when redistributing incrementally, keep the kd-tree as long as the
+        // data stays close to the bounds it was generated for.
+        const vtkBoundingBox bounds = this->IncrementalRedistribution
+          ? GetGlobalBounds(data_for_loadbalacing, controller)
+          : vtkBoundingBox();
+        if (this->IncrementalRedistribution && !this->RawCuts.empty() &&
+          vtkPVRenderViewDataDeliveryManager::AreBoundsClose(
+            this->CutsDataBounds, bounds, this->IncrementalRedistributionTolerance))
+        {
+          vtkVLogF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(),
+            "reusing kd-tree (data bounds changed by less than %g).",
+            this->IncrementalRedistributionTolerance);
+          // data already redistributed with the current cuts remains valid
+          // unless the outer faces moved.
+          if (vtkPVRenderViewDataDeliveryManager::GrowCuts(this->RawCuts, bounds))
+          {
+            vtkPVRenderViewDataDeliveryManager::GrowCuts(this->Cuts, bounds);
+            this->CutsMTime.Modified();
+          }
+        }
+        else
+        {
+          vtkVLogScopeF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "regenerate kd-tree");
+          this->CutsDataBounds = bounds;
+          this->Cuts = vtkDIYKdTreeUtilities::GenerateCuts(
+            data_for_loadbalacing, num_ranks, /*use_cell_centers*/ false, controller);
+
+          // save raw cuts and assignments.
+          this->RawCuts = this->Cuts;
+          this->RawCutsRankAssignments = vtkDIYKdTreeUtilities::ComputeAssignments(
+            static_cast<int>(this->RawCuts.size()), controller->GetNumberOfProcesses());
+
+          // Now, resize cuts to match the number of ranks we're rendering on.
+          vtkDIYKdTreeUtilities::ResizeCuts(this->Cuts, controller->GetNumberOfProcesses());
+          this->CutsMTime.Modified();
+        }
       }
       this->LastCutsGeneratorToken = token_stream.str();
-      this->CutsMTime.Modified();
     }
     else
     {
@@ -631,8 +700,84 @@ void vtkPVRenderViewDataDeliveryManager::MoveData(
   item->SetDeliveredDataObject(viewMode, cacheKey, dataMover->GetOutputDataObject(0));
 }
 
+//----------------------------------------------------------------------------
+bool vtkPVRenderViewDataDeliveryManager::AreBoundsClose(
+  const vtkBoundingBox& reference, const vtkBoundingBox& bounds, double tolerance)
+{
+  if (!reference.IsValid() || !bounds.IsValid())
+  {
+    return false;
+  }
+  const double max_length = reference.GetMaxLength();
+  const double epsilon = FaceEpsilon * max_length;
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    // use the largest length for flat bounds.
+    const double length =
+      reference.GetLength(axis) > epsilon ? reference.GetLength(axis) : max_length;
+    const double max_delta = tolerance * length + epsilon;
+    if (std::abs(bounds.GetMinPoint()[axis] - reference.GetMinPoint()[axis]) > max_delta ||
+      std::abs(bounds.GetMaxPoint()[axis] - reference.GetMaxPoint()[axis]) > max_delta)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVRenderViewDataDeliveryManager::GrowCuts(
+  std::vector<vtkBoundingBox>& cuts, const vtkBoundingBox& bounds)
+{
+  vtkBoundingBox outer;
+  for (const auto& cut : cuts)
+  {
+    outer.AddBox(cut);
+  }
+  if (!outer.IsValid() || !bounds.IsValid())
+  {
+    return false;
+  }
+
+  // faces of the cuts within epsilon of a face of the union are outer faces;
+  // bounds within epsilon of the union are contained.
+  const double epsilon = FaceEpsilon * outer.GetMaxLength();
+  bool grow = false;
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    grow |= bounds.GetMinPoint()[axis] < outer.GetMinPoint()[axis] - epsilon;
+    grow |= bounds.GetMaxPoint()[axis] > outer.GetMaxPoint()[axis] + epsilon;
+  }
+  if (!grow)
+  {
+    return false;
+  }
+
+  for (auto& cut : cuts)
+  {
+    double cbds[6];
+    cut.GetBounds(cbds);
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      if (cbds[2 * axis] <= outer.GetMinPoint()[axis] + epsilon)
+      {
+        cbds[2 * axis] = std::min(cbds[2 * axis], bounds.GetMinPoint()[axis]);
+      }
+      if (cbds[2 * axis + 1] >= outer.GetMaxPoint()[axis] - epsilon)
+      {
+        cbds[2 * axis + 1] = std::max(cbds[2 * axis + 1], bounds.GetMaxPoint()[axis]);
+      }
+    }
+    cut.SetBounds(cbds);
+  }
+  return true;
+}
+
 //----------------------------------------------------------------------------
 void vtkPVRenderViewDataDeliveryManager::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "IncrementalRedistribution: " << this->IncrementalRedistribution << endl;
+  os << indent
+     << "IncrementalRedistributionTolerance: " << this->IncrementalRedistributionTolerance << endl;
 }
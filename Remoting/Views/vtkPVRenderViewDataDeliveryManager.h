@@ -175,6 +175,42 @@ public:
   const std::vector<int>& GetRawCutsRankAssignments() const { return this->RawCutsRankAssignments; }
   ///@}
 
+  ///@{
+  /**
+   * When set to true, the kd-tree generated for ordered compositing is reused
+   * when the data changes, e.g. on a new time step, as long as the bounds of
+   * the data used for load balancing stay within
+   * IncrementalRedistributionTolerance times the size of the bounds the
+   * kd-tree was generated for, along each axis. The outer faces of the cuts
+   * grow to include the new bounds and the data is redistributed using the
+   * same partitioning. This skips the collective kd-tree generation and keeps
+   * each rank on the same region. Since the kd-tree is not rebalanced, it is
+   * regenerated once the bounds moved farther. Default is false.
+   */
+  vtkSetMacro(IncrementalRedistribution, bool);
+  vtkGetMacro(IncrementalRedistribution, bool);
+  vtkBooleanMacro(IncrementalRedistribution, bool);
+  vtkSetClampMacro(IncrementalRedistributionTolerance, double, 0.0, 1.0);
+  vtkGetMacro(IncrementalRedistributionTolerance, double);
+  ///@}
+
+  /**
+   * Returns true if each face of `bounds` is within `tolerance` times the
+   * length of `reference` along its axis from the same face of `reference`.
+   * Used to decide whether the kd-tree can be reused when
+   * IncrementalRedistribution is enabled.
+   */
+  static bool AreBoundsClose(
+    const vtkBoundingBox& reference, const vtkBoundingBox& bounds, double tolerance);
+
+  /**
+   * Moves the faces of the `cuts` that are on the boundary of their union
+   * outwards to include `bounds`. Inner faces are left unchanged. Returns true
+   * if any cut changed. Faces are compared with a small tolerance relative to
+   * the size of the cuts.
+   */
+  static bool GrowCuts(std::vector<vtkBoundingBox>& cuts, const vtkBoundingBox& bounds);
+
 protected:
   vtkPVRenderViewDataDeliveryManager();
   ~vtkPVRenderViewDataDeliveryManager() override;
@@ -188,10 +224,13 @@ protected:
   std::vector<vtkBoundingBox> RawCuts;
   std::vector<int> RawCutsRankAssignments;
   vtkTimeStamp CutsMTime;
+  vtkBoundingBox CutsDataBounds;
 
   vtkTimeStamp RedistributionTimeStamp;
   std::string LastCutsGeneratorToken;
   bool UseRedistributedDataAsDeliveredData = false;
+  bool IncrementalRedistribution = false;
+  double IncrementalRedistributionTolerance = 0.05;
 
 private:
   vtkPVRenderViewDataDeliveryManager(const vtkPVRenderViewDataDeliveryManager&) = delete;
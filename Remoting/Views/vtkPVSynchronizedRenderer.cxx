@@ -84,7 +84,9 @@ void vtkPVSynchronizedRenderer::Initialize(vtkPVSession* session)
         }
         else
         {
-          this->CSSynchronizer = vtkPVClientServerSynchronizedRenderers::New();
+          auto cssync = vtkPVClientServerSynchronizedRenderers::New();
+          cssync->SetSession(session);
+          this->CSSynchronizer = cssync;
           this->CSSynchronizer->WriteBackImagesOn();
         }
         this->CSSynchronizer->SetRootProcessId(0);
@@ -228,6 +230,21 @@ void vtkPVSynchronizedRenderer::SetLossLessCompression(bool val)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkPVSynchronizedRenderer::SetUseSharedMemoryImageTransport(bool val)
+{
+  vtkPVClientServerSynchronizedRenderers* cssync =
+    vtkPVClientServerSynchronizedRenderers::SafeDownCast(this->CSSynchronizer);
+  if (cssync)
+  {
+    cssync->SetUseSharedMemoryImageTransport(val);
+  }
+  else
+  {
+    vtkDebugMacro("Not in client-server mode.");
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkPVSynchronizedRenderer::ConfigureCompressor(const char* configuration)
 {
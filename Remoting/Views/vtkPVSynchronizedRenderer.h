@@ -127,6 +127,12 @@ public:
   void SetLossLessCompression(bool);
   ///@}
 
+  /**
+   * Passes the flag to the client-server synchronizer, if any.
+   * See vtkPVClientServerSynchronizedRenderers::SetUseSharedMemoryImageTransport().
+   */
+  void SetUseSharedMemoryImageTransport(bool);
+
   /**
    * Activates or de-activated the use of Depth Buffer in an ImageProcessingPass
    */
@@ -17,6 +17,7 @@
 #include "vtkOpenGLState.h"
 #include "vtkPVDataDeliveryManager.h"
 #include "vtkPVDataRepresentation.h"
+#include "vtkPVGeometryDiskCache.h"
 #include "vtkPVLogger.h"
 #include "vtkPVProcessWindow.h"
 #include "vtkPVRenderingCapabilitiesInformation.h"
@@ -33,6 +34,7 @@
 #include <cassert>
 #include <map>
 #include <sstream>
+#include <vector>
 
 namespace
 {
@@ -193,6 +195,7 @@ vtkPVView::vtkPVView(bool create_render_window)
   this->ViewTime = 0.0;
   this->CacheKey = 0.0;
   this->UseCache = false;
+  this->CacheMemoryLimit = 0;
 
   this->RequestInformation = vtkInformation::New();
   this->ReplyInformationVector = vtkInformationVector::New();
@@ -413,6 +416,7 @@ void vtkPVView::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "ViewTime: " << this->ViewTime << endl;
   os << indent << "CacheKey: " << this->CacheKey << endl;
   os << indent << "UseCache: " << this->UseCache << endl;
+  os << indent << "CacheMemoryLimit: " << this->CacheMemoryLimit << endl;
 }
 
 //----------------------------------------------------------------------------
@@ -433,16 +437,42 @@ void vtkPVView::Update()
   vtkVLogScopeF(PARAVIEW_LOG_RENDERING_VERBOSITY(), "%s: update view", this->GetLogName().c_str());
 
   // Propagate update time.
+  this->PropagateUpdateTime(this->ViewTimeValid, this->GetViewTime());
+
+  vtkTimerLog::MarkStartEvent("vtkPVView::Update");
+  this->LoadFromDiskCache();
+  const int count = this->CallProcessViewRequest(
+    vtkPVView::REQUEST_UPDATE(), this->RequestInformation, this->ReplyInformationVector);
+  vtkTimerLog::MarkEndEvent("vtkPVView::Update");
+
+  // exchange information about representations that are time-dependent.
+  // this goes from data-server-root to client and render-server.
+  if (count)
+  {
+    this->SynchronizeRepresentationTemporalPipelineStates();
+  }
+
+  if (this->UseCache && this->DeliveryManager)
+  {
+    this->DeliveryManager->MarkCacheKeyUsed(this->CacheKey);
+    this->EnforceCacheMemoryLimit();
+  }
+
+  this->UpdateTimeStamp.Modified();
+}
+
+//----------------------------------------------------------------------------
+void vtkPVView::PropagateUpdateTime(bool timeValid, double time)
+{
   const int num_reprs = this->GetNumberOfRepresentations();
-  const auto view_time = this->GetViewTime();
   for (int cc = 0; cc < num_reprs; cc++)
   {
     if (auto pvrepr = vtkPVDataRepresentation::SafeDownCast(this->GetRepresentation(cc)))
     {
       // Pass the view time information to the representation
-      if (this->ViewTimeValid)
+      if (timeValid)
       {
-        pvrepr->SetUpdateTime(view_time);
+        pvrepr->SetUpdateTime(time);
       }
       else
       {
@@ -450,20 +480,98 @@ void vtkPVView::Update()
       }
     }
   }
+}
 
-  vtkTimerLog::MarkStartEvent("vtkPVView::Update");
-  const int count = this->CallProcessViewRequest(
+//----------------------------------------------------------------------------
+void vtkPVView::Prefetch(double time, double cacheKey)
+{
+  if (!this->UseCache || this->DeliveryManager == nullptr || !this->SupportsPrefetch())
+  {
+    return;
+  }
+
+  vtkVLogScopeF(PARAVIEW_LOG_RENDERING_VERBOSITY(), "%s: prefetch time %f",
+    this->GetLogName().c_str(), time);
+
+  // Update time-dependent representations for the requested time. Their
+  // results are saved in the cache using `cacheKey`; representations for which
+  // that key is already cached skip the update.
+  const double currentCacheKey = this->CacheKey;
+  this->CacheKey = cacheKey;
+  this->PropagateUpdateTime(true, time);
+  this->LoadFromDiskCache();
+  this->CallProcessViewRequest(
     vtkPVView::REQUEST_UPDATE(), this->RequestInformation, this->ReplyInformationVector);
-  vtkTimerLog::MarkEndEvent("vtkPVView::Update");
 
-  // exchange information about representations that are time-dependent.
-  // this goes from data-server-root to client and render-server.
-  if (count)
+  // the prefetched frame is about to be shown, it must be the last one to be
+  // evicted.
+  this->DeliveryManager->MarkCacheKeyUsed(cacheKey);
+
+  // Go back to the current time. The data for the current cache key is still
+  // in the cache since Prefetch() does not evict anything, so this does not
+  // execute any pipeline. It simply makes the representations use the cached
+  // data for the frame being shown again. Nor does it count as a cache hit
+  // since the frame being shown was already counted when it was updated.
+  this->CacheKey = currentCacheKey;
+  this->PropagateUpdateTime(this->ViewTimeValid, this->GetViewTime());
+  this->DeliveryManager->SetRecordCacheStatistics(false);
+  this->CallProcessViewRequest(
+    vtkPVView::REQUEST_UPDATE(), this->RequestInformation, this->ReplyInformationVector);
+  this->DeliveryManager->SetRecordCacheStatistics(true);
+}
+
+//----------------------------------------------------------------------------
+void vtkPVView::LoadFromDiskCache()
+{
+  // the on-disk cache is only consulted on processes that execute the data
+  // processing pipeline.
+  if (this->DeliveryManager == nullptr || !vtkPVGeometryDiskCache::IsEnabled() ||
+    !this->Session || !this->Session->HasProcessRole(vtkPVSession::DATA_SERVER))
   {
-    this->SynchronizeRepresentationTemporalPipelineStates();
+    return;
   }
 
-  this->UpdateTimeStamp.Modified();
+  std::vector<vtkPVDataRepresentation*> reprs;
+  const int num_reprs = this->GetNumberOfRepresentations();
+  for (int cc = 0; cc < num_reprs; cc++)
+  {
+    auto pvrepr = vtkPVDataRepresentation::SafeDownCast(this->GetRepresentation(cc));
+    if (pvrepr && pvrepr->GetVisibility())
+    {
+      reprs.push_back(pvrepr);
+    }
+  }
+  this->DeliveryManager->LoadPiecesFromDiskCache(reprs, this->CacheKey);
+}
+
+//----------------------------------------------------------------------------
+void vtkPVView::EnforceCacheMemoryLimit()
+{
+  if (this->CacheMemoryLimit == 0)
+  {
+    return;
+  }
+
+  // Cache sizes differ between processes, but the cache keys and the order in
+  // which they were used do not. Hence evicting the least recently used key on
+  // all processes until the largest cache fits keeps the caches consistent,
+  // which is required since processes must agree on which representations
+  // need to update.
+  while (true)
+  {
+    vtkTypeUInt64 maxSize = 0;
+    this->AllReduce(this->DeliveryManager->GetCacheSize(), maxSize, vtkCommunicator::MAX_OP);
+    double key;
+    if (maxSize <= this->CacheMemoryLimit ||
+      !this->DeliveryManager->GetLeastRecentlyUsedCacheKey(this->CacheKey, key))
+    {
+      break;
+    }
+    vtkVLogF(PARAVIEW_LOG_RENDERING_VERBOSITY(), "%s: cache size %llu KiB exceeds %llu KiB",
+      this->GetLogName().c_str(), static_cast<unsigned long long>(maxSize),
+      static_cast<unsigned long long>(this->CacheMemoryLimit));
+    this->DeliveryManager->EvictCacheKey(key);
+  }
 }
 
 //----------------------------------------------------------------------------
@@ -855,7 +963,7 @@ vtkPVSession* vtkPVView::GetSession()
 //----------------------------------------------------------------------------
 bool vtkPVView::IsCached(vtkPVDataRepresentation* repr)
 {
-  if (this->DeliveryManager && this->DeliveryManager->HasPiece(repr))
+  if (this->DeliveryManager && this->DeliveryManager->IsCached(repr))
   {
     vtkLogF(TRACE, "cached %s", repr->GetLogName().c_str());
     return true;
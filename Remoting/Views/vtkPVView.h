@@ -108,6 +108,17 @@ public:
   vtkGetMacro(UseCache, bool);
   ///@}
 
+  ///@{
+  /**
+   * Get/Set the maximum memory, in KiB, that data cached on any process for
+   * this view may use when caching is enabled. When exceeded, data for the
+   * least recently used cache keys is evicted. 0 (default) means no limit.
+   * \note CallOnAllProcesses
+   */
+  vtkSetMacro(CacheMemoryLimit, vtkTypeUInt64);
+  vtkGetMacro(CacheMemoryLimit, vtkTypeUInt64);
+  ///@}
+
   ///@{
   /**
    * These methods are used to setup the view for capturing screen shots.
@@ -151,6 +162,26 @@ public:
    */
   void Update() override;
 
+  /**
+   * Speculatively updates the representations for `time` and saves the
+   * results in the cache using `cacheKey`. The representations are then
+   * restored to the state they had before this call. This is used to prepare
+   * the next frame while playing an animation with caching enabled.
+   *
+   * Unlike Update(), this method does not communicate with the client. Hence
+   * it is only called on the server processes and the client does not have to
+   * wait for it to complete. Does nothing unless UseCache is true and
+   * SupportsPrefetch() returns true.
+   */
+  void Prefetch(double time, double cacheKey);
+
+  /**
+   * Returns true if Prefetch() is supported by this view. That is only the
+   * case if its representations do not communicate with the client when
+   * updating. Default is false.
+   */
+  virtual bool SupportsPrefetch() { return false; }
+
   /**
    * Returns true if the application is currently in tile display mode.
    */
@@ -350,6 +381,7 @@ protected:
   double ViewTime;
   double CacheKey;
   bool UseCache;
+  vtkTypeUInt64 CacheMemoryLimit;
 
   int Size[2];
   int Position[2];
@@ -372,6 +404,25 @@ private:
    */
   void SynchronizeRepresentationTemporalPipelineStates();
 
+  /**
+   * Called in Update() to evict cached data until CacheMemoryLimit is
+   * respected on all processes.
+   */
+  void EnforceCacheMemoryLimit();
+
+  /**
+   * Called before representations update to load their data from the on-disk
+   * geometry cache, if enabled. Whether the cached data can be used is
+   * decided once for all representations since it requires all processes to
+   * agree. IsCached() then uses the loaded data.
+   */
+  void LoadFromDiskCache();
+
+  /**
+   * Passes the update time to all representations.
+   */
+  void PropagateUpdateTime(bool timeValid, double time);
+
   vtkRenderWindow* RenderWindow;
   bool ViewTimeValid;
   static bool EnableStreaming;
@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkPVViewCacheInformation.h"
+
+#include "vtkClientServerStream.h"
+#include "vtkObjectFactory.h"
+#include "vtkPVDataDeliveryManager.h"
+#include "vtkPVView.h"
+
+#include <algorithm>
+
+vtkStandardNewMacro(vtkPVViewCacheInformation);
+//----------------------------------------------------------------------------
+vtkPVViewCacheInformation::vtkPVViewCacheInformation()
+  : NumberOfHits(0)
+  , NumberOfMisses(0)
+  , NumberOfEvictions(0)
+  , NumberOfEntries(0)
+  , CacheSize(0)
+  , MaximumCacheSize(0)
+  , CacheMemoryLimit(0)
+{
+}
+
+//----------------------------------------------------------------------------
+vtkPVViewCacheInformation::~vtkPVViewCacheInformation() = default;
+
+//----------------------------------------------------------------------------
+void vtkPVViewCacheInformation::CopyFromObject(vtkObject* object)
+{
+  vtkPVView* view = vtkPVView::SafeDownCast(object);
+  if (!view)
+  {
+    vtkErrorMacro("Incorrect object: " << (object ? object->GetClassName() : "(null)"));
+    return;
+  }
+
+  this->CacheMemoryLimit = view->GetCacheMemoryLimit();
+  if (auto mgr = view->GetDeliveryManager())
+  {
+    this->NumberOfHits = mgr->GetNumberOfCacheHits();
+    this->NumberOfMisses = mgr->GetNumberOfCacheMisses();
+    this->NumberOfEvictions = mgr->GetNumberOfCacheEvictions();
+    this->NumberOfEntries = static_cast<vtkTypeUInt64>(mgr->GetNumberOfCacheEntries());
+    this->CacheSize = mgr->GetCacheSize();
+    this->MaximumCacheSize = this->CacheSize;
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPVViewCacheInformation::AddInformation(vtkPVInformation* info)
+{
+  vtkPVViewCacheInformation* other = vtkPVViewCacheInformation::SafeDownCast(info);
+  if (!other)
+  {
+    return;
+  }
+
+  // all processes go through the same updates, hence the counters are expected
+  // to match; only sizes vary between processes.
+  this->NumberOfHits = std::max(this->NumberOfHits, other->NumberOfHits);
+  this->NumberOfMisses = std::max(this->NumberOfMisses, other->NumberOfMisses);
+  this->NumberOfEvictions = std::max(this->NumberOfEvictions, other->NumberOfEvictions);
+  this->NumberOfEntries += other->NumberOfEntries;
+  this->CacheSize += other->CacheSize;
+  this->MaximumCacheSize = std::max(this->MaximumCacheSize, other->MaximumCacheSize);
+  this->CacheMemoryLimit = std::max(this->CacheMemoryLimit, other->CacheMemoryLimit);
+}
+
+//----------------------------------------------------------------------------
+void vtkPVViewCacheInformation::CopyToStream(vtkClientServerStream* css)
+{
+  css->Reset();
+  *css << vtkClientServerStream::Reply << this->NumberOfHits << this->NumberOfMisses
+       << this->NumberOfEvictions << this->NumberOfEntries << this->CacheSize
+       << this->MaximumCacheSize << this->CacheMemoryLimit << vtkClientServerStream::End;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVViewCacheInformation::CopyFromStream(const vtkClientServerStream* css)
+{
+  css->GetArgument(0, 0, &this->NumberOfHits);
+  css->GetArgument(0, 1, &this->NumberOfMisses);
+  css->GetArgument(0, 2, &this->NumberOfEvictions);
+  css->GetArgument(0, 3, &this->NumberOfEntries);
+  css->GetArgument(0, 4, &this->CacheSize);
+  css->GetArgument(0, 5, &this->MaximumCacheSize);
+  css->GetArgument(0, 6, &this->CacheMemoryLimit);
+}
+
+//----------------------------------------------------------------------------
+void vtkPVViewCacheInformation::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfHits: " << this->NumberOfHits << endl;
+  os << indent << "NumberOfMisses: " << this->NumberOfMisses << endl;
+  os << indent << "NumberOfEvictions: " << this->NumberOfEvictions << endl;
+  os << indent << "NumberOfEntries: " << this->NumberOfEntries << endl;
+  os << indent << "CacheSize: " << this->CacheSize << endl;
+  os << indent << "MaximumCacheSize: " << this->MaximumCacheSize << endl;
+  os << indent << "CacheMemoryLimit: " << this->CacheMemoryLimit << endl;
+}
@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkPVViewCacheInformation
+ * @brief   information about the data cached by a view.
+ *
+ * vtkPVViewCacheInformation is used to collect statistics about the data a
+ * vtkPVView caches for animation playback (see vtkPVView::SetUseCache and
+ * vtkPVView::SetCacheMemoryLimit). Counters are the largest over all
+ * processes. The cache size is reported both as the total over all
+ * processes and as the largest on any process, the latter being the one
+ * compared against the view's memory limit.
+ */
+
+#ifndef vtkPVViewCacheInformation_h
+#define vtkPVViewCacheInformation_h
+
+#include "vtkPVInformation.h"
+#include "vtkRemotingViewsModule.h" //needed for exports
+
+class VTKREMOTINGVIEWS_EXPORT vtkPVViewCacheInformation : public vtkPVInformation
+{
+public:
+  static vtkPVViewCacheInformation* New();
+  vtkTypeMacro(vtkPVViewCacheInformation, vtkPVInformation);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Transfer information about a single object into this object.
+   */
+  void CopyFromObject(vtkObject*) override;
+
+  /**
+   * Merge another information object.
+   */
+  void AddInformation(vtkPVInformation* info) override;
+
+  ///@{
+  /**
+   * Manage a serialized version of the information.
+   */
+  void CopyToStream(vtkClientServerStream*) override;
+  void CopyFromStream(const vtkClientServerStream*) override;
+  ///@}
+
+  ///@{
+  /**
+   * Number of times representations found (hits) or did not find (misses)
+   * their data in the cache when updating, and number of cached data objects
+   * evicted to respect the memory limit.
+   */
+  vtkGetMacro(NumberOfHits, vtkTypeUInt64);
+  vtkGetMacro(NumberOfMisses, vtkTypeUInt64);
+  vtkGetMacro(NumberOfEvictions, vtkTypeUInt64);
+  ///@}
+
+  ///@{
+  /**
+   * Number of cached data objects and their size, in KiB, summed over all
+   * processes.
+   */
+  vtkGetMacro(NumberOfEntries, vtkTypeUInt64);
+  vtkGetMacro(CacheSize, vtkTypeUInt64);
+  ///@}
+
+  /**
+   * Largest cache size, in KiB, on any process.
+   */
+  vtkGetMacro(MaximumCacheSize, vtkTypeUInt64);
+
+  /**
+   * The view's memory limit in KiB, 0 if unlimited.
+   */
+  vtkGetMacro(CacheMemoryLimit, vtkTypeUInt64);
+
+protected:
+  vtkPVViewCacheInformation();
+  ~vtkPVViewCacheInformation() override;
+
+  vtkTypeUInt64 NumberOfHits;
+  vtkTypeUInt64 NumberOfMisses;
+  vtkTypeUInt64 NumberOfEvictions;
+  vtkTypeUInt64 NumberOfEntries;
+  vtkTypeUInt64 CacheSize;
+  vtkTypeUInt64 MaximumCacheSize;
+  vtkTypeUInt64 CacheMemoryLimit;
+
+private:
+  vtkPVViewCacheInformation(const vtkPVViewCacheInformation&) = delete;
+  void operator=(const vtkPVViewCacheInformation&) = delete;
+};
+
+#endif
@@ -5,24 +5,136 @@
 #include "vtkClientServerStream.h"
 #include "vtkCommand.h"
 #include "vtkDataObject.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPVDataRepresentation.h"
 #include "vtkPVLogger.h"
 #include "vtkPVProminentValuesInformation.h"
 #include "vtkPVRepresentedDataInformation.h"
+#include "vtkSMCoreUtilities.h"
+#include "vtkSMDoubleVectorProperty.h"
+#include "vtkSMIdTypeVectorProperty.h"
 #include "vtkSMInputProperty.h"
+#include "vtkSMIntVectorProperty.h"
 #include "vtkSMPropertyHelper.h"
+#include "vtkSMPropertyIterator.h"
 #include "vtkSMProxyInternals.h"
 #include "vtkSMSession.h"
 #include "vtkSMStringListDomain.h"
+#include "vtkSMStringVectorProperty.h"
 #include "vtkSMTrace.h"
 #include "vtkTimerLog.h"
 
 #include <cassert>
+#include <map>
 #include <sstream>
 
 #define MAX_NUMBER_OF_INTERNAL_REPRESENTATIONS 10
 
+namespace
+{
+// Appends the values of all properties of `proxy` to `stream`. When
+// `inputsOnly` is true, only input properties are described. This is used for
+// the representation itself since most of its properties only affect
+// appearance. The few that affect the data it prepares are described on the
+// server by vtkPVDataRepresentation::GetDiskCacheParameters.
+void AppendDiskCacheSignature(vtkSMProxy* proxy, bool inputsOnly, std::ostream& stream,
+  std::map<vtkSMProxy*, int>& visited, std::vector<std::string>& fileNames)
+{
+  stream << proxy->GetXMLGroup() << ":" << proxy->GetXMLName();
+  auto iter = visited.find(proxy);
+  if (iter != visited.end())
+  {
+    // proxy already described, e.g. pipelines with multiple inputs sharing a
+    // common upstream source.
+    stream << "#" << iter->second << "\n";
+    return;
+  }
+  const int index = static_cast<int>(visited.size());
+  visited[proxy] = index;
+  stream << "#" << index << "\n";
+
+  vtkNew<vtkSMPropertyIterator> piter;
+  piter->SetProxy(proxy);
+  for (piter->Begin(); !piter->IsAtEnd(); piter->Next())
+  {
+    vtkSMProperty* prop = piter->GetProperty();
+    if (prop == nullptr || prop->GetInformationOnly())
+    {
+      continue;
+    }
+
+    auto inputProp = vtkSMInputProperty::SafeDownCast(prop);
+    if (inputsOnly && inputProp == nullptr)
+    {
+      continue;
+    }
+    if (auto proxyProp = vtkSMProxyProperty::SafeDownCast(prop))
+    {
+      stream << piter->GetKey() << " {\n";
+      for (unsigned int cc = 0, max = proxyProp->GetNumberOfProxies(); cc < max; ++cc)
+      {
+        if (auto other = proxyProp->GetProxy(cc))
+        {
+          if (inputProp)
+          {
+            stream << "port " << inputProp->GetOutputPortForConnection(cc) << " ";
+          }
+          AppendDiskCacheSignature(other, false, stream, visited, fileNames);
+        }
+      }
+      stream << "}\n";
+      continue;
+    }
+
+    stream << piter->GetKey() << ":";
+    if (auto dvp = vtkSMDoubleVectorProperty::SafeDownCast(prop))
+    {
+      for (unsigned int cc = 0, max = dvp->GetNumberOfElements(); cc < max; ++cc)
+      {
+        stream << " " << dvp->GetElement(cc);
+      }
+    }
+    else if (auto ivp = vtkSMIntVectorProperty::SafeDownCast(prop))
+    {
+      for (unsigned int cc = 0, max = ivp->GetNumberOfElements(); cc < max; ++cc)
+      {
+        stream << " " << ivp->GetElement(cc);
+      }
+    }
+    else if (auto idvp = vtkSMIdTypeVectorProperty::SafeDownCast(prop))
+    {
+      for (unsigned int cc = 0, max = idvp->GetNumberOfElements(); cc < max; ++cc)
+      {
+        stream << " " << idvp->GetElement(cc);
+      }
+    }
+    else if (auto svp = vtkSMStringVectorProperty::SafeDownCast(prop))
+    {
+      for (unsigned int cc = 0, max = svp->GetNumberOfElements(); cc < max; ++cc)
+      {
+        const char* value = svp->GetElement(cc);
+        stream << " \"" << (value ? value : "") << "\"";
+      }
+    }
+    stream << "\n";
+  }
+
+  for (const auto& pname : vtkSMCoreUtilities::GetFileNameProperties(proxy))
+  {
+    vtkSMPropertyHelper helper(proxy, pname.c_str());
+    for (unsigned int cc = 0, max = helper.GetNumberOfElements(); cc < max; ++cc)
+    {
+      const char* fname = helper.GetAsString(cc);
+      if (fname && fname[0])
+      {
+        fileNames.emplace_back(fname);
+      }
+    }
+  }
+}
+}
+
 vtkStandardNewMacro(vtkSMRepresentationProxy);
 //----------------------------------------------------------------------------
 vtkSMRepresentationProxy::vtkSMRepresentationProxy()
@@ -460,3 +572,14 @@ bool vtkSMRepresentationProxy::GetUsing2DTransferFunction()
     return false;
   }
 }
+
+//----------------------------------------------------------------------------
+std::string vtkSMRepresentationProxy::ComputeDiskCacheSignature(
+  std::vector<std::string>& fileNames)
+{
+  std::ostringstream stream;
+  stream.precision(17);
+  std::map<vtkSMProxy*, int> visited;
+  AppendDiskCacheSignature(this, /*inputsOnly=*/true, stream, visited, fileNames);
+  return stream.str();
+}
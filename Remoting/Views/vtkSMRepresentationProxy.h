@@ -67,6 +67,9 @@
 #include "vtkRemotingViewsModule.h" //needed for exports
 #include "vtkSMSourceProxy.h"
 
+#include <string> // for std::string
+#include <vector> // for std::vector
+
 class vtkPVProminentValuesInformation;
 namespace vtkPVComparativeViewNS
 {
@@ -174,6 +177,16 @@ public:
   bool GetUsing2DTransferFunction();
   ///@}
 
+  /**
+   * Computes a signature describing the data processing pipeline feeding this
+   * representation, for use with vtkPVDataRepresentation::SetDiskCacheSignature.
+   * The signature includes the values of all properties of the upstream
+   * proxies but not those of this representation, most of which only affect
+   * appearance. The names of the files read by upstream proxies are appended
+   * to `fileNames`.
+   */
+  std::string ComputeDiskCacheSignature(std::vector<std::string>& fileNames);
+
   void MarkDirty(vtkSMProxy* modifiedProxy) override;
 
 protected:
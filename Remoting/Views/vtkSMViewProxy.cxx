@@ -12,6 +12,7 @@
 #include "vtkMath.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkPVGeometryDiskCache.h"
 #include "vtkPVLogger.h"
 #include "vtkPVView.h"
 #include "vtkPVXMLElement.h"
@@ -29,6 +30,7 @@
 #include "vtkSMProxyProperty.h"
 #include "vtkSMRepresentationProxy.h"
 #include "vtkSMSession.h"
+#include "vtkSMSessionClient.h"
 #include "vtkSMSessionProxyManager.h"
 #include "vtkSMUncheckedPropertyHelper.h"
 #include "vtkSMUtilities.h"
@@ -39,6 +41,8 @@
 #include "vtkWindowToImageFilter.h"
 
 #include <cassert>
+#include <string>
+#include <vector>
 
 namespace vtkSMViewProxyNS
 {
@@ -466,6 +470,27 @@ void vtkSMViewProxy::Update()
       stream << vtkClientServerStream::Invoke << VTKOBJECT(this) << "SetUseCache" << use_cache
              << vtkClientServerStream::End;
     }
+
+    if (vtkPVGeometryDiskCache::IsEnabled())
+    {
+      // pass the pipeline signatures so that representations can reuse
+      // geometry from the on-disk cache instead of executing the pipeline.
+      for (unsigned int cc = 0, max = this->GetNumberOfProducers(); cc < max; ++cc)
+      {
+        if (auto repr = vtkSMRepresentationProxy::SafeDownCast(this->GetProducerProxy(cc)))
+        {
+          std::vector<std::string> fileNames;
+          const std::string signature = repr->ComputeDiskCacheSignature(fileNames);
+          stream << vtkClientServerStream::Invoke << VTKOBJECT(repr) << "SetDiskCacheSignature"
+                 << signature.c_str() << vtkClientServerStream::End;
+          for (const auto& fname : fileNames)
+          {
+            stream << vtkClientServerStream::Invoke << VTKOBJECT(repr) << "AddDiskCacheFileName"
+                   << fname.c_str() << vtkClientServerStream::End;
+          }
+        }
+      }
+    }
     stream << vtkClientServerStream::Invoke << VTKOBJECT(this) << "Update"
            << vtkClientServerStream::End;
     this->GetSession()->PrepareProgress();
@@ -493,6 +518,36 @@ void vtkSMViewProxy::Update()
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkSMViewProxy::Prefetch(double time, double cacheKey)
+{
+  vtkPVView* pvview = vtkPVView::SafeDownCast(this->GetClientSideObject());
+  if (!this->ObjectsCreated || pvview == nullptr || !pvview->SupportsPrefetch())
+  {
+    return;
+  }
+
+  // in builtin sessions, the pipelines execute in the client process, hence
+  // nothing would overlap with the current frame and prefetching would only
+  // delay it.
+  if (vtkSMSessionClient::SafeDownCast(this->GetSession()) == nullptr)
+  {
+    return;
+  }
+
+  // as in Update(), pass the client-side value for UseCache along.
+  vtkClientServerStream stream;
+  const int use_cache = pvview->GetUseCache() ? 1 : 0;
+  stream << vtkClientServerStream::Invoke << VTKOBJECT(this) << "SetUseCache" << use_cache
+         << vtkClientServerStream::End;
+  stream << vtkClientServerStream::Invoke << VTKOBJECT(this) << "Prefetch" << time << cacheKey
+         << vtkClientServerStream::End;
+
+  // vtkPVView::Prefetch() does not involve the client, so the servers can
+  // prefetch while the client proceeds with the current frame.
+  this->ExecuteStream(stream, false, vtkPVSession::SERVERS);
+}
+
 //----------------------------------------------------------------------------
 vtkSMRepresentationProxy* vtkSMViewProxy::CreateDefaultRepresentation(
   vtkSMProxy* proxy, int outputPort)
@@ -70,6 +70,14 @@ public:
    */
   virtual void Update();
 
+  /**
+   * Calls vtkPVView::Prefetch on the server processes. This does not wait for
+   * the servers to finish prefetching. Does nothing if the view does not
+   * support prefetching or in builtin sessions, where there is no server to
+   * prefetch while the client proceeds.
+   */
+  virtual void Prefetch(double time, double cacheKey);
+
   /**
    * Returns true if the view can display the data produced by the producer's
    * port. Internally calls GetRepresentationType() and returns true only if the
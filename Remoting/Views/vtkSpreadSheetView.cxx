@@ -910,6 +910,8 @@ vtkTable* vtkSpreadSheetView::FetchBlockCallback(vtkIdType blockindex)
 
   // cout << "FetchBlockCallback" << endl;
   vtkTypeUInt64 data[2] = { this->Identifier, static_cast<vtkTypeUInt64>(blockindex) };
+  // the RMI bypasses the session, make sure the servers are up-to-date first.
+  this->GetSession()->FlushPendingMessages();
   if (auto dController = this->GetSession()->GetController(vtkPVSession::DATA_SERVER_ROOT))
   {
     dController->TriggerRMIOnAllChildren(data, sizeof(vtkTypeUInt64) * 2, FETCH_BLOCK_TAG);
@@ -3,6 +3,9 @@
 #include <vtkFileSequenceParser.h>
 #include <vtkNew.h>
 
+#include <string>
+#include <vector>
+
 bool check_group(vtkFileSequenceParser* parser, const char* fname, const char* seqname)
 {
   if (!parser->ParseFileSequence(fname))
@@ -30,6 +33,29 @@ bool check_no_group(vtkFileSequenceParser* parser, const char* fname)
   return true;
 }
 
+// parsing a list of names one after the other, which reuses the previous
+// match whenever possible, must give the same results as parsing each name
+// on its own.
+bool check_sequential(const std::vector<std::string>& fnames)
+{
+  vtkNew<vtkFileSequenceParser> parser;
+  for (const auto& fname : fnames)
+  {
+    vtkNew<vtkFileSequenceParser> reference;
+    const bool expected = reference->ParseFileSequence(fname.c_str());
+    if (parser->ParseFileSequence(fname.c_str()) != expected ||
+      (expected &&
+        (strcmp(parser->GetSequenceName(), reference->GetSequenceName()) != 0 ||
+          parser->GetSequenceIndexString() != reference->GetSequenceIndexString() ||
+          parser->GetSequenceIndex() != reference->GetSequenceIndex())))
+    {
+      cout << "ERROR: sequential parsing mismatch for '" << fname << "'" << endl;
+      return false;
+    }
+  }
+  return true;
+}
+
 int TestFileSequenceParser(int, char* argv[])
 {
   (void)argv;
@@ -50,5 +76,14 @@ int TestFileSequenceParser(int, char* argv[])
   check_no_group(seqParser.Get(), "foo.3dm");
   check_no_group(seqParser.Get(), "foo.2dm");
 
+  const std::vector<std::string> fnames = { "foo.1.csv", "foo.10.csv", "foo.2.csv", "foo.2dm",
+    "foo.3.csv", "foo.3dm", "foo.csv.10.0", "foo.csv.10.5", "foo.csv.11.0", "foo1.csv",
+    "foo12.csv", "plt0001000", "plt0001001", "prefix-021-suffix.ext", "prefix-1-suffix.ext",
+    "spcta.10", "spcta.9", "spcta1.10", "spcta12.10", "1_a.vtk", "12_a.vtk", "1_b.vtk" };
+  if (!check_sequential(fnames))
+  {
+    return EXIT_FAILURE;
+  }
+
   return EXIT_SUCCESS;
 }
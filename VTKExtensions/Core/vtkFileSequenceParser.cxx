@@ -4,6 +4,8 @@
 
 #include "vtkObjectFactory.h"
 
+#include <cctype>
+#include <cstring>
 #include <set>
 #include <string>
 #include <vtksys/RegularExpression.hxx>
@@ -36,6 +38,8 @@ vtkFileSequenceParser::vtkFileSequenceParser()
   reg_ex_last(new vtksys::RegularExpression("^(.*[^0-9])([0-9]+)([^0-9]*)$"))
   , SequenceIndex(-1)
   , SequenceName(nullptr)
+  , LastMatchIndexBegin(0)
+  , LastMatchIndexEnd(0)
 {
 }
 
@@ -55,11 +59,20 @@ vtkFileSequenceParser::~vtkFileSequenceParser()
 //-----------------------------------------------------------------------------
 bool vtkFileSequenceParser::ParseFileSequence(const char* file)
 {
+  if (this->ReuseLastMatch(file))
+  {
+    return true;
+  }
+
   bool match = false;
+  std::string::size_type indexBegin = std::string::npos;
+  std::string::size_type indexEnd = std::string::npos;
   if (this->reg_ex->find(file))
   {
     this->SetSequenceName(this->reg_ex->match(1).c_str());
     this->SequenceIndexString = this->reg_ex->match(2);
+    indexBegin = this->reg_ex->start(2);
+    indexEnd = this->reg_ex->end(2);
     match = true;
   }
   else if (this->reg_ex2->find(file))
@@ -68,6 +81,8 @@ bool vtkFileSequenceParser::ParseFileSequence(const char* file)
       this->reg_ex2->match(1) + this->reg_ex2->match(2) + ".." + this->reg_ex2->match(4))
                             .c_str());
     this->SequenceIndexString = this->reg_ex2->match(3);
+    indexBegin = this->reg_ex2->start(3);
+    indexEnd = this->reg_ex2->end(3);
     match = true;
   }
   else if (this->reg_ex3->find(file))
@@ -76,6 +91,8 @@ bool vtkFileSequenceParser::ParseFileSequence(const char* file)
       this->reg_ex3->match(1) + this->reg_ex3->match(2) + ".." + this->reg_ex3->match(4))
                             .c_str());
     this->SequenceIndexString = this->reg_ex3->match(3);
+    indexBegin = this->reg_ex3->start(3);
+    indexEnd = this->reg_ex3->end(3);
     match = true;
   }
   else if (this->reg_ex4->find(file))
@@ -84,6 +101,8 @@ bool vtkFileSequenceParser::ParseFileSequence(const char* file)
       ".." + this->reg_ex4->match(2) + this->reg_ex4->match(3) + "." + this->reg_ex4->match(4))
                             .c_str());
     this->SequenceIndexString = this->reg_ex4->match(1);
+    indexBegin = this->reg_ex4->start(1);
+    indexEnd = this->reg_ex4->end(1);
     match = true;
   }
   else if (this->reg_ex5->find(file))
@@ -92,6 +111,8 @@ bool vtkFileSequenceParser::ParseFileSequence(const char* file)
       ".." + this->reg_ex5->match(2) + this->reg_ex5->match(3) + "." + this->reg_ex5->match(4))
                             .c_str());
     this->SequenceIndexString = this->reg_ex5->match(1);
+    indexBegin = this->reg_ex5->start(1);
+    indexEnd = this->reg_ex5->end(1);
     match = true;
   }
   else
@@ -103,16 +124,85 @@ bool vtkFileSequenceParser::ParseFileSequence(const char* file)
       this->SetSequenceName(
         (this->reg_ex_last->match(1) + ".." + this->reg_ex_last->match(3) + ext).c_str());
       this->SequenceIndexString = this->reg_ex_last->match(2);
+      // positions are only meaningful in `file` when it has no directory.
+      if (strncmp(file, fname_wo_ext.c_str(), fname_wo_ext.size()) == 0)
+      {
+        indexBegin = this->reg_ex_last->start(2);
+        indexEnd = this->reg_ex_last->end(2);
+      }
       match = true;
     }
   }
   if (match)
   {
     this->SequenceIndex = atoi(this->SequenceIndexString.c_str());
+    this->RememberMatch(file, indexBegin, indexEnd);
   }
   return match;
 }
 
+//-----------------------------------------------------------------------------
+void vtkFileSequenceParser::RememberMatch(
+  const char* file, std::string::size_type indexBegin, std::string::size_type indexEnd)
+{
+  this->LastMatch.clear();
+  const std::string::size_type length = strlen(file);
+  if (indexBegin == std::string::npos || indexBegin >= indexEnd || indexEnd > length)
+  {
+    return;
+  }
+
+  // The patterns treat all digits alike and never split a run of digits
+  // across groups. Hence, when the index is a whole run of digits, any file
+  // name only differing by the digits of that run matches the same pattern,
+  // with the same sequence name.
+  for (std::string::size_type cc = indexBegin; cc < indexEnd; ++cc)
+  {
+    if (!isdigit(static_cast<unsigned char>(file[cc])))
+    {
+      return;
+    }
+  }
+  if ((indexBegin > 0 && isdigit(static_cast<unsigned char>(file[indexBegin - 1]))) ||
+    (indexEnd < length && isdigit(static_cast<unsigned char>(file[indexEnd]))))
+  {
+    return;
+  }
+  this->LastMatch = file;
+  this->LastMatchIndexBegin = indexBegin;
+  this->LastMatchIndexEnd = indexEnd;
+}
+
+//-----------------------------------------------------------------------------
+bool vtkFileSequenceParser::ReuseLastMatch(const char* file)
+{
+  if (this->LastMatch.empty())
+  {
+    return false;
+  }
+
+  const std::string::size_type length = strlen(file);
+  const std::string::size_type prefix = this->LastMatchIndexBegin;
+  const std::string::size_type suffix = this->LastMatch.size() - this->LastMatchIndexEnd;
+  if (length <= prefix + suffix || this->LastMatch.compare(0, prefix, file, prefix) != 0 ||
+    this->LastMatch.compare(this->LastMatchIndexEnd, suffix, file + length - suffix, suffix) != 0)
+  {
+    return false;
+  }
+  for (std::string::size_type cc = prefix; cc < length - suffix; ++cc)
+  {
+    if (!isdigit(static_cast<unsigned char>(file[cc])))
+    {
+      return false;
+    }
+  }
+
+  // SequenceName is unchanged.
+  this->SequenceIndexString.assign(file + prefix, length - prefix - suffix);
+  this->SequenceIndex = atoi(this->SequenceIndexString.c_str());
+  return true;
+}
+
 //-----------------------------------------------------------------------------
 void vtkFileSequenceParser::PrintSelf(ostream& os, vtkIndent indent)
 {
@@ -36,6 +36,11 @@ public:
    * Extract base file name sequence from the file.
    * Returns true if a sequence is detected and
    * sets SequenceName and SequenceIndex.
+   *
+   * When `file` only differs from the last file that was detected as part of
+   * a sequence by the digits of the sequence index, the previous result is
+   * reused without evaluating the regular expressions. Parsing sorted file
+   * names is hence much faster.
    */
   bool ParseFileSequence(const char* file);
 
@@ -72,10 +77,20 @@ protected:
   // Used internal so char * allocations are done automatically.
   vtkSetStringMacro(SequenceName);
 
+  // Remembers a match so that ReuseLastMatch() can use it. `indexBegin` and
+  // `indexEnd` locate the sequence index in `file`.
+  void RememberMatch(
+    const char* file, std::string::size_type indexBegin, std::string::size_type indexEnd);
+  bool ReuseLastMatch(const char* file);
+
   int SequenceIndex;
   char* SequenceName;
   std::string SequenceIndexString;
 
+  std::string LastMatch;
+  std::string::size_type LastMatchIndexBegin;
+  std::string::size_type LastMatchIndexEnd;
+
 private:
   vtkFileSequenceParser(const vtkFileSequenceParser&) = delete;
   void operator=(const vtkFileSequenceParser&) = delete;
@@ -3,12 +3,15 @@
 #include "vtkPVXMLElement.h"
 
 #include "vtkCollection.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkSmartPointer.h"
 
 vtkStandardNewMacro(vtkPVXMLElement);
 
 #include <cctype>
+#include <cstddef>
+#include <cstring>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -40,6 +43,62 @@ static bool vtkIsSpace(const std::string& str)
   return true;
 }
 
+// Length written in place of the length of null strings in the binary form.
+static const vtkTypeUInt32 vtkNullStringLength = 0xffffffff;
+
+// Helpers for the binary form. Strings are written as their length followed
+// by their characters and a null terminator, so that they can be used in place.
+static void vtkWriteBinary(std::string& buffer, vtkTypeUInt32 value)
+{
+  buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+static void vtkWriteBinary(std::string& buffer, const char* str, size_t length)
+{
+  if (!str)
+  {
+    vtkWriteBinary(buffer, vtkNullStringLength);
+    return;
+  }
+  vtkWriteBinary(buffer, static_cast<vtkTypeUInt32>(length));
+  buffer.append(str, length);
+  buffer.push_back('\0');
+}
+
+static bool vtkReadBinary(const char*& cursor, const char* end, vtkTypeUInt32& value)
+{
+  if (end - cursor < static_cast<std::ptrdiff_t>(sizeof(value)))
+  {
+    return false;
+  }
+  memcpy(&value, cursor, sizeof(value));
+  cursor += sizeof(value);
+  return true;
+}
+
+static bool vtkReadBinary(const char*& cursor, const char* end, const char*& str, size_t& length)
+{
+  vtkTypeUInt32 size;
+  if (!vtkReadBinary(cursor, end, size))
+  {
+    return false;
+  }
+  str = nullptr;
+  length = 0;
+  if (size == vtkNullStringLength)
+  {
+    return true;
+  }
+  if (static_cast<size_t>(end - cursor) <= size || cursor[size] != '\0')
+  {
+    return false;
+  }
+  str = cursor;
+  length = size;
+  cursor += size + 1;
+  return true;
+}
+
 //----------------------------------------------------------------------------
 vtkPVXMLElement::vtkPVXMLElement()
 {
@@ -212,6 +271,10 @@ void vtkPVXMLElement::ReplaceNestedElement(
   {
     if (elem.GetPointer() == elementToReplace)
     {
+      if (element)
+      {
+        element->SetParent(this);
+      }
       elem = element;
       break;
     }
@@ -737,6 +800,90 @@ void vtkPVXMLElement::CopyAttributesTo(vtkPVXMLElement* other)
     this->Internal->CharacterData.c_str(), static_cast<int>(this->Internal->CharacterData.size()));
 }
 
+//----------------------------------------------------------------------------
+void vtkPVXMLElement::WriteBinary(std::string& buffer)
+{
+  vtkWriteBinary(buffer, this->Name, this->Name ? strlen(this->Name) : 0);
+  vtkWriteBinary(buffer, this->Id, this->Id ? strlen(this->Id) : 0);
+
+  const size_t numAttributes = this->Internal->AttributeNames.size();
+  vtkWriteBinary(buffer, static_cast<vtkTypeUInt32>(numAttributes));
+  for (size_t i = 0; i < numAttributes; ++i)
+  {
+    const std::string& aName = this->Internal->AttributeNames[i];
+    const std::string& aValue = this->Internal->AttributeValues[i];
+    vtkWriteBinary(buffer, aName.c_str(), aName.size());
+    vtkWriteBinary(buffer, aValue.c_str(), aValue.size());
+  }
+
+  const std::string& cdata = this->Internal->CharacterData;
+  vtkWriteBinary(buffer, cdata.c_str(), cdata.size());
+
+  vtkWriteBinary(buffer, static_cast<vtkTypeUInt32>(this->Internal->NestedElements.size()));
+  for (auto& nested : this->Internal->NestedElements)
+  {
+    nested->WriteBinary(buffer);
+  }
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVXMLElement::ReadBinary(const char*& cursor, const char* end)
+{
+  this->Internal->AttributeNames.clear();
+  this->Internal->AttributeValues.clear();
+  this->Internal->NestedElements.clear();
+  this->Internal->CharacterData.clear();
+
+  const char* name;
+  const char* id;
+  size_t length;
+  vtkTypeUInt32 numAttributes;
+  if (!vtkReadBinary(cursor, end, name, length) || !vtkReadBinary(cursor, end, id, length) ||
+    !vtkReadBinary(cursor, end, numAttributes))
+  {
+    return false;
+  }
+  this->SetName(name);
+  this->SetId(id);
+
+  for (vtkTypeUInt32 i = 0; i < numAttributes; ++i)
+  {
+    const char* aName;
+    const char* aValue;
+    size_t nameLength;
+    size_t valueLength;
+    if (!vtkReadBinary(cursor, end, aName, nameLength) ||
+      !vtkReadBinary(cursor, end, aValue, valueLength) || !aName || !aValue)
+    {
+      return false;
+    }
+    this->Internal->AttributeNames.emplace_back(aName, nameLength);
+    this->Internal->AttributeValues.emplace_back(aValue, valueLength);
+  }
+
+  const char* cdata;
+  vtkTypeUInt32 numNested;
+  if (!vtkReadBinary(cursor, end, cdata, length) || !vtkReadBinary(cursor, end, numNested))
+  {
+    return false;
+  }
+  if (cdata)
+  {
+    this->Internal->CharacterData.assign(cdata, length);
+  }
+
+  for (vtkTypeUInt32 i = 0; i < numNested; ++i)
+  {
+    vtkNew<vtkPVXMLElement> nested;
+    if (!nested->ReadBinary(cursor, end))
+    {
+      return false;
+    }
+    this->AddNestedElement(nested);
+  }
+  return true;
+}
+
 //----------------------------------------------------------------------------
 bool vtkPVXMLElement::Equals(vtkPVXMLElement* other)
 {
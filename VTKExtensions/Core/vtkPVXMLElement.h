@@ -152,7 +152,8 @@ public:
   void RemoveNestedElement(vtkPVXMLElement*);
 
   /**
-   * Replace a particular element with another
+   * Replace a particular element with another. The parent of `element` is
+   * set to this element.
    */
   void ReplaceNestedElement(vtkPVXMLElement* elementToReplace, vtkPVXMLElement* element);
 
@@ -251,6 +252,20 @@ public:
    */
   void CopyAttributesTo(vtkPVXMLElement* other);
 
+  ///@{
+  /**
+   * Serialize this element and its nested elements in a compact binary form
+   * appended to `buffer`, and read them back. Reading this form is much faster
+   * than parsing the equivalent XML. It uses the native byte order and is only
+   * meant to be read by the same build, e.g. to cache parsed configuration
+   * files. ReadBinary replaces the content of this element, moves `cursor` past
+   * the element and returns false if the buffer, which ends at `end`, is
+   * truncated or invalid.
+   */
+  void WriteBinary(std::string& buffer);
+  bool ReadBinary(const char*& cursor, const char* end);
+  ///@}
+
 protected:
   vtkPVXMLElement();
   ~vtkPVXMLElement() override;
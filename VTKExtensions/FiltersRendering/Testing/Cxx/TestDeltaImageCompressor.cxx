@@ -0,0 +1,182 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkDeltaImageCompressor.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <cstdlib>
+#include <cstring>
+
+#define VERIFY(x, ...)                                                                             \
+  if (!(x))                                                                                        \
+  {                                                                                                \
+    vtkLogF(ERROR, __VA_ARGS__);                                                                   \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+namespace
+{
+void FillImage(vtkUnsignedCharArray* image, int width, int height)
+{
+  image->SetNumberOfComponents(4);
+  image->SetNumberOfTuples(width * height);
+  unsigned char* ptr = image->GetPointer(0);
+  for (int y = 0; y < height; ++y)
+  {
+    for (int x = 0; x < width; ++x, ptr += 4)
+    {
+      ptr[0] = static_cast<unsigned char>(x);
+      ptr[1] = static_cast<unsigned char>(y);
+      ptr[2] = static_cast<unsigned char>((x * y) % 251);
+      ptr[3] = 255;
+    }
+  }
+}
+
+// Modifies a rectangular region of the image.
+void Paint(vtkUnsignedCharArray* image, int width, int x0, int y0, int w, int h, unsigned char v)
+{
+  for (int y = y0; y < y0 + h; ++y)
+  {
+    std::memset(image->GetPointer(4 * (y * width + x0)), v, 4 * w);
+  }
+}
+
+// Compresses `input` with `compressor`, transfers it to `decompressor` and
+// checks that the reassembled image matches `input`.
+bool Transfer(vtkDeltaImageCompressor* compressor, vtkDeltaImageCompressor* decompressor,
+  vtkUnsignedCharArray* input, int width, int height, vtkIdType& compressedSize)
+{
+  vtkNew<vtkUnsignedCharArray> compressed;
+  compressor->SetImageResolution(width, height);
+  compressor->SetInput(input);
+  compressor->SetOutput(compressed);
+  if (!compressor->Compress())
+  {
+    return false;
+  }
+  compressedSize = compressed->GetNumberOfValues();
+
+  vtkNew<vtkUnsignedCharArray> output;
+  output->SetNumberOfComponents(input->GetNumberOfComponents());
+  output->SetNumberOfTuples(input->GetNumberOfTuples());
+  decompressor->SetImageResolution(width, height);
+  decompressor->SetInput(compressed);
+  decompressor->SetOutput(output);
+  if (!decompressor->Decompress())
+  {
+    return false;
+  }
+  return std::memcmp(output->GetPointer(0), input->GetPointer(0),
+           static_cast<size_t>(input->GetNumberOfValues())) == 0;
+}
+
+int RunTest(int numberOfTiles)
+{
+  const int width = 300;
+  const int height = 200;
+  vtkNew<vtkDeltaImageCompressor> compressor;
+  vtkNew<vtkDeltaImageCompressor> decompressor;
+  compressor->SetNumberOfTiles(numberOfTiles);
+  decompressor->SetNumberOfTiles(numberOfTiles);
+  compressor->SetTileSize(32);
+
+  vtkNew<vtkUnsignedCharArray> image;
+  FillImage(image, width, height);
+
+  vtkIdType keyFrameSize = 0;
+  VERIFY(Transfer(compressor, decompressor, image, width, height, keyFrameSize),
+    "Key frame round trip failed (tiles: %d).", numberOfTiles);
+  VERIFY(compressor->GetNumberOfDirtyTiles() == compressor->GetNumberOfImageTiles(),
+    "First image must be a key frame.");
+  VERIFY(compressor->GetNumberOfImageTiles() == 10 * 7, "Unexpected number of tiles.");
+
+  // a small change, straddling tile boundaries, including the partial tiles.
+  Paint(image, width, 20, 20, 30, 10, 7);
+  Paint(image, width, 290, 195, 10, 5, 42);
+  vtkIdType deltaSize = 0;
+  VERIFY(Transfer(compressor, decompressor, image, width, height, deltaSize),
+    "Delta round trip failed (tiles: %d).", numberOfTiles);
+  VERIFY(compressor->GetNumberOfDirtyTiles() == 3, "Expected 3 dirty tiles, got %lld.",
+    static_cast<long long>(compressor->GetNumberOfDirtyTiles()));
+  VERIFY(decompressor->GetNumberOfDirtyTiles() == 3, "Decompressor dirty tiles mismatch.");
+  VERIFY(deltaSize < keyFrameSize, "Delta frame (%lld) not smaller than key frame (%lld).",
+    static_cast<long long>(deltaSize), static_cast<long long>(keyFrameSize));
+
+  // unchanged image.
+  vtkIdType emptySize = 0;
+  VERIFY(Transfer(compressor, decompressor, image, width, height, emptySize),
+    "Unchanged image round trip failed.");
+  VERIFY(compressor->GetNumberOfDirtyTiles() == 0, "Expected no dirty tiles.");
+
+  // most of the image changed.
+  Paint(image, width, 0, 0, width, height - 10, 3);
+  vtkIdType size = 0;
+  VERIFY(Transfer(compressor, decompressor, image, width, height, size),
+    "Full change round trip failed.");
+  VERIFY(compressor->GetNumberOfDirtyTiles() == compressor->GetNumberOfImageTiles(),
+    "Expected a key frame when most tiles changed.");
+
+  // resolution change.
+  FillImage(image, width / 2, height / 2);
+  VERIFY(Transfer(compressor, decompressor, image, width / 2, height / 2, size),
+    "Resized image round trip failed.");
+  VERIFY(compressor->GetNumberOfDirtyTiles() == compressor->GetNumberOfImageTiles(),
+    "Expected a key frame after a resolution change.");
+
+  // a delta frame applied without reference must fail.
+  Paint(image, width / 2, 0, 0, 4, 4, 1);
+  decompressor->ResetReference();
+  vtkObject::GlobalWarningDisplayOff();
+  const bool applied = Transfer(compressor, decompressor, image, width / 2, height / 2, size);
+  vtkObject::GlobalWarningDisplayOn();
+  VERIFY(!applied, "Delta frame without reference must fail.");
+
+  // resetting both sides resynchronizes them with a key frame.
+  compressor->ResetReference();
+  decompressor->ResetReference();
+  VERIFY(Transfer(compressor, decompressor, image, width / 2, height / 2, size),
+    "Round trip after reset failed.");
+  VERIFY(compressor->GetNumberOfDirtyTiles() == compressor->GetNumberOfImageTiles(),
+    "Expected a key frame after a reset.");
+  VERIFY(compressor->GetReferenceFrameId() == decompressor->GetReferenceFrameId(),
+    "Reference frame ids differ.");
+
+  // a frame that never reaches the decompressor leaves it with an older
+  // reference of the same resolution: the next delta frame must be rejected.
+  Paint(image, width / 2, 8, 8, 4, 4, 2);
+  vtkNew<vtkUnsignedCharArray> dropped;
+  compressor->SetInput(image);
+  compressor->SetOutput(dropped);
+  VERIFY(compressor->Compress(), "Compression of the dropped frame failed.");
+  Paint(image, width / 2, 16, 16, 4, 4, 3);
+  vtkObject::GlobalWarningDisplayOff();
+  const bool stale = Transfer(compressor, decompressor, image, width / 2, height / 2, size);
+  vtkObject::GlobalWarningDisplayOn();
+  VERIFY(!stale, "Delta frame computed against another reference must fail.");
+  return EXIT_SUCCESS;
+}
+}
+
+int TestDeltaImageCompressor(int, char*[])
+{
+  for (int numberOfTiles : { 0, 4 })
+  {
+    if (RunTest(numberOfTiles) != EXIT_SUCCESS)
+    {
+      return EXIT_FAILURE;
+    }
+  }
+
+  vtkNew<vtkDeltaImageCompressor> compressor;
+  compressor->SetTileSize(128);
+  compressor->SetNumberOfTiles(8);
+  vtkNew<vtkDeltaImageCompressor> restored;
+  VERIFY(restored->RestoreConfiguration(compressor->SaveConfiguration()) != nullptr,
+    "Failed to restore configuration.");
+  VERIFY(restored->GetTileSize() == 128 && restored->GetNumberOfTiles() == 8,
+    "Configuration mismatch.");
+  return EXIT_SUCCESS;
+}
@@ -14,6 +14,7 @@
 #include "vtkUnsignedCharArray.h"
 #include "vtkZlibImageCompressor.h"
 
+#include <cstring>
 #include <map>
 #include <string>
 #include <vtksys/CommandLineArguments.hxx>
@@ -36,7 +37,8 @@ public:
 };
 typedef std::map<std::string, Data> MapType;
 
-bool DoTest(Data& data, vtkImageCompressor* compressor, vtkUnsignedCharArray* input)
+bool DoTest(
+  Data& data, vtkImageCompressor* compressor, vtkUnsignedCharArray* input, bool verify = false)
 {
   vtkNew<vtkUnsignedCharArray> outputCompressed;
   vtkNew<vtkUnsignedCharArray> outputDeCompressed;
@@ -66,6 +68,17 @@ bool DoTest(Data& data, vtkImageCompressor* compressor, vtkUnsignedCharArray* in
   data.DecompressTime += timer->GetElapsedTime();
   data.CompressedSize =
     outputCompressed->GetNumberOfTuples() * outputCompressed->GetNumberOfComponents();
+
+  // loss-less round trips must reproduce the input exactly.
+  if (verify &&
+    (outputDeCompressed->GetNumberOfValues() != input->GetNumberOfValues() ||
+      memcmp(outputDeCompressed->GetPointer(0), input->GetPointer(0),
+        static_cast<size_t>(input->GetNumberOfValues())) != 0))
+  {
+    cerr << "Decompressed image does not match the input for " << compressor->GetClassName()
+         << " (tiles: " << compressor->GetNumberOfTiles() << ")" << endl;
+    return false;
+  }
   return true;
 }
 
@@ -113,10 +126,16 @@ int TestImageCompressors(int argc, char* argv[])
   {
     vtkNew<vtkLZ4Compressor> lz4;
     lz4->SetQuality(0);
-    if (!DoTest(datas["LZ4 (quality: 0)"], lz4.Get(), input))
+    if (!DoTest(datas["LZ4 (quality: 0)"], lz4.Get(), input, true))
+    {
+      return TEST_FAILED;
+    }
+    lz4->SetNumberOfTiles(8);
+    if (!DoTest(datas["LZ4 (quality: 0, tiles: 8)"], lz4.Get(), input, true))
     {
       return TEST_FAILED;
     }
+    lz4->SetNumberOfTiles(0);
     if (test_lossy)
     {
       lz4->SetQuality(3);
@@ -158,10 +177,17 @@ int TestImageCompressors(int argc, char* argv[])
 
     vtkNew<vtkZlibImageCompressor> zlib;
     zlib->SetCompressionLevel(1);
-    if (!DoTest(datas["ZLIB (compression-level: 1, color-space: 0)"], zlib.Get(), input))
+    if (!DoTest(datas["ZLIB (compression-level: 1, color-space: 0)"], zlib.Get(), input, true))
+    {
+      return TEST_FAILED;
+    }
+    zlib->SetNumberOfTiles(8);
+    if (!DoTest(
+          datas["ZLIB (compression-level: 1, color-space: 0, tiles: 8)"], zlib.Get(), input, true))
     {
       return TEST_FAILED;
     }
+    zlib->SetNumberOfTiles(0);
 
     if (test_lossy)
     {
@@ -186,13 +212,40 @@ int TestImageCompressors(int argc, char* argv[])
   cout << "Input: " << image->GetDimensions()[0] << "x" << image->GetDimensions()[1] << "x"
        << image->GetDimensions()[2] << " (uncompressed size: " << uncompressedSize << ") " << endl;
 
+  // throughput in MB/s of uncompressed image data.
+  const double megaBytes = uncompressedSize / (1024.0 * 1024.0);
   for (MapType::iterator iter = datas.begin(); iter != datas.end(); ++iter)
   {
+    const double compressTime = iter->second.CompressTime / max_count;
+    const double decompressTime = iter->second.DecompressTime / max_count;
     cout << iter->first.c_str() << " :"
-         << " compress: " << (iter->second.CompressTime / max_count)
-         << " decompress: " << (iter->second.DecompressTime / max_count) << " compression ratio: "
+         << " compress: " << compressTime << " decompress: " << decompressTime
+         << " compress throughput (MB/s): " << (compressTime > 0 ? megaBytes / compressTime : 0)
+         << " decompress throughput (MB/s): "
+         << (decompressTime > 0 ? megaBytes / decompressTime : 0) << " compression ratio: "
          << ((uncompressedSize - iter->second.CompressedSize) * 100.0 / uncompressedSize)
          << "( compressed size: " << iter->second.CompressedSize << ")" << endl;
   }
+
+  // check that the number of tiles round-trips through the configuration string.
+  vtkNew<vtkLZ4Compressor> lz4;
+  if (!lz4->RestoreConfiguration("vtkLZ4Compressor 0 3 16") || lz4->GetNumberOfTiles() != 16 ||
+    lz4->GetQuality() != 3)
+  {
+    cerr << "Failed to restore tiled LZ4 configuration." << endl;
+    return TEST_FAILED;
+  }
+  if (!lz4->RestoreConfiguration("vtkLZ4Compressor 0 3") || lz4->GetNumberOfTiles() != 0)
+  {
+    cerr << "Failed to restore LZ4 configuration." << endl;
+    return TEST_FAILED;
+  }
+  vtkNew<vtkZlibImageCompressor> zlib;
+  if (!zlib->RestoreConfiguration("vtkZlibImageCompressor 0 6 2 0 4") ||
+    zlib->GetNumberOfTiles() != 4)
+  {
+    cerr << "Failed to restore tiled Zlib configuration." << endl;
+    return TEST_FAILED;
+  }
   return TEST_SUCCESS;
 }
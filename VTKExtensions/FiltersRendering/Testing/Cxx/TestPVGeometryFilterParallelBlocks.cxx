@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkCellData.h"
+#include "vtkDataObjectTree.h"
+#include "vtkDataObjectTreeIterator.h"
+#include "vtkImageData.h"
+#include "vtkLogger.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPVGeometryFilter.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+#include "vtkUnsignedIntArray.h"
+
+#include <cstdlib>
+
+#define VERIFY(x, ...)                                                                             \
+  if (!(x))                                                                                        \
+  {                                                                                                \
+    vtkLogF(ERROR, __VA_ARGS__);                                                                   \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+namespace
+{
+vtkSmartPointer<vtkMultiBlockDataSet> CreateInput()
+{
+  auto mb = vtkSmartPointer<vtkMultiBlockDataSet>::New();
+  for (unsigned int cc = 0; cc < 16; ++cc)
+  {
+    vtkNew<vtkMultiBlockDataSet> child;
+    for (unsigned int kk = 0; kk < 4; ++kk)
+    {
+      if ((cc + kk) % 5 == 0)
+      {
+        // leave some empty leaves around.
+        continue;
+      }
+      vtkNew<vtkImageData> img;
+      img->SetDimensions(3 + cc, 4 + kk, 5);
+      img->SetOrigin(cc * 20.0, kk * 20.0, 0.0);
+      child->SetBlock(kk, img);
+    }
+    mb->SetBlock(cc, child);
+  }
+  return mb;
+}
+
+vtkSmartPointer<vtkDataObjectTree> Execute(vtkDataObject* input, bool parallel)
+{
+  vtkNew<vtkPVGeometryFilter> filter;
+  filter->SetUseOutline(0);
+  filter->SetExecuteBlocksInParallel(parallel);
+  filter->SetInputDataObject(input);
+  filter->Update();
+  return vtkDataObjectTree::SafeDownCast(filter->GetOutputDataObject(0));
+}
+}
+
+int TestPVGeometryFilterParallelBlocks(int, char*[])
+{
+  auto input = CreateInput();
+  auto serial = Execute(input, false);
+  auto parallel = Execute(input, true);
+  VERIFY(serial != nullptr && parallel != nullptr, "Missing output.");
+
+  vtkSmartPointer<vtkDataObjectTreeIterator> sIter;
+  sIter.TakeReference(serial->NewTreeIterator());
+  vtkSmartPointer<vtkDataObjectTreeIterator> pIter;
+  pIter.TakeReference(parallel->NewTreeIterator());
+
+  int numLeaves = 0;
+  for (sIter->InitTraversal(), pIter->InitTraversal();
+       !sIter->IsDoneWithTraversal() && !pIter->IsDoneWithTraversal();
+       sIter->GoToNextItem(), pIter->GoToNextItem(), ++numLeaves)
+  {
+    VERIFY(sIter->GetCurrentFlatIndex() == pIter->GetCurrentFlatIndex(),
+      "Leaf ordering mismatch at leaf %d.", numLeaves);
+
+    auto spd = vtkPolyData::SafeDownCast(sIter->GetCurrentDataObject());
+    auto ppd = vtkPolyData::SafeDownCast(pIter->GetCurrentDataObject());
+    VERIFY(spd != nullptr && ppd != nullptr, "Expected polydata leaves.");
+    VERIFY(spd->GetNumberOfPoints() == ppd->GetNumberOfPoints() &&
+        spd->GetNumberOfCells() == ppd->GetNumberOfCells(),
+      "Surface mismatch for flat index %u.", sIter->GetCurrentFlatIndex());
+
+    auto cindex = vtkUnsignedIntArray::SafeDownCast(
+      ppd->GetCellData()->GetArray("vtkCompositeIndex"));
+    VERIFY(cindex != nullptr && cindex->GetValue(0) == pIter->GetCurrentFlatIndex(),
+      "Incorrect vtkCompositeIndex for flat index %u.", pIter->GetCurrentFlatIndex());
+  }
+  VERIFY(sIter->IsDoneWithTraversal() && pIter->IsDoneWithTraversal(),
+    "Number of leaves mismatch.");
+  VERIFY(numLeaves > 0, "Expected non-empty output.");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,521 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkDeltaImageCompressor.h"
+
+#include "vtkMultiProcessStream.h"
+#include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
+#include "vtkUnsignedCharArray.h"
+
+#include "vtk_lz4.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <vector>
+
+namespace
+{
+// Layout of the compressed stream:
+//   uint32 header[HEADER_SIZE]
+//   uint32 dirtyTiles[numberOfDirtyTiles] (absent for key frames)
+//   LZ4 compressed (and optionally tiled) packed pixels of the dirty tiles.
+enum HeaderFields
+{
+  KEY_FRAME = 0,
+  WIDTH,
+  HEIGHT,
+  COMPONENTS,
+  TILE_SIZE,
+  NUMBER_OF_DIRTY_TILES,
+  PAYLOAD_SIZE,
+  FRAME_ID,
+  REFERENCE_FRAME_ID,
+  HEADER_SIZE
+};
+
+// Describes how an image is split into tiles.
+struct TileGrid
+{
+  vtkIdType Width;
+  vtkIdType Height;
+  vtkIdType Components;
+  vtkIdType TileSize;
+  vtkIdType TilesX;
+  vtkIdType TilesY;
+
+  TileGrid(vtkIdType width, vtkIdType height, vtkIdType comps, vtkIdType tileSize)
+    : Width(width)
+    , Height(height)
+    , Components(comps)
+    , TileSize(tileSize)
+    , TilesX((width + tileSize - 1) / tileSize)
+    , TilesY((height + tileSize - 1) / tileSize)
+  {
+  }
+
+  vtkIdType GetNumberOfTiles() const { return this->TilesX * this->TilesY; }
+
+  void GetTile(vtkIdType index, vtkIdType& x0, vtkIdType& y0, vtkIdType& w, vtkIdType& h) const
+  {
+    x0 = (index % this->TilesX) * this->TileSize;
+    y0 = (index / this->TilesX) * this->TileSize;
+    w = std::min(this->TileSize, this->Width - x0);
+    h = std::min(this->TileSize, this->Height - y0);
+  }
+
+  vtkIdType GetTileBytes(vtkIdType index) const
+  {
+    vtkIdType x0, y0, w, h;
+    this->GetTile(index, x0, y0, w, h);
+    return w * h * this->Components;
+  }
+
+  // Copies tile `index` of `image` to the contiguous buffer `packed`.
+  void PackTile(vtkIdType index, const unsigned char* image, unsigned char* packed) const
+  {
+    vtkIdType x0, y0, w, h;
+    this->GetTile(index, x0, y0, w, h);
+    const vtkIdType rowBytes = w * this->Components;
+    for (vtkIdType y = 0; y < h; ++y)
+    {
+      std::memcpy(packed + y * rowBytes, image + ((y0 + y) * this->Width + x0) * this->Components,
+        static_cast<size_t>(rowBytes));
+    }
+  }
+
+  // Copies the contiguous buffer `packed` to tile `index` of `image`.
+  void UnpackTile(vtkIdType index, unsigned char* image, const unsigned char* packed) const
+  {
+    vtkIdType x0, y0, w, h;
+    this->GetTile(index, x0, y0, w, h);
+    const vtkIdType rowBytes = w * this->Components;
+    for (vtkIdType y = 0; y < h; ++y)
+    {
+      std::memcpy(image + ((y0 + y) * this->Width + x0) * this->Components, packed + y * rowBytes,
+        static_cast<size_t>(rowBytes));
+    }
+  }
+
+  bool IsTileDifferent(vtkIdType index, const unsigned char* a, const unsigned char* b) const
+  {
+    vtkIdType x0, y0, w, h;
+    this->GetTile(index, x0, y0, w, h);
+    const vtkIdType rowBytes = w * this->Components;
+    for (vtkIdType y = 0; y < h; ++y)
+    {
+      const vtkIdType offset = ((y0 + y) * this->Width + x0) * this->Components;
+      if (std::memcmp(a + offset, b + offset, static_cast<size_t>(rowBytes)) != 0)
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+};
+
+vtkIdType LZ4TileBound(vtkIdType size)
+{
+  return static_cast<vtkIdType>(LZ4_compressBound(static_cast<int>(size)));
+}
+
+vtkIdType LZ4CompressTile(
+  const unsigned char* in, vtkIdType inSize, unsigned char* out, vtkIdType outCapacity)
+{
+  return LZ4_compress_fast(reinterpret_cast<const char*>(in), reinterpret_cast<char*>(out),
+    static_cast<int>(inSize), static_cast<int>(outCapacity), 16);
+}
+
+vtkIdType LZ4DecompressTile(
+  const unsigned char* in, vtkIdType inSize, unsigned char* out, vtkIdType outCapacity)
+{
+  return LZ4_decompress_safe(reinterpret_cast<const char*>(in), reinterpret_cast<char*>(out),
+    static_cast<int>(inSize), static_cast<int>(outCapacity));
+}
+}
+
+vtkStandardNewMacro(vtkDeltaImageCompressor);
+//----------------------------------------------------------------------------
+vtkDeltaImageCompressor::vtkDeltaImageCompressor()
+  : TileSize(64)
+  , KeyFrameThreshold(0.75)
+  , ImageResolution{ 0, 0 }
+  , NumberOfDirtyTiles(0)
+  , NumberOfImageTiles(0)
+  , ReferenceResolution{ 0, 0 }
+  , ReferenceFrameId(0)
+  , NextFrameId(1)
+{
+}
+
+//----------------------------------------------------------------------------
+vtkDeltaImageCompressor::~vtkDeltaImageCompressor() = default;
+
+//----------------------------------------------------------------------------
+void vtkDeltaImageCompressor::SetImageResolution(int width, int height)
+{
+  this->ImageResolution[0] = width;
+  this->ImageResolution[1] = height;
+}
+
+//----------------------------------------------------------------------------
+void vtkDeltaImageCompressor::ResetReference()
+{
+  this->Reference->Initialize();
+  this->ReferenceResolution[0] = this->ReferenceResolution[1] = 0;
+  this->ReferenceFrameId = 0;
+}
+
+//----------------------------------------------------------------------------
+int vtkDeltaImageCompressor::Compress()
+{
+  if (!(this->Input && this->Output))
+  {
+    vtkWarningMacro("Cannot compress, empty input or output detected.");
+    return VTK_ERROR;
+  }
+
+  vtkUnsignedCharArray* input = this->Input;
+  const vtkIdType comps = input->GetNumberOfComponents();
+  const vtkIdType inputSize = input->GetNumberOfValues();
+  vtkIdType width = this->ImageResolution[0];
+  vtkIdType height = this->ImageResolution[1];
+  if (width * height * comps != inputSize)
+  {
+    // resolution was not provided, treat the input as a single row of pixels.
+    width = input->GetNumberOfTuples();
+    height = 1;
+  }
+
+  const TileGrid grid(width, height, comps, this->TileSize);
+  const vtkIdType numTiles = grid.GetNumberOfTiles();
+  const unsigned char* in = input->GetPointer(0);
+
+  bool keyFrame = this->Reference->GetNumberOfValues() != inputSize ||
+    this->Reference->GetNumberOfComponents() != comps || this->ReferenceResolution[0] != width ||
+    this->ReferenceResolution[1] != height;
+
+  std::vector<std::uint32_t> dirtyTiles;
+  if (!keyFrame)
+  {
+    std::vector<unsigned char> dirty(numTiles, 0);
+    const unsigned char* reference = this->Reference->GetPointer(0);
+    vtkSMPTools::For(0, numTiles, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType cc = begin; cc < end; ++cc)
+      {
+        dirty[cc] = grid.IsTileDifferent(cc, in, reference) ? 1 : 0;
+      }
+    });
+    for (vtkIdType cc = 0; cc < numTiles; ++cc)
+    {
+      if (dirty[cc])
+      {
+        dirtyTiles.push_back(static_cast<std::uint32_t>(cc));
+      }
+    }
+    keyFrame = dirtyTiles.size() > this->KeyFrameThreshold * numTiles;
+  }
+
+  // pack the dirty tiles.
+  const unsigned char* payload = in;
+  vtkIdType payloadSize = inputSize;
+  std::vector<vtkIdType> offsets;
+  if (keyFrame)
+  {
+    dirtyTiles.clear();
+  }
+  const vtkIdType numDirty = static_cast<vtkIdType>(dirtyTiles.size());
+  if (!keyFrame)
+  {
+    offsets.resize(numDirty + 1, 0);
+    for (vtkIdType cc = 0; cc < numDirty; ++cc)
+    {
+      offsets[cc + 1] = offsets[cc] + grid.GetTileBytes(dirtyTiles[cc]);
+    }
+    payloadSize = offsets.back();
+    this->TemporaryBuffer->SetNumberOfComponents(1);
+    unsigned char* packed = this->TemporaryBuffer->WritePointer(0, payloadSize);
+    vtkSMPTools::For(0, numDirty, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType cc = begin; cc < end; ++cc)
+      {
+        grid.PackTile(dirtyTiles[cc], in, packed + offsets[cc]);
+      }
+    });
+    payload = packed;
+  }
+
+  // header and dirty tile list.
+  std::uint32_t header[HEADER_SIZE];
+  header[KEY_FRAME] = keyFrame ? 1 : 0;
+  header[WIDTH] = static_cast<std::uint32_t>(width);
+  header[HEIGHT] = static_cast<std::uint32_t>(height);
+  header[COMPONENTS] = static_cast<std::uint32_t>(comps);
+  header[TILE_SIZE] = static_cast<std::uint32_t>(this->TileSize);
+  header[NUMBER_OF_DIRTY_TILES] = static_cast<std::uint32_t>(numDirty);
+  header[PAYLOAD_SIZE] = static_cast<std::uint32_t>(payloadSize);
+  header[FRAME_ID] = this->NextFrameId;
+  header[REFERENCE_FRAME_ID] = keyFrame ? 0 : this->ReferenceFrameId;
+  const vtkIdType headerBytes =
+    static_cast<vtkIdType>(sizeof(header) + numDirty * sizeof(std::uint32_t));
+
+  bool status = true;
+  if (this->UseTiles())
+  {
+    status = this->CompressTiles(payload, payloadSize, static_cast<int>(comps), this->Output,
+      headerBytes, LZ4TileBound, LZ4CompressTile);
+  }
+  else
+  {
+    const int maxOutputSize = LZ4_compressBound(static_cast<int>(payloadSize));
+    this->Output->SetNumberOfComponents(1);
+    unsigned char* out = this->Output->WritePointer(0, headerBytes + maxOutputSize);
+    int compressedSize = payloadSize > 0
+      ? LZ4_compress_fast(reinterpret_cast<const char*>(payload),
+          reinterpret_cast<char*>(out + headerBytes), static_cast<int>(payloadSize),
+          maxOutputSize, 16)
+      : 0;
+    status = payloadSize == 0 || compressedSize > 0;
+    this->Output->SetNumberOfTuples(headerBytes + compressedSize);
+  }
+  if (!status)
+  {
+    this->ResetReference();
+    return VTK_ERROR;
+  }
+
+  unsigned char* out = this->Output->GetPointer(0);
+  std::memcpy(out, header, sizeof(header));
+  if (numDirty > 0)
+  {
+    std::memcpy(out + sizeof(header), dirtyTiles.data(), numDirty * sizeof(std::uint32_t));
+  }
+
+  // update the reference image. 0 is reserved for "no reference".
+  this->ReferenceFrameId = this->NextFrameId;
+  this->NextFrameId = this->NextFrameId == VTK_TYPE_UINT32_MAX ? 1 : this->NextFrameId + 1;
+  if (keyFrame)
+  {
+    this->Reference->DeepCopy(input);
+    this->ReferenceResolution[0] = static_cast<int>(width);
+    this->ReferenceResolution[1] = static_cast<int>(height);
+  }
+  else
+  {
+    // the packed buffer holds the dirty tiles as they are in the input.
+    unsigned char* reference = this->Reference->GetPointer(0);
+    const unsigned char* packed = this->TemporaryBuffer->GetPointer(0);
+    vtkSMPTools::For(0, numDirty, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType cc = begin; cc < end; ++cc)
+      {
+        grid.UnpackTile(dirtyTiles[cc], reference, packed + offsets[cc]);
+      }
+    });
+  }
+
+  this->NumberOfImageTiles = numTiles;
+  this->NumberOfDirtyTiles = keyFrame ? numTiles : numDirty;
+  return VTK_OK;
+}
+
+//----------------------------------------------------------------------------
+int vtkDeltaImageCompressor::Decompress()
+{
+  if (!(this->Input && this->Output))
+  {
+    vtkWarningMacro("Cannot decompress, empty input or output detected.");
+    return VTK_ERROR;
+  }
+
+  const unsigned char* in = this->Input->GetPointer(0);
+  const vtkIdType inSize = this->Input->GetNumberOfValues();
+  std::uint32_t header[HEADER_SIZE];
+  if (inSize < static_cast<vtkIdType>(sizeof(header)))
+  {
+    vtkErrorMacro("Invalid compressed stream.");
+    return VTK_ERROR;
+  }
+  std::memcpy(header, in, sizeof(header));
+
+  const vtkIdType width = header[WIDTH];
+  const vtkIdType height = header[HEIGHT];
+  const vtkIdType comps = header[COMPONENTS];
+  const vtkIdType numDirty = header[NUMBER_OF_DIRTY_TILES];
+  const vtkIdType payloadSize = header[PAYLOAD_SIZE];
+  const bool keyFrame = header[KEY_FRAME] != 0;
+  const vtkIdType imageSize = width * height * comps;
+  const TileGrid grid(width, height, comps, header[TILE_SIZE] > 0 ? header[TILE_SIZE] : 1);
+
+  const vtkIdType headerBytes =
+    static_cast<vtkIdType>(sizeof(header) + numDirty * sizeof(std::uint32_t));
+  unsigned char* output = this->Output->GetPointer(0);
+  if (inSize < headerBytes || this->Output->GetNumberOfValues() != imageSize ||
+    this->Output->GetNumberOfComponents() != comps || (keyFrame && payloadSize != imageSize))
+  {
+    vtkErrorMacro("Compressed stream does not match the output image.");
+    this->ResetReference();
+    return VTK_ERROR;
+  }
+
+  if (!keyFrame &&
+    (this->Reference->GetNumberOfValues() != imageSize || this->ReferenceResolution[0] != width ||
+      this->ReferenceResolution[1] != height))
+  {
+    vtkErrorMacro("Missing reference image to apply the changed tiles to.");
+    this->ResetReference();
+    return VTK_ERROR;
+  }
+  if (!keyFrame && header[REFERENCE_FRAME_ID] != this->ReferenceFrameId)
+  {
+    vtkErrorMacro("Changed tiles apply to frame " << header[REFERENCE_FRAME_ID]
+                                                  << " but the reference image is frame "
+                                                  << this->ReferenceFrameId << ".");
+    this->ResetReference();
+    return VTK_ERROR;
+  }
+
+  // decompress the payload directly in the output for key frames.
+  unsigned char* payload = output;
+  if (!keyFrame)
+  {
+    this->TemporaryBuffer->SetNumberOfComponents(1);
+    payload = this->TemporaryBuffer->WritePointer(0, payloadSize);
+  }
+
+  const unsigned char* compressed = in + headerBytes;
+  const vtkIdType compressedSize = inSize - headerBytes;
+  bool status = true;
+  if (payloadSize > 0)
+  {
+    if (this->UseTiles())
+    {
+      status = this->DecompressTiles(
+        compressed, compressedSize, payload, payloadSize, LZ4DecompressTile);
+    }
+    else
+    {
+      status = LZ4DecompressTile(compressed, compressedSize, payload, payloadSize) == payloadSize;
+    }
+  }
+  if (!status)
+  {
+    vtkErrorMacro("Failed to decompress the changed tiles.");
+    this->ResetReference();
+    return VTK_ERROR;
+  }
+
+  if (keyFrame)
+  {
+    this->Reference->DeepCopy(this->Output);
+  }
+  else
+  {
+    std::vector<std::uint32_t> dirtyTiles(numDirty);
+    if (numDirty > 0)
+    {
+      std::memcpy(dirtyTiles.data(), in + sizeof(header), numDirty * sizeof(std::uint32_t));
+    }
+    std::vector<vtkIdType> offsets(numDirty + 1, 0);
+    for (vtkIdType cc = 0; cc < numDirty; ++cc)
+    {
+      if (dirtyTiles[cc] >= grid.GetNumberOfTiles())
+      {
+        vtkErrorMacro("Invalid tile index " << dirtyTiles[cc] << ".");
+        this->ResetReference();
+        return VTK_ERROR;
+      }
+      offsets[cc + 1] = offsets[cc] + grid.GetTileBytes(dirtyTiles[cc]);
+    }
+    if (offsets.back() != payloadSize)
+    {
+      vtkErrorMacro("Changed tiles do not match the payload.");
+      this->ResetReference();
+      return VTK_ERROR;
+    }
+
+    unsigned char* reference = this->Reference->GetPointer(0);
+    vtkSMPTools::For(0, numDirty, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType cc = begin; cc < end; ++cc)
+      {
+        grid.UnpackTile(dirtyTiles[cc], reference, payload + offsets[cc]);
+      }
+    });
+    std::memcpy(output, reference, static_cast<size_t>(imageSize));
+  }
+  this->ReferenceResolution[0] = static_cast<int>(width);
+  this->ReferenceResolution[1] = static_cast<int>(height);
+  this->ReferenceFrameId = header[FRAME_ID];
+
+  this->NumberOfImageTiles = grid.GetNumberOfTiles();
+  this->NumberOfDirtyTiles = keyFrame ? this->NumberOfImageTiles : numDirty;
+  return VTK_OK;
+}
+
+//-----------------------------------------------------------------------------
+void vtkDeltaImageCompressor::SaveConfiguration(vtkMultiProcessStream* stream)
+{
+  this->Superclass::SaveConfiguration(stream);
+  *stream << this->TileSize << this->NumberOfTiles;
+}
+
+//-----------------------------------------------------------------------------
+bool vtkDeltaImageCompressor::RestoreConfiguration(vtkMultiProcessStream* stream)
+{
+  if (this->Superclass::RestoreConfiguration(stream))
+  {
+    int tileSize;
+    int numberOfTiles;
+    *stream >> tileSize >> numberOfTiles;
+    this->SetTileSize(tileSize);
+    this->SetNumberOfTiles(numberOfTiles);
+    return true;
+  }
+  return false;
+}
+
+//-----------------------------------------------------------------------------
+const char* vtkDeltaImageCompressor::SaveConfiguration()
+{
+  std::ostringstream oss;
+  oss << this->Superclass::SaveConfiguration() << " " << this->TileSize;
+  if (this->UseTiles())
+  {
+    oss << " " << this->NumberOfTiles;
+  }
+  this->SetConfiguration(oss.str().c_str());
+  return this->Configuration;
+}
+
+//-----------------------------------------------------------------------------
+const char* vtkDeltaImageCompressor::RestoreConfiguration(const char* stream)
+{
+  stream = this->Superclass::RestoreConfiguration(stream);
+  if (stream)
+  {
+    std::istringstream iss(stream);
+    int tileSize;
+    iss >> tileSize;
+    this->SetTileSize(tileSize);
+    // the number of tiles is optional.
+    int numberOfTiles = 0;
+    if (!(iss >> numberOfTiles))
+    {
+      numberOfTiles = 0;
+      iss.clear();
+    }
+    this->SetNumberOfTiles(numberOfTiles);
+    return stream + iss.tellg();
+  }
+  return nullptr;
+}
+
+//----------------------------------------------------------------------------
+void vtkDeltaImageCompressor::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "TileSize: " << this->TileSize << endl;
+  os << indent << "KeyFrameThreshold: " << this->KeyFrameThreshold << endl;
+  os << indent << "NumberOfDirtyTiles: " << this->NumberOfDirtyTiles << endl;
+  os << indent << "NumberOfImageTiles: " << this->NumberOfImageTiles << endl;
+  os << indent << "ReferenceFrameId: " << this->ReferenceFrameId << endl;
+}
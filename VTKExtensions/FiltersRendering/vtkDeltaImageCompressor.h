@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkDeltaImageCompressor
+ * @brief   Image compressor/decompressor that only transmits changed tiles.
+ *
+ * vtkDeltaImageCompressor splits images into square tiles of TileSize pixels
+ * and compares each tile with the one of the previously compressed image.
+ * Only the tiles that differ (dirty tiles) are packed and compressed using
+ * LZ4. The decompressor keeps a copy of the previously decompressed image and
+ * reassembles the new image by overwriting the dirty tiles.
+ *
+ * This is useful for interactions that only affect a small portion of the
+ * view such as widget manipulation or annotation changes. A full image (a key
+ * frame) is sent for the first image, whenever the image resolution changes
+ * or when most of the tiles are dirty.
+ *
+ * Since both sides rely on the previously transferred image, every image
+ * compressed must be decompressed by the peer, in the same order. Each
+ * compressed image carries its frame id and the id of the frame its changed
+ * tiles apply to, so that the decompressor rejects changed tiles computed
+ * against a different reference instead of producing a corrupted image. When
+ * images are transferred by other means in between, call ResetReference() on
+ * both sides. The compression is loss-less.
+ *
+ * The configuration stream is [vtkDeltaImageCompressor, LossLessMode,
+ * TileSize, [NumberOfTiles]].
+ */
+
+#ifndef vtkDeltaImageCompressor_h
+#define vtkDeltaImageCompressor_h
+
+#include "vtkImageCompressor.h"
+#include "vtkNew.h"                                   // needed for vtkNew
+#include "vtkPVVTKExtensionsFiltersRenderingModule.h" // needed for exports
+
+class vtkMultiProcessStream;
+
+class VTKPVVTKEXTENSIONSFILTERSRENDERING_EXPORT vtkDeltaImageCompressor : public vtkImageCompressor
+{
+public:
+  static vtkDeltaImageCompressor* New();
+  vtkTypeMacro(vtkDeltaImageCompressor, vtkImageCompressor);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Set the width and height, in pixels, of the tiles compared between two
+   * consecutive images. Default is 64.
+   */
+  vtkSetClampMacro(TileSize, int, 8, 1024);
+  vtkGetMacro(TileSize, int);
+  ///@}
+
+  ///@{
+  /**
+   * If the fraction of dirty tiles is greater than this value a full image is
+   * transmitted instead. Default is 0.75.
+   */
+  vtkSetClampMacro(KeyFrameThreshold, double, 0.0, 1.0);
+  vtkGetMacro(KeyFrameThreshold, double);
+  ///@}
+
+  /**
+   * Communicates the next expected image resolution.
+   */
+  void SetImageResolution(int width, int height) override;
+
+  /**
+   * Forget the previously transferred image so that the next image is sent as
+   * a key frame. Must be called on both the compressing and the decompressing
+   * side, e.g. whenever an image was transferred without going through this
+   * compressor.
+   */
+  void ResetReference();
+
+  /**
+   * Returns the id of the frame currently used as reference, 0 if none.
+   */
+  vtkTypeUInt32 GetReferenceFrameId() const { return this->ReferenceFrameId; }
+
+  /**
+   * Returns the number of tiles that were transmitted by the last call to
+   * Compress() or Decompress(), and the total number of tiles in the image.
+   */
+  vtkGetMacro(NumberOfDirtyTiles, vtkIdType);
+  vtkGetMacro(NumberOfImageTiles, vtkIdType);
+
+  ///@{
+  /**
+   * Compress/Decompress data array on the objects input with results
+   * in the objects output. See also Set/GetInput/Output.
+   */
+  int Compress() override;
+  int Decompress() override;
+  ///@}
+
+  ///@{
+  /**
+   * Serialize/Restore compressor configuration (but not the data) into the stream.
+   */
+  void SaveConfiguration(vtkMultiProcessStream* stream) override;
+  bool RestoreConfiguration(vtkMultiProcessStream* stream) override;
+  const char* SaveConfiguration() override;
+  const char* RestoreConfiguration(const char* stream) override;
+  ///@}
+
+protected:
+  vtkDeltaImageCompressor();
+  ~vtkDeltaImageCompressor() override;
+
+  int TileSize;
+  double KeyFrameThreshold;
+  int ImageResolution[2];
+  vtkIdType NumberOfDirtyTiles;
+  vtkIdType NumberOfImageTiles;
+
+private:
+  vtkDeltaImageCompressor(const vtkDeltaImageCompressor&) = delete;
+  void operator=(const vtkDeltaImageCompressor&) = delete;
+
+  // Previously compressed (resp. decompressed) image.
+  vtkNew<vtkUnsignedCharArray> Reference;
+  int ReferenceResolution[2];
+  vtkTypeUInt32 ReferenceFrameId;
+
+  // Id given to the next compressed image.
+  vtkTypeUInt32 NextFrameId;
+
+  // Packed dirty tiles.
+  vtkNew<vtkUnsignedCharArray> TemporaryBuffer;
+};
+
+#endif
@@ -6,9 +6,16 @@
 
 #include "vtkCommand.h"
 #include "vtkMultiProcessStream.h"
+#include "vtkSMPTools.h"
 #include "vtkUnsignedCharArray.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
 #include <sstream>
 #include <string>
+#include <vector>
 
 //-----------------------------------------------------------------------------
 vtkCxxSetObjectMacro(vtkImageCompressor, Output, vtkUnsignedCharArray);
@@ -21,6 +28,7 @@ vtkImageCompressor::vtkImageCompressor()
   : Output(nullptr)
   , Input(nullptr)
   , LossLessMode(0)
+  , NumberOfTiles(0)
   , Configuration(nullptr)
 {
   // Always allocate output array as a convenience.
@@ -88,11 +96,141 @@ const char* vtkImageCompressor::RestoreConfiguration(const char* stream)
   return nullptr;
 }
 
+//-----------------------------------------------------------------------------
+// The tiled format is:
+//   uint32 numberOfTiles
+//   numberOfTiles x (uint32 rawSize, uint32 compressedSize)
+//   compressed tiles, in order.
+bool vtkImageCompressor::CompressTiles(const unsigned char* in, vtkIdType inSize, int granularity,
+  vtkUnsignedCharArray* output, vtkIdType offset, const std::function<vtkIdType(vtkIdType)>& bound,
+  const TileCodec& codec)
+{
+  granularity = granularity > 0 ? granularity : 1;
+  const vtkIdType numUnits = inSize / granularity;
+  vtkIdType numTiles = std::max<vtkIdType>(1, std::min<vtkIdType>(this->NumberOfTiles, numUnits));
+  const vtkIdType unitsPerTile = (numUnits + numTiles - 1) / numTiles;
+  numTiles = unitsPerTile > 0 ? (numUnits + unitsPerTile - 1) / unitsPerTile : 1;
+  numTiles = std::max<vtkIdType>(1, numTiles);
+
+  std::vector<vtkIdType> rawOffsets(numTiles + 1);
+  std::vector<vtkIdType> boundOffsets(numTiles + 1);
+  rawOffsets[0] = boundOffsets[0] = 0;
+  for (vtkIdType cc = 0; cc < numTiles; ++cc)
+  {
+    // the last tile gets the remainder.
+    rawOffsets[cc + 1] =
+      (cc + 1 == numTiles) ? inSize : std::min(inSize, (cc + 1) * unitsPerTile * granularity);
+    boundOffsets[cc + 1] = boundOffsets[cc] + bound(rawOffsets[cc + 1] - rawOffsets[cc]);
+  }
+
+  const vtkIdType tableSize =
+    static_cast<vtkIdType>(sizeof(std::uint32_t) * (1 + 2 * static_cast<size_t>(numTiles)));
+  const vtkIdType dataStart = offset + tableSize;
+  output->SetNumberOfComponents(1);
+  unsigned char* buffer = output->WritePointer(0, dataStart + boundOffsets[numTiles]);
+
+  std::vector<vtkIdType> compressedSizes(numTiles, 0);
+  std::atomic<bool> status(true);
+  vtkSMPTools::For(0, numTiles, 1, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType cc = begin; cc < end; ++cc)
+    {
+      const vtkIdType size = codec(in + rawOffsets[cc], rawOffsets[cc + 1] - rawOffsets[cc],
+        buffer + dataStart + boundOffsets[cc], boundOffsets[cc + 1] - boundOffsets[cc]);
+      if (size <= 0 && rawOffsets[cc + 1] > rawOffsets[cc])
+      {
+        status = false;
+      }
+      compressedSizes[cc] = size;
+    }
+  });
+  if (!status)
+  {
+    return false;
+  }
+
+  // write the tile table and compact the compressed tiles.
+  std::uint32_t value = static_cast<std::uint32_t>(numTiles);
+  unsigned char* table = buffer + offset;
+  std::memcpy(table, &value, sizeof(value));
+  table += sizeof(value);
+  vtkIdType dataEnd = dataStart;
+  for (vtkIdType cc = 0; cc < numTiles; ++cc)
+  {
+    value = static_cast<std::uint32_t>(rawOffsets[cc + 1] - rawOffsets[cc]);
+    std::memcpy(table, &value, sizeof(value));
+    table += sizeof(value);
+    value = static_cast<std::uint32_t>(compressedSizes[cc]);
+    std::memcpy(table, &value, sizeof(value));
+    table += sizeof(value);
+
+    if (dataEnd != dataStart + boundOffsets[cc])
+    {
+      std::memmove(buffer + dataEnd, buffer + dataStart + boundOffsets[cc],
+        static_cast<size_t>(compressedSizes[cc]));
+    }
+    dataEnd += compressedSizes[cc];
+  }
+  output->SetNumberOfTuples(dataEnd);
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+bool vtkImageCompressor::DecompressTiles(const unsigned char* in, vtkIdType inSize,
+  unsigned char* out, vtkIdType outCapacity, const TileCodec& codec)
+{
+  std::uint32_t numTiles = 0;
+  if (inSize < static_cast<vtkIdType>(sizeof(numTiles)))
+  {
+    return false;
+  }
+  std::memcpy(&numTiles, in, sizeof(numTiles));
+  const vtkIdType tableSize =
+    static_cast<vtkIdType>(sizeof(std::uint32_t) * (1 + 2 * static_cast<size_t>(numTiles)));
+  if (numTiles == 0 || inSize < tableSize)
+  {
+    return false;
+  }
+
+  std::vector<vtkIdType> rawOffsets(numTiles + 1, 0);
+  std::vector<vtkIdType> compressedOffsets(numTiles + 1, tableSize);
+  const unsigned char* table = in + sizeof(numTiles);
+  for (std::uint32_t cc = 0; cc < numTiles; ++cc)
+  {
+    std::uint32_t rawSize, compressedSize;
+    std::memcpy(&rawSize, table, sizeof(rawSize));
+    table += sizeof(rawSize);
+    std::memcpy(&compressedSize, table, sizeof(compressedSize));
+    table += sizeof(compressedSize);
+    rawOffsets[cc + 1] = rawOffsets[cc] + rawSize;
+    compressedOffsets[cc + 1] = compressedOffsets[cc] + compressedSize;
+  }
+  if (rawOffsets[numTiles] > outCapacity || compressedOffsets[numTiles] > inSize)
+  {
+    return false;
+  }
+
+  std::atomic<bool> status(true);
+  vtkSMPTools::For(0, static_cast<vtkIdType>(numTiles), 1, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType cc = begin; cc < end; ++cc)
+    {
+      const vtkIdType rawSize = rawOffsets[cc + 1] - rawOffsets[cc];
+      if (rawSize > 0 &&
+        codec(in + compressedOffsets[cc], compressedOffsets[cc + 1] - compressedOffsets[cc],
+          out + rawOffsets[cc], rawSize) != rawSize)
+      {
+        status = false;
+      }
+    }
+  });
+  return status;
+}
+
 //-----------------------------------------------------------------------------
 void vtkImageCompressor::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
   os << indent << "Input:          " << this->Input << endl
      << indent << "Output:         " << this->Output << endl
-     << indent << "LossLessMode: " << this->LossLessMode << endl;
+     << indent << "LossLessMode: " << this->LossLessMode << endl
+     << indent << "NumberOfTiles: " << this->NumberOfTiles << endl;
 }
@@ -21,6 +21,8 @@
 #include "vtkObject.h"
 #include "vtkPVVTKExtensionsFiltersRenderingModule.h" // needed for export macro
 
+#include <functional> // for std::function
+
 class vtkUnsignedCharArray;
 class vtkMultiProcessStream;
 
@@ -55,6 +57,18 @@ public:
   vtkGetMacro(LossLessMode, int);
   ///@}
 
+  ///@{
+  /**
+   * Set the number of tiles the image is split into by compressors supporting
+   * tiled compression (vtkLZ4Compressor and vtkZlibImageCompressor). Tiles are
+   * compressed and decompressed independently and concurrently using
+   * vtkSMPTools. 0 or 1 means that the image is compressed as a single stream.
+   * Default is 0.
+   */
+  vtkSetClampMacro(NumberOfTiles, int, 0, 256);
+  vtkGetMacro(NumberOfTiles, int);
+  ///@}
+
   /**
    * Call this method to compress the input and generate the compressed
    * data.
@@ -91,7 +105,8 @@ public:
 
   /**
    * Restore state from the stream, The stream format for all image compressor
-   * is: [ClassName, LossLessMode, [Derived Class Stream]].
+   * is: [ClassName, LossLessMode, [Derived Class Stream]]. Compressors
+   * supporting tiles accept an optional trailing NumberOfTiles.
    * Upon success the stream is returned otherwise 0 is returned indicating
    * an error.
    */
@@ -111,6 +126,34 @@ protected:
   vtkUnsignedCharArray* Input;
 
   int LossLessMode;
+  int NumberOfTiles;
+
+  ///@{
+  /**
+   * Helpers for subclasses supporting tiled compression. A tile codec
+   * compresses (resp. decompresses) `inSize` bytes from `in` into `out` which
+   * can hold up to `outCapacity` bytes and returns the number of bytes written
+   * or a value <= 0 on error. It must be thread-safe.
+   *
+   * `CompressTiles` splits `inSize` bytes from `in` into NumberOfTiles tiles
+   * aligned on `granularity` bytes, compresses them concurrently and writes
+   * a tile table followed by the compressed tiles into `output` starting at
+   * `offset`. `bound` returns the maximum compressed size for a tile.
+   * `DecompressTiles` is the inverse operation. Both return false on error.
+   */
+  using TileCodec = std::function<vtkIdType(
+    const unsigned char* in, vtkIdType inSize, unsigned char* out, vtkIdType outCapacity)>;
+  bool CompressTiles(const unsigned char* in, vtkIdType inSize, int granularity,
+    vtkUnsignedCharArray* output, vtkIdType offset,
+    const std::function<vtkIdType(vtkIdType)>& bound, const TileCodec& codec);
+  bool DecompressTiles(const unsigned char* in, vtkIdType inSize, unsigned char* out,
+    vtkIdType outCapacity, const TileCodec& codec);
+  ///@}
+
+  /**
+   * Returns true when the tiled format must be used.
+   */
+  bool UseTiles() const { return this->NumberOfTiles > 1; }
 
   vtkSetStringMacro(Configuration);
   char* Configuration;
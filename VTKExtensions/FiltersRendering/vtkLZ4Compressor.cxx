@@ -4,12 +4,36 @@
 
 #include "vtkMultiProcessStream.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 #include "vtkUnsignedCharArray.h"
 
 #include "vtk_lz4.h"
 #include <cassert>
 #include <sstream>
 
+namespace
+{
+// Tile codecs used when NumberOfTiles > 1.
+vtkIdType LZ4TileBound(vtkIdType size)
+{
+  return static_cast<vtkIdType>(LZ4_compressBound(static_cast<int>(size)));
+}
+
+vtkIdType LZ4CompressTile(
+  const unsigned char* in, vtkIdType inSize, unsigned char* out, vtkIdType outCapacity)
+{
+  return LZ4_compress_fast(reinterpret_cast<const char*>(in), reinterpret_cast<char*>(out),
+    static_cast<int>(inSize), static_cast<int>(outCapacity), 16);
+}
+
+vtkIdType LZ4DecompressTile(
+  const unsigned char* in, vtkIdType inSize, unsigned char* out, vtkIdType outCapacity)
+{
+  return LZ4_decompress_safe(reinterpret_cast<const char*>(in), reinterpret_cast<char*>(out),
+    static_cast<int>(inSize), static_cast<int>(outCapacity));
+}
+}
+
 vtkStandardNewMacro(vtkLZ4Compressor);
 //----------------------------------------------------------------------------
 vtkLZ4Compressor::vtkLZ4Compressor()
@@ -50,13 +74,22 @@ int vtkLZ4Compressor::Compress()
     this->TemporaryBuffer->SetNumberOfTuples(input->GetNumberOfTuples());
     const unsigned int* in = reinterpret_cast<const unsigned int*>(input->GetPointer(0));
     unsigned int* out = reinterpret_cast<unsigned int*>(this->TemporaryBuffer->GetPointer(0));
-    for (vtkIdType cc = 0, max = this->Input->GetNumberOfTuples(); cc < max; ++cc)
-    {
-      out[cc] = in[cc] & compress_mask;
-    }
+    vtkSMPTools::For(0, this->Input->GetNumberOfTuples(), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType cc = begin; cc < end; ++cc)
+      {
+        out[cc] = in[cc] & compress_mask;
+      }
+    });
     input = this->TemporaryBuffer.Get();
   }
 
+  if (this->UseTiles())
+  {
+    const bool status = this->CompressTiles(input->GetPointer(0), inputSize,
+      input->GetNumberOfComponents(), this->Output, 0, LZ4TileBound, LZ4CompressTile);
+    return status ? VTK_OK : VTK_ERROR;
+  }
+
   int maxOutputSize = LZ4_compressBound(inputSize);
   int compressedSize = LZ4_compress_fast(reinterpret_cast<const char*>(input->GetPointer(0)),
     reinterpret_cast<char*>(this->Output->WritePointer(0, maxOutputSize)), inputSize, maxOutputSize,
@@ -76,6 +109,14 @@ int vtkLZ4Compressor::Decompress()
 
   int maxDecompressedSize =
     this->Output->GetNumberOfComponents() * this->Output->GetNumberOfTuples();
+  if (this->UseTiles())
+  {
+    const bool status = this->DecompressTiles(this->Input->GetPointer(0),
+      this->Input->GetNumberOfTuples(), this->Output->GetPointer(0), maxDecompressedSize,
+      LZ4DecompressTile);
+    return status ? VTK_OK : VTK_ERROR;
+  }
+
   int decompressedSize =
     LZ4_decompress_safe(reinterpret_cast<const char*>(this->Input->GetPointer(0)),
       reinterpret_cast<char*>(this->Output->GetPointer(0)), this->Input->GetNumberOfTuples(),
@@ -94,7 +135,7 @@ int vtkLZ4Compressor::Decompress()
 void vtkLZ4Compressor::SaveConfiguration(vtkMultiProcessStream* stream)
 {
   this->Superclass::SaveConfiguration(stream);
-  *stream << this->Quality;
+  *stream << this->Quality << this->NumberOfTiles;
 }
 
 //-----------------------------------------------------------------------------
@@ -103,8 +144,10 @@ bool vtkLZ4Compressor::RestoreConfiguration(vtkMultiProcessStream* stream)
   if (this->Superclass::RestoreConfiguration(stream))
   {
     int quality;
-    *stream >> quality;
+    int numberOfTiles;
+    *stream >> quality >> numberOfTiles;
     this->SetQuality(quality);
+    this->SetNumberOfTiles(numberOfTiles);
     return true;
   }
   return false;
@@ -115,6 +158,10 @@ const char* vtkLZ4Compressor::SaveConfiguration()
 {
   std::ostringstream oss;
   oss << this->Superclass::SaveConfiguration() << " " << this->Quality;
+  if (this->UseTiles())
+  {
+    oss << " " << this->NumberOfTiles;
+  }
   this->SetConfiguration(oss.str().c_str());
   return this->Configuration;
 }
@@ -129,6 +176,14 @@ const char* vtkLZ4Compressor::RestoreConfiguration(const char* stream)
     int quality;
     iss >> quality;
     this->SetQuality(quality);
+    // the number of tiles is optional.
+    int numberOfTiles = 0;
+    if (!(iss >> numberOfTiles))
+    {
+      numberOfTiles = 0;
+      iss.clear();
+    }
+    this->SetNumberOfTiles(numberOfTiles);
     return stream + iss.tellg();
   }
   return nullptr;
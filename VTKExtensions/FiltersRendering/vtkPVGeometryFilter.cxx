@@ -46,6 +46,8 @@
 #include "vtkRecoverGeometryWireframe.h"
 #include "vtkRectilinearGrid.h"
 #include "vtkRectilinearGridOutlineFilter.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStringArray.h"
@@ -138,6 +140,94 @@ public:
   int Commutative() override { return 1; }
 };
 
+//----------------------------------------------------------------------------
+// Functor used by RequestDataObjectTree() to extract the surface of several
+// leaves concurrently. The internal helper filters of vtkPVGeometryFilter are
+// not re-entrant, hence each thread executes the blocks using its own
+// vtkPVGeometryFilter instance configured like the one driving the execution.
+class vtkPVGeometryFilter::ExecuteBlocksFunctor
+{
+public:
+  ExecuteBlocksFunctor(vtkPVGeometryFilter* self, const std::vector<vtkDataObject*>& blocks,
+    const std::vector<unsigned int>& flatIndices, const int* wholeExtent)
+    : Self(self)
+    , Blocks(blocks)
+    , FlatIndices(flatIndices)
+    , WholeExtent(wholeExtent)
+    , Outputs(blocks.size())
+    , OutlineFlags(blocks.size(), 0)
+  {
+  }
+
+  void Initialize()
+  {
+    vtkPVGeometryFilter* self = this->Self;
+    auto& worker = this->Workers.Local();
+    worker.TakeReference(vtkPVGeometryFilter::SafeDownCast(self->NewInstance()));
+    worker->SetController(self->Controller);
+    worker->UseOutline = self->UseOutline;
+    worker->GenerateFeatureEdges = self->GenerateFeatureEdges;
+    worker->BlockColorsDistinctValues = self->BlockColorsDistinctValues;
+    worker->GenerateCellNormals = self->GenerateCellNormals;
+    worker->Triangulate = self->Triangulate;
+    worker->GenerateProcessIds = self->GenerateProcessIds;
+    worker->HideInternalAMRFaces = self->HideInternalAMRFaces;
+    worker->UseNonOverlappingAMRMetaDataForOutlines = self->UseNonOverlappingAMRMetaDataForOutlines;
+    worker->SetNonlinearSubdivisionLevel(self->NonlinearSubdivisionLevel);
+    worker->SetPassThroughCellIds(self->PassThroughCellIds);
+    worker->SetPassThroughPointIds(self->PassThroughPointIds);
+    worker->GeometryFilter->SetRemoveGhostInterfaces(!self->GenerateFeatureEdges);
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    vtkPVGeometryFilter* worker = this->Workers.Local();
+    for (vtkIdType cc = begin; cc < end; ++cc)
+    {
+      vtkDataObject* block = this->Blocks[cc];
+      if (!block)
+      {
+        continue;
+      }
+
+      vtkNew<vtkPolyData> tmpOut;
+      worker->ExecuteBlock(block, tmpOut, 0, 0, 1, 0, this->WholeExtent);
+      worker->CleanupOutputData(tmpOut, 0);
+      this->OutlineFlags[cc] = static_cast<char>(worker->OutlineFlag != 0);
+      // skip empty nodes.
+      if (tmpOut->GetNumberOfPoints() > 0)
+      {
+        worker->AddCompositeIndex(tmpOut, this->FlatIndices[cc]);
+        this->Outputs[cc] = tmpOut;
+      }
+    }
+  }
+
+  void Reduce()
+  {
+    // match the serial execution: the flag reflects the last processed block.
+    for (size_t cc = this->Blocks.size(); cc > 0; --cc)
+    {
+      if (this->Blocks[cc - 1])
+      {
+        this->Self->OutlineFlag = this->OutlineFlags[cc - 1];
+        break;
+      }
+    }
+  }
+
+  const std::vector<vtkSmartPointer<vtkPolyData>>& GetOutputs() const { return this->Outputs; }
+
+private:
+  vtkPVGeometryFilter* Self;
+  const std::vector<vtkDataObject*>& Blocks;
+  const std::vector<unsigned int>& FlatIndices;
+  const int* WholeExtent;
+  std::vector<vtkSmartPointer<vtkPolyData>> Outputs;
+  std::vector<char> OutlineFlags;
+  vtkSMPThreadLocal<vtkSmartPointer<vtkPVGeometryFilter>> Workers;
+};
+
 //----------------------------------------------------------------------------
 vtkPVGeometryFilter::vtkPVGeometryFilter()
 {
@@ -184,6 +274,7 @@ vtkPVGeometryFilter::vtkPVGeometryFilter()
 
   this->HideInternalAMRFaces = true;
   this->UseNonOverlappingAMRMetaDataForOutlines = true;
+  this->ExecuteBlocksInParallel = false;
 }
 
 //----------------------------------------------------------------------------
@@ -906,29 +997,62 @@ int vtkPVGeometryFilter::RequestDataObjectTree(
 
   int* wholeExtent =
     vtkStreamingDemandDrivenPipeline::GetWholeExtent(inputVector[0]->GetInformationObject(0));
-  int numInputs = 0;
-  for (inIter->InitTraversal(); !inIter->IsDoneWithTraversal(); inIter->GoToNextItem())
-  {
-    vtkDataObject* block = inIter->GetCurrentDataObject();
-    if (!block)
+  if (this->ExecuteBlocksInParallel && totNumBlocks > 1)
+  {
+    // Gather the leaves in traversal order so that they can be processed
+    // concurrently. The output tree is then populated by a second traversal
+    // which visits the leaves in the very same order.
+    std::vector<vtkDataObject*> blocks;
+    std::vector<unsigned int> flatIndices;
+    blocks.reserve(totNumBlocks);
+    flatIndices.reserve(totNumBlocks);
+    for (inIter->InitTraversal(); !inIter->IsDoneWithTraversal(); inIter->GoToNextItem())
     {
-      continue;
+      blocks.push_back(inIter->GetCurrentDataObject());
+      flatIndices.push_back(inIter->GetCurrentFlatIndex());
     }
 
-    vtkNew<vtkPolyData> tmpOut;
-    this->ExecuteBlock(block, tmpOut, 0, 0, 1, 0, wholeExtent);
-    this->CleanupOutputData(tmpOut, 0);
-    // skip empty nodes.
-    if (tmpOut->GetNumberOfPoints() > 0)
-    {
-      output->SetDataSet(inIter, tmpOut);
+    vtkPVGeometryFilter::ExecuteBlocksFunctor functor(this, blocks, flatIndices, wholeExtent);
+    vtkSMPTools::For(0, static_cast<vtkIdType>(blocks.size()), 1, functor);
 
-      const unsigned int current_flat_index = inIter->GetCurrentFlatIndex();
-      this->AddCompositeIndex(tmpOut, current_flat_index);
+    const auto& outputs = functor.GetOutputs();
+    size_t blockIdx = 0;
+    for (inIter->InitTraversal(); !inIter->IsDoneWithTraversal();
+         inIter->GoToNextItem(), ++blockIdx)
+    {
+      if (vtkPolyData* tmpOut = outputs[blockIdx])
+      {
+        output->SetDataSet(inIter, tmpOut);
+      }
     }
+    this->UpdateProgress(1.0);
+  }
+  else
+  {
+    int numInputs = 0;
+    for (inIter->InitTraversal(); !inIter->IsDoneWithTraversal(); inIter->GoToNextItem())
+    {
+      vtkDataObject* block = inIter->GetCurrentDataObject();
+      if (!block)
+      {
+        continue;
+      }
 
-    numInputs++;
-    this->UpdateProgress(static_cast<float>(numInputs) / totNumBlocks);
+      vtkNew<vtkPolyData> tmpOut;
+      this->ExecuteBlock(block, tmpOut, 0, 0, 1, 0, wholeExtent);
+      this->CleanupOutputData(tmpOut, 0);
+      // skip empty nodes.
+      if (tmpOut->GetNumberOfPoints() > 0)
+      {
+        output->SetDataSet(inIter, tmpOut);
+
+        const unsigned int current_flat_index = inIter->GetCurrentFlatIndex();
+        this->AddCompositeIndex(tmpOut, current_flat_index);
+      }
+
+      numInputs++;
+      this->UpdateProgress(static_cast<float>(numInputs) / totNumBlocks);
+    }
   }
   vtkTimerLog::MarkEndEvent("vtkPVGeometryFilter::ExecuteCompositeDataSet");
 
@@ -1751,6 +1875,8 @@ void vtkPVGeometryFilter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "HideInternalAMRFaces: " << (this->HideInternalAMRFaces ? "on" : "off") << endl;
   os << indent << "UseNonOverlappingAMRMetaDataForOutlines: "
      << (this->UseNonOverlappingAMRMetaDataForOutlines ? "on" : "off") << endl;
+  os << indent << "ExecuteBlocksInParallel: " << (this->ExecuteBlocksInParallel ? "on" : "off")
+     << endl;
 }
 
 //----------------------------------------------------------------------------
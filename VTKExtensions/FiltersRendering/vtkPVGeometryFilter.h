@@ -215,6 +215,19 @@ public:
   vtkBooleanMacro(UseNonOverlappingAMRMetaDataForOutlines, bool);
   ///@}
 
+  ///@{
+  /**
+   * When set to true, the leaves of a non-AMR composite input are converted to
+   * surfaces concurrently using vtkSMPTools. Each thread uses its own set of
+   * internal helper filters. The output tree, the block ordering and the
+   * `vtkCompositeIndex` arrays are identical to the ones produced serially.
+   * Default is false.
+   */
+  vtkSetMacro(ExecuteBlocksInParallel, bool);
+  vtkGetMacro(ExecuteBlocksInParallel, bool);
+  vtkBooleanMacro(ExecuteBlocksInParallel, bool);
+  ///@}
+
   // These keys are put in the output composite-data metadata for multipieces
   // since this filter merges multipieces together.
   static vtkInformationIntegerVectorKey* POINT_OFFSETS();
@@ -330,6 +343,7 @@ protected:
   bool HideInternalAMRFaces;
   bool UseNonOverlappingAMRMetaDataForOutlines;
   bool GenerateFeatureEdges;
+  bool ExecuteBlocksInParallel;
 
 private:
   vtkPVGeometryFilter(const vtkPVGeometryFilter&) = delete;
@@ -346,6 +360,7 @@ private:
   void AddBlockColors(vtkDataObject* pd, unsigned int index);
   void AddHierarchicalIndex(vtkPolyData* pd, unsigned int level, unsigned int index);
   class BoundsReductionOperation;
+  class ExecuteBlocksFunctor;
   ///@}
 };
 
@@ -10,6 +10,24 @@
 
 vtkStandardNewMacro(vtkZlibImageCompressor);
 
+namespace
+{
+// Tile codecs used when NumberOfTiles > 1.
+vtkIdType ZlibTileBound(vtkIdType size)
+{
+  return static_cast<vtkIdType>(compressBound(static_cast<uLong>(size)));
+}
+
+vtkIdType ZlibDecompressTile(
+  const unsigned char* in, vtkIdType inSize, unsigned char* out, vtkIdType outCapacity)
+{
+  uLongf outSize = static_cast<uLongf>(outCapacity);
+  int status = uncompress(reinterpret_cast<Bytef*>(out), &outSize,
+    reinterpret_cast<const Bytef*>(in), static_cast<uLong>(inSize));
+  return status == Z_OK ? static_cast<vtkIdType>(outSize) : -1;
+}
+}
+
 //=============================================================================
 class vtkZlibCompressorImageConditioner
 {
@@ -338,6 +356,27 @@ int vtkZlibImageCompressor::Compress()
   int inImageComps;
   this->Conditioner->PreProcess(this->Input, inImage, inImageComps, inImageSize, freeInImage);
 
+  if (this->UseTiles())
+  {
+    // 1 byte for strip alpha followed by the tiles.
+    const int level = this->CompressionLevel;
+    const bool status = this->CompressTiles(inImage, inImageSize, inImageComps, this->Output, 1,
+      ZlibTileBound,
+      [level](const unsigned char* in, vtkIdType inSize, unsigned char* out,
+        vtkIdType outCapacity) -> vtkIdType {
+        uLongf outSize = static_cast<uLongf>(outCapacity);
+        int zstatus = compress2(reinterpret_cast<Bytef*>(out), &outSize,
+          reinterpret_cast<const Bytef*>(in), static_cast<uLong>(inSize), level);
+        return zstatus == Z_OK ? static_cast<vtkIdType>(outSize) : -1;
+      });
+    this->Output->SetValue(0, static_cast<unsigned char>(inImageComps));
+    if (freeInImage)
+    {
+      free(inImage);
+    }
+    return status ? VTK_OK : VTK_ERROR;
+  }
+
   // Compress
   uLongf outImageSize = static_cast<uLongf>(1.001 * inImageSize + 17);
   // zlib requires 100.1% + 16, 1 byte for strip alpha
@@ -377,7 +416,22 @@ int vtkZlibImageCompressor::Decompress()
   uLongf decompImSize =
     static_cast<uLongf>(this->Output->GetNumberOfComponents() * this->Output->GetNumberOfTuples());
   unsigned char* decompIm = this->Output->GetPointer(0);
-  uncompress((Bytef*)decompIm, &decompImSize, (const Bytef*)compIm, compImSize);
+  if (this->UseTiles())
+  {
+    const bool status = this->DecompressTiles(
+      compIm, compImSize, decompIm, static_cast<vtkIdType>(decompImSize), ZlibDecompressTile);
+    if (!status)
+    {
+      return VTK_ERROR;
+    }
+    // the tiles hold RGB values when alpha was stripped.
+    decompImSize = static_cast<uLongf>(
+      (this->GetStripAlpha() ? 3 : 4) * this->Output->GetNumberOfTuples());
+  }
+  else
+  {
+    uncompress((Bytef*)decompIm, &decompImSize, (const Bytef*)compIm, compImSize);
+  }
 
   // undo pre-proccssing.
   const int decompImComps = (this->GetStripAlpha() ? 3 : 4);
@@ -391,7 +445,8 @@ int vtkZlibImageCompressor::Decompress()
 void vtkZlibImageCompressor::SaveConfiguration(vtkMultiProcessStream* stream)
 {
   vtkImageCompressor::SaveConfiguration(stream);
-  *stream << this->CompressionLevel << this->GetColorSpace() << this->GetStripAlpha();
+  *stream << this->CompressionLevel << this->GetColorSpace() << this->GetStripAlpha()
+          << this->NumberOfTiles;
 }
 
 //-----------------------------------------------------------------------------
@@ -401,9 +456,11 @@ bool vtkZlibImageCompressor::RestoreConfiguration(vtkMultiProcessStream* stream)
   {
     int colorSpace;
     int stripAlpha;
-    *stream >> this->CompressionLevel >> colorSpace >> stripAlpha;
+    int numberOfTiles;
+    *stream >> this->CompressionLevel >> colorSpace >> stripAlpha >> numberOfTiles;
     this->SetColorSpace(colorSpace);
     this->SetStripAlpha(stripAlpha);
+    this->SetNumberOfTiles(numberOfTiles);
     return true;
   }
   return false;
@@ -415,6 +472,10 @@ const char* vtkZlibImageCompressor::SaveConfiguration()
   std::ostringstream oss;
   oss << vtkImageCompressor::SaveConfiguration() << " " << this->CompressionLevel << " "
       << this->GetColorSpace() << " " << this->GetStripAlpha();
+  if (this->UseTiles())
+  {
+    oss << " " << this->NumberOfTiles;
+  }
 
   this->SetConfiguration(oss.str().c_str());
 
@@ -433,6 +494,14 @@ const char* vtkZlibImageCompressor::RestoreConfiguration(const char* stream)
     iss >> this->CompressionLevel >> colorSpace >> stripAlpha;
     this->SetColorSpace(colorSpace);
     this->SetStripAlpha(stripAlpha);
+    // the number of tiles is optional.
+    int numberOfTiles = 0;
+    if (!(iss >> numberOfTiles))
+    {
+      numberOfTiles = 0;
+      iss.clear();
+    }
+    this->SetNumberOfTiles(numberOfTiles);
     return stream + iss.tellg();
   }
   return nullptr;
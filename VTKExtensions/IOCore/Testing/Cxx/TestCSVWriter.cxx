@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkConstantArray.h"
 #include <vtkCSVWriter.h>
+#include <vtkColumnarTableReader.h>
 #include <vtkDelimitedTextReader.h>
 #include <vtkDoubleArray.h>
 #include <vtkIntArray.h>
@@ -64,6 +65,7 @@ bool WriteCSV(const std::string& fname, int rank)
 
   vtkNew<vtkCSVWriter> writer;
   writer->SetFileName(fname.c_str());
+  writer->SetWriteColumnarSidecar(true);
   writer->SetInputDataObject(table);
   writer->Update();
   return true;
@@ -113,6 +115,38 @@ bool ReadAndVerifyCSV(const std::string& fname, int rank, int numRanks)
   return true;
 }
 
+// the sidecar has one chunk per rank, in the same order as the CSV rows.
+bool ReadAndVerifySidecar(const std::string& fname, int rank, int numRanks)
+{
+  if (rank != 0)
+  {
+    return true;
+  }
+
+  vtkNew<vtkColumnarTableReader> reader;
+  reader->SetFileName(vtkCSVWriter::GetColumnarSidecarFileName(fname).c_str());
+  reader->Update();
+
+  auto table = reader->GetOutput();
+  VERITFY_EQ(table->GetNumberOfRows(), 10 * numRanks, "incorrect sidecar row count");
+  VERITFY_EQ(table->GetNumberOfColumns(), 3, "incorrect sidecar column count");
+  VERITFY_EQ(vtkDoubleArray::SafeDownCast(table->GetColumnByName("Column1")) != nullptr, true,
+    "incorrect sidecar column1 type");
+  VERITFY_EQ(vtkIntArray::SafeDownCast(table->GetColumnByName("Column2")) != nullptr, true,
+    "incorrect sidecar column2 type");
+
+  for (vtkIdType row = 0; row < 10 * numRanks; ++row)
+  {
+    VERITFY_EQ(table->GetValueByName(row, "Column1").ToDouble(), row + 1.5,
+      std::string("incorrect sidecar column1 values at row ") + std::to_string(row));
+    VERITFY_EQ(table->GetValueByName(row, "Column2").ToInt(), row * 100,
+      std::string("incorrect sidecar column2 values at row ") + std::to_string(row));
+    VERITFY_EQ(table->GetValueByName(row, "Column4-implicit").ToInt(), 42,
+      std::string("incorrect sidecar column4 values at row ") + std::to_string(row));
+  }
+  return true;
+}
+
 } // end of namespace
 
 int TestCSVWriter(int argc, char* argv[])
@@ -136,7 +170,8 @@ int TestCSVWriter(int argc, char* argv[])
 
   std::string tname{ testing->GetTempDirectory() };
   int success = WriteCSV(tname + "/TestCSVWriter.csv", myRank) &&
-      ReadAndVerifyCSV(tname + "/TestCSVWriter.csv", myRank, numRanks)
+      ReadAndVerifyCSV(tname + "/TestCSVWriter.csv", myRank, numRanks) &&
+      ReadAndVerifySidecar(tname + "/TestCSVWriter.csv", myRank, numRanks)
     ? 1
     : 0;
 
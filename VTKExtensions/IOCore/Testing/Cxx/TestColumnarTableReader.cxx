@@ -0,0 +1,247 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Checks that the columnar sidecar written by vtkCSVWriter round trips, and
+// compares the time needed to read it with vtkColumnarTableReader with the
+// time needed to parse the CSV file with vtkDelimitedTextReader. Use
+// `--rows <n>` to change the size of the table. Also checks that time steps
+// with other columns are appended with the columns of the first one.
+
+#include "vtkCSVWriter.h"
+#include "vtkColumnarTableReader.h"
+#include "vtkDelimitedTextReader.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkIntArray.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkStringArray.h"
+#include "vtkTable.h"
+#include "vtkTableAlgorithm.h"
+#include "vtkTestUtilities.h"
+#include "vtkTimerLog.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#define VERIFY(x, ...)                                                                             \
+  if (!(x))                                                                                        \
+  {                                                                                                \
+    vtkLogF(ERROR, __VA_ARGS__);                                                                   \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+namespace
+{
+// Produces a table with 2 rows per time step. "Values" is a double column at
+// the first time step and an int column at the second one, "Labels" is only
+// there at the first time step and "Extra" only at the second one.
+class TestChangingColumnsSource : public vtkTableAlgorithm
+{
+public:
+  static TestChangingColumnsSource* New();
+  vtkTypeMacro(TestChangingColumnsSource, vtkTableAlgorithm);
+
+protected:
+  TestChangingColumnsSource() { this->SetNumberOfInputPorts(0); }
+
+  int RequestInformation(
+    vtkInformation*, vtkInformationVector**, vtkInformationVector* outputVector) override
+  {
+    const double times[2] = { 0.0, 1.0 };
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_STEPS(), times, 2);
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_RANGE(), times, 2);
+    return 1;
+  }
+
+  int RequestData(
+    vtkInformation*, vtkInformationVector**, vtkInformationVector* outputVector) override
+  {
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    const bool first = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP()) < 0.5;
+    vtkTable* output = vtkTable::GetData(outInfo);
+    if (first)
+    {
+      vtkNew<vtkDoubleArray> values;
+      values->SetName("Values");
+      values->InsertNextValue(0.5);
+      values->InsertNextValue(1.5);
+      output->AddColumn(values);
+      vtkNew<vtkStringArray> labels;
+      labels->SetName("Labels");
+      labels->InsertNextValue("a");
+      labels->InsertNextValue("b");
+      output->AddColumn(labels);
+    }
+    else
+    {
+      vtkNew<vtkIntArray> values;
+      values->SetName("Values");
+      values->InsertNextValue(2);
+      values->InsertNextValue(3);
+      output->AddColumn(values);
+      vtkNew<vtkIntArray> extra;
+      extra->SetName("Extra");
+      extra->InsertNextValue(7);
+      extra->InsertNextValue(8);
+      output->AddColumn(extra);
+    }
+    return 1;
+  }
+};
+vtkStandardNewMacro(TestChangingColumnsSource);
+
+int TestChangingColumns(const std::string& fname)
+{
+  vtkNew<TestChangingColumnsSource> source;
+  vtkNew<vtkCSVWriter> writer;
+  writer->SetController(nullptr);
+  writer->SetFileName(fname.c_str());
+  writer->SetWriteColumnarSidecar(true);
+  writer->SetWriteAllTimeSteps(true);
+  writer->SetInputConnection(source->GetOutputPort());
+  writer->Write();
+
+  vtkNew<vtkColumnarTableReader> reader;
+  reader->SetFileName(vtkCSVWriter::GetColumnarSidecarFileName(fname).c_str());
+  reader->Update();
+  vtkTable* output = reader->GetOutput();
+  VERIFY(output->GetNumberOfRows() == 4 && output->GetNumberOfColumns() == 2,
+    "Unexpected appended table size %d x %d.", static_cast<int>(output->GetNumberOfRows()),
+    static_cast<int>(output->GetNumberOfColumns()));
+  auto values = vtkDoubleArray::SafeDownCast(output->GetColumnByName("Values"));
+  auto labels = vtkStringArray::SafeDownCast(output->GetColumnByName("Labels"));
+  VERIFY(values && labels, "Appended columns must keep the columns of the first time step.");
+  VERIFY(values->GetValue(0) == 0.5 && values->GetValue(1) == 1.5 && values->GetValue(2) == 2.0 &&
+      values->GetValue(3) == 3.0,
+    "Unexpected appended values.");
+  VERIFY(labels->GetValue(0) == "a" && labels->GetValue(1) == "b" && labels->GetValue(2).empty() &&
+      labels->GetValue(3).empty(),
+    "Missing labels must be empty.");
+  return EXIT_SUCCESS;
+}
+}
+
+int TestColumnarTableReader(int argc, char* argv[])
+{
+  vtkIdType numberOfRows = 100000;
+  for (int cc = 1; cc + 1 < argc; ++cc)
+  {
+    if (!strcmp(argv[cc], "--rows"))
+    {
+      numberOfRows = std::max(1, atoi(argv[++cc]));
+    }
+  }
+
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  const std::string tempDirectory = tempDir;
+  delete[] tempDir;
+  const std::string fname = tempDirectory + "/TestColumnarTableReader.csv";
+
+  vtkNew<vtkDoubleArray> scalars;
+  scalars->SetName("Scalars");
+  scalars->SetNumberOfTuples(numberOfRows);
+  vtkNew<vtkIntArray> vectors;
+  vectors->SetName("Vectors");
+  vectors->SetNumberOfComponents(3);
+  vectors->SetNumberOfTuples(numberOfRows);
+  vtkNew<vtkIdTypeArray> ids;
+  ids->SetName("Ids");
+  ids->SetNumberOfTuples(numberOfRows);
+  vtkNew<vtkStringArray> labels;
+  labels->SetName("Labels");
+  labels->SetNumberOfTuples(numberOfRows);
+  for (vtkIdType row = 0; row < numberOfRows; ++row)
+  {
+    scalars->SetValue(row, row * 0.25);
+    vectors->SetTypedComponent(row, 0, static_cast<int>(row));
+    vectors->SetTypedComponent(row, 1, static_cast<int>(-row));
+    vectors->SetTypedComponent(row, 2, static_cast<int>(row % 7));
+    ids->SetValue(row, row * 3);
+    labels->SetValue(row, "label" + std::to_string(row % 100));
+  }
+  vtkNew<vtkTable> table;
+  table->AddColumn(scalars);
+  table->AddColumn(vectors);
+  table->AddColumn(ids);
+  table->AddColumn(labels);
+
+  vtkNew<vtkTimerLog> timer;
+  vtkNew<vtkCSVWriter> writer;
+  writer->SetController(nullptr);
+  writer->SetFileName(fname.c_str());
+  writer->SetPrecision(17);
+  writer->SetWriteColumnarSidecar(true);
+  writer->SetInputDataObject(table);
+  timer->StartTimer();
+  writer->Write();
+  timer->StopTimer();
+  const double writeTime = timer->GetElapsedTime();
+
+  vtkNew<vtkDelimitedTextReader> csvReader;
+  csvReader->SetFileName(fname.c_str());
+  csvReader->SetHaveHeaders(true);
+  csvReader->SetDetectNumericColumns(true);
+  timer->StartTimer();
+  csvReader->Update();
+  timer->StopTimer();
+  const double csvTime = timer->GetElapsedTime();
+  VERIFY(csvReader->GetOutput()->GetNumberOfRows() == numberOfRows, "Unexpected CSV row count.");
+
+  vtkNew<vtkColumnarTableReader> reader;
+  reader->SetFileName(vtkCSVWriter::GetColumnarSidecarFileName(fname).c_str());
+  timer->StartTimer();
+  reader->Update();
+  timer->StopTimer();
+  const double columnarTime = timer->GetElapsedTime();
+
+  // columns keep their type and components.
+  vtkTable* output = reader->GetOutput();
+  VERIFY(output->GetNumberOfRows() == numberOfRows && output->GetNumberOfColumns() == 4,
+    "Unexpected table size %d x %d.", static_cast<int>(output->GetNumberOfRows()),
+    static_cast<int>(output->GetNumberOfColumns()));
+  auto outScalars = vtkDoubleArray::SafeDownCast(output->GetColumnByName("Scalars"));
+  auto outVectors = vtkIntArray::SafeDownCast(output->GetColumnByName("Vectors"));
+  auto outIds = vtkDataArray::SafeDownCast(output->GetColumnByName("Ids"));
+  auto outLabels = vtkStringArray::SafeDownCast(output->GetColumnByName("Labels"));
+  VERIFY(outScalars && outVectors && outVectors->GetNumberOfComponents() == 3 && outIds &&
+      outIds->GetDataTypeSize() == static_cast<int>(sizeof(vtkIdType)) && outLabels,
+    "Unexpected column types.");
+  for (vtkIdType row = 0; row < numberOfRows; ++row)
+  {
+    VERIFY(outScalars->GetValue(row) == scalars->GetValue(row) &&
+        outVectors->GetTypedComponent(row, 0) == vectors->GetTypedComponent(row, 0) &&
+        outVectors->GetTypedComponent(row, 1) == vectors->GetTypedComponent(row, 1) &&
+        outVectors->GetTypedComponent(row, 2) == vectors->GetTypedComponent(row, 2) &&
+        outIds->GetComponent(row, 0) == ids->GetValue(row) &&
+        outLabels->GetValue(row) == labels->GetValue(row),
+      "Unexpected values at row %d.", static_cast<int>(row));
+  }
+
+  // columns referencing the file can be modified without modifying the file.
+  outScalars->SetValue(0, -1.0);
+  reader->Modified();
+  reader->Update();
+  outScalars = vtkDoubleArray::SafeDownCast(reader->GetOutput()->GetColumnByName("Scalars"));
+  VERIFY(outScalars && outScalars->GetValue(0) == 0.0, "The file was modified.");
+
+  if (TestChangingColumns(tempDirectory + "/TestColumnarTableReaderAppend.csv") != EXIT_SUCCESS)
+  {
+    return EXIT_FAILURE;
+  }
+
+  printf("Rows:               %lld\n", static_cast<long long>(numberOfRows));
+  printf("Write (s):          %f\n", writeTime);
+  printf("CSV read (s):       %f\n", csvTime);
+  printf("Columnar read (s):  %f\n", columnarTime);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCompositeDataSet.h"
+#include "vtkInformation.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPVDReader.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkTestUtilities.h"
+#include "vtkXMLPolyDataWriter.h"
+
+#include <fstream>
+#include <string>
+
+#define TASSERT(x)                                                                                 \
+  if (!(x))                                                                                        \
+  {                                                                                                \
+    cerr << "ERROR: failed at " << __LINE__ << "!" << endl;                                        \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+namespace
+{
+const int NumberOfFiles = 7;
+
+// Writes `NumberOfFiles` polydata, the i-th having i+1 points, and a pvd
+// file listing them. Returns the name of the pvd file.
+std::string WriteCollection(const std::string& prefix)
+{
+  std::ofstream pvd(prefix + ".pvd");
+  pvd << "<?xml version=\"1.0\"?>\n"
+      << "<VTKFile type=\"Collection\" version=\"0.1\">\n"
+      << "  <Collection>\n";
+  for (int cc = 0; cc < NumberOfFiles; ++cc)
+  {
+    vtkNew<vtkPoints> points;
+    for (int pt = 0; pt <= cc; ++pt)
+    {
+      points->InsertNextPoint(pt, cc, 0);
+    }
+    vtkNew<vtkPolyData> pd;
+    pd->SetPoints(points);
+
+    const std::string fname = prefix + "_" + std::to_string(cc) + ".vtp";
+    vtkNew<vtkXMLPolyDataWriter> writer;
+    writer->SetInputData(pd);
+    writer->SetFileName(fname.c_str());
+    writer->Write();
+
+    // relative to the pvd file.
+    const std::string relname = fname.substr(fname.find_last_of('/') + 1);
+    pvd << "    <DataSet part=\"" << cc << "\" name=\"block" << cc << "\" file=\"" << relname
+        << "\"/>\n";
+  }
+  pvd << "  </Collection>\n"
+      << "</VTKFile>\n";
+  return prefix + ".pvd";
+}
+
+bool Verify(vtkPVDReader* reader)
+{
+  reader->Update();
+  auto output = vtkMultiBlockDataSet::SafeDownCast(reader->GetOutputDataObject(0));
+  if (!output || output->GetNumberOfBlocks() != NumberOfFiles)
+  {
+    return false;
+  }
+  for (int cc = 0; cc < NumberOfFiles; ++cc)
+  {
+    auto block = vtkMultiBlockDataSet::SafeDownCast(output->GetBlock(cc));
+    auto pd = block ? vtkPolyData::SafeDownCast(block->GetBlock(0)) : nullptr;
+    const std::string name = "block" + std::to_string(cc);
+    if (!pd || pd->GetNumberOfPoints() != cc + 1 ||
+      name != output->GetMetaData(cc)->Get(vtkCompositeDataSet::NAME()))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestPVDConcurrentRead(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  const std::string fname = WriteCollection(std::string(tempDir) + "/TestPVDConcurrentRead");
+  delete[] tempDir;
+
+  vtkNew<vtkPVDReader> reader;
+  reader->SetFileName(fname.c_str());
+  TASSERT(reader->GetNumberOfReadThreads() == 1);
+  TASSERT(Verify(reader));
+
+  reader->SetNumberOfReadThreads(3);
+  reader->Modified();
+  TASSERT(Verify(reader));
+
+  // more threads than files.
+  reader->SetNumberOfReadThreads(2 * NumberOfFiles);
+  reader->Modified();
+  TASSERT(Verify(reader));
+
+  // as many threads as the hardware supports.
+  reader->SetNumberOfReadThreads(0);
+  reader->Modified();
+  TASSERT(Verify(reader));
+  return EXIT_SUCCESS;
+}
@@ -9,12 +9,14 @@
 #include "vtkAttributeDataToTableFilter.h"
 #include "vtkCellData.h"
 #include "vtkCharArray.h"
+#include "vtkColumnarTableUtilities.h"
 #include "vtkDataArray.h"
 #include "vtkDataArrayRange.h"
 #include "vtkDoubleArray.h"
 #include "vtkErrorCode.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
+#include "vtkIntArray.h"
 #include "vtkMultiProcessController.h"
 #include "vtkObjectFactory.h"
 #include "vtkPVMergeTables.h"
@@ -30,6 +32,8 @@
 #include "vtksys/FStream.hxx"
 #include "vtksys/SystemTools.hxx"
 
+#include <algorithm>
+#include <cstring>
 #include <sstream>
 #include <vector>
 
@@ -57,6 +61,7 @@ vtkCSVWriter::vtkCSVWriter()
   this->AddMetaData = false;
   this->AddTimeStep = false;
   this->AddTime = false;
+  this->WriteColumnarSidecar = false;
   this->CurrentTimeIndex = 0;
   this->NumberOfTimeSteps = 0;
   this->TimeValues = nullptr;
@@ -317,7 +322,19 @@ struct WorkerCreator
 class vtkCSVWriter::CSVFile
 {
   vtksys::ofstream Stream;
+  vtksys::ofstream Sidecar;
+  vtkTypeUInt64 SidecarPosition = 0;
   std::vector<std::pair<std::string, int>> ColumnInfo;
+
+  // Columns of the first chunk of the sidecar, which all the chunks must have.
+  struct SidecarColumn
+  {
+    std::string Name;
+    int DataType;
+    int NumberOfComponents;
+  };
+  std::vector<SidecarColumn> SidecarColumns;
+  bool HasSidecarColumns = false;
   int TimeStep = -1;
   double Time = vtkMath::Nan();
   std::vector<std::shared_ptr<::AbstractStreamWorker>> ColumnsWorkers;
@@ -335,7 +352,7 @@ public:
     Append
   };
 
-  int Open(const char* filename, OpenMode mode)
+  int Open(const char* filename, OpenMode mode, bool sidecar)
   {
     if (!filename)
     {
@@ -353,9 +370,81 @@ public:
     {
       return vtkErrorCode::CannotOpenFileError;
     }
+    return sidecar ? this->OpenSidecar(vtkCSVWriter::GetColumnarSidecarFileName(filename), mode)
+                   : vtkErrorCode::NoError;
+  }
+
+  int OpenSidecar(const std::string& filename, OpenMode mode)
+  {
+    namespace format = vtkColumnarTableUtilities;
+    const vtkTypeUInt64 length =
+      OpenMode::Append == mode && vtksys::SystemTools::FileExists(filename, /*isFile=*/true)
+      ? vtksys::SystemTools::FileLength(filename)
+      : 0;
+    if (length > 0)
+    {
+      // new rows are appended as a new chunk, with the columns of the first one.
+      this->ReadSidecarColumns(filename);
+      this->Sidecar.open(filename.c_str(), ios::out | ios::app | ios::binary);
+      this->SidecarPosition = length;
+    }
+    else
+    {
+      this->Sidecar.open(filename.c_str(), ios::out | ios::trunc | ios::binary);
+      format::FileHeader header;
+      memcpy(header.Magic, format::MAGIC, sizeof(format::MAGIC));
+      header.Version = format::VERSION;
+      header.ByteOrderMark = format::BYTE_ORDER_MARK;
+      this->WriteSidecar(&header, sizeof(header));
+    }
+    if (this->Sidecar.fail())
+    {
+      return vtkErrorCode::CannotOpenFileError;
+    }
     return vtkErrorCode::NoError;
   }
 
+  // Reads the columns of the first chunk of an existing sidecar.
+  void ReadSidecarColumns(const std::string& filename)
+  {
+    namespace format = vtkColumnarTableUtilities;
+    vtksys::ifstream file(filename.c_str(), ios::in | ios::binary);
+    format::FileHeader fileHeader;
+    format::ChunkHeader chunkHeader;
+    if (!file.read(reinterpret_cast<char*>(&fileHeader), sizeof(fileHeader)) ||
+      fileHeader.ByteOrderMark != format::BYTE_ORDER_MARK ||
+      !file.read(reinterpret_cast<char*>(&chunkHeader), sizeof(chunkHeader)))
+    {
+      return;
+    }
+
+    std::vector<SidecarColumn> columns;
+    vtkTypeUInt64 position = sizeof(fileHeader) + sizeof(chunkHeader);
+    for (vtkTypeUInt32 cc = 0; cc < chunkHeader.NumberOfColumns; ++cc)
+    {
+      format::ColumnHeader header;
+      std::string name;
+      if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+      {
+        return;
+      }
+      name.resize(header.NameLength);
+      if (!file.read(&name[0], header.NameLength))
+      {
+        return;
+      }
+      columns.push_back(SidecarColumn{ name, header.DataType, header.NumberOfComponents });
+
+      position += sizeof(header) + header.NameLength;
+      position += format::GetPadding(position);
+      position += header.DataSize;
+      position += format::GetPadding(position);
+      file.seekg(static_cast<std::streamoff>(position));
+    }
+    this->SidecarColumns = std::move(columns);
+    this->HasSidecarColumns = true;
+  }
+
   void WriteHeader(vtkTable* table, vtkCSVWriter* self, OpenMode mode)
   {
     this->WriteHeader(table->GetRowData(), self, mode);
@@ -515,13 +604,222 @@ public:
       }
       this->Stream << "\n";
     }
+
+    if (this->Sidecar.is_open())
+    {
+      this->WriteSidecarChunk(dsa, self);
+    }
   }
 
 private:
+  void WriteSidecar(const void* data, vtkTypeUInt64 size)
+  {
+    this->Sidecar.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    this->SidecarPosition += size;
+  }
+
+  void WriteSidecarPadding()
+  {
+    static const char zeros[vtkColumnarTableUtilities::ALIGNMENT] = {};
+    this->WriteSidecar(zeros, vtkColumnarTableUtilities::GetPadding(this->SidecarPosition));
+  }
+
+  // Returns the type a column is stored with in the sidecar.
+  static int GetSidecarType(vtkAbstractArray* array)
+  {
+    return vtkStringArray::SafeDownCast(array)
+      ? VTK_STRING
+      : vtkColumnarTableUtilities::GetStorageType(array->GetDataType());
+  }
+
+  // Returns a column for `column` with `numTuples` tuples, filled with the
+  // values of `array` that can be converted and padded with empty strings,
+  // NaN or 0.
+  static vtkSmartPointer<vtkAbstractArray> NewPaddedColumn(
+    const SidecarColumn& column, vtkAbstractArray* array, vtkIdType numTuples)
+  {
+    vtkSmartPointer<vtkAbstractArray> padded;
+    if (column.DataType == VTK_STRING)
+    {
+      padded = vtkSmartPointer<vtkStringArray>::New();
+    }
+    else
+    {
+      padded.TakeReference(vtkDataArray::CreateDataArray(column.DataType));
+    }
+    padded->SetName(column.Name.c_str());
+    padded->SetNumberOfComponents(column.NumberOfComponents);
+    padded->SetNumberOfTuples(numTuples);
+    if (auto values = vtkDataArray::SafeDownCast(padded))
+    {
+      const bool real = column.DataType == VTK_FLOAT || column.DataType == VTK_DOUBLE;
+      for (int comp = 0; comp < column.NumberOfComponents; ++comp)
+      {
+        values->FillComponent(comp, real ? vtkMath::Nan() : 0.0);
+      }
+    }
+    if (array && array->GetNumberOfComponents() == column.NumberOfComponents &&
+      (vtkStringArray::SafeDownCast(array) != nullptr) == (column.DataType == VTK_STRING))
+    {
+      padded->InsertTuples(0, std::min(numTuples, array->GetNumberOfTuples()), 0, array);
+    }
+    return padded;
+  }
+
+  // Writes the rows of `dsa` as a chunk of the sidecar. The first chunk has
+  // the same columns as the CSV file, later chunks have the columns of the
+  // first one so that the sidecar remains a single table: missing,
+  // incomplete or mismatched columns are padded, and new ones are skipped.
+  void WriteSidecarChunk(vtkDataSetAttributes* dsa, vtkCSVWriter* self)
+  {
+    const vtkIdType numTuples = dsa->GetNumberOfTuples();
+    std::vector<vtkSmartPointer<vtkAbstractArray>> arrays;
+    if (this->TimeStep >= 0)
+    {
+      vtkNew<vtkIntArray> timeSteps;
+      timeSteps->SetName("TimeStep");
+      timeSteps->SetNumberOfTuples(numTuples);
+      timeSteps->FillValue(this->TimeStep);
+      arrays.emplace_back(timeSteps);
+    }
+    if (!vtkMath::IsNan(this->Time))
+    {
+      vtkNew<vtkDoubleArray> times;
+      times->SetName("Time");
+      times->SetNumberOfTuples(numTuples);
+      times->FillValue(this->Time);
+      arrays.emplace_back(times);
+    }
+    for (const auto& cinfo : this->ColumnInfo)
+    {
+      auto array = dsa->GetAbstractArray(cinfo.first.c_str());
+      if (array && (vtkDataArray::SafeDownCast(array) || vtkStringArray::SafeDownCast(array)) &&
+        array->GetNumberOfComponents() == cinfo.second)
+      {
+        arrays.emplace_back(array);
+      }
+    }
+
+    if (!this->HasSidecarColumns)
+    {
+      for (const auto& array : arrays)
+      {
+        this->SidecarColumns.push_back(SidecarColumn{ array->GetName(),
+          CSVFile::GetSidecarType(array), array->GetNumberOfComponents() });
+      }
+      this->HasSidecarColumns = true;
+    }
+
+    std::vector<vtkSmartPointer<vtkAbstractArray>> columns;
+    for (const auto& column : this->SidecarColumns)
+    {
+      auto iter = std::find_if(arrays.begin(), arrays.end(),
+        [&](const vtkSmartPointer<vtkAbstractArray>& array)
+        { return column.Name == array->GetName(); });
+      vtkAbstractArray* array = iter != arrays.end() ? iter->GetPointer() : nullptr;
+      if (array && CSVFile::GetSidecarType(array) == column.DataType &&
+        array->GetNumberOfComponents() == column.NumberOfComponents &&
+        array->GetNumberOfTuples() == numTuples)
+      {
+        columns.emplace_back(array);
+      }
+      else
+      {
+        vtkWarningWithObjectMacro(
+          self, "Column padded in columnar sidecar, missing or mismatched: " << column.Name);
+        columns.emplace_back(CSVFile::NewPaddedColumn(column, array, numTuples));
+      }
+    }
+    for (const auto& array : arrays)
+    {
+      if (std::none_of(this->SidecarColumns.begin(), this->SidecarColumns.end(),
+            [&](const SidecarColumn& column) { return column.Name == array->GetName(); }))
+      {
+        vtkWarningWithObjectMacro(
+          self, "Column skipped in columnar sidecar, not in the first chunk: " << array->GetName());
+      }
+    }
+
+    vtkColumnarTableUtilities::ChunkHeader header;
+    header.NumberOfRows = static_cast<vtkTypeUInt64>(numTuples);
+    header.NumberOfColumns = static_cast<vtkTypeUInt32>(columns.size());
+    header.Reserved = 0;
+    this->WriteSidecar(&header, sizeof(header));
+    for (const auto& column : columns)
+    {
+      this->WriteSidecarColumn(column, numTuples);
+    }
+  }
+
+  void WriteSidecarColumn(vtkAbstractArray* array, vtkIdType numTuples)
+  {
+    namespace format = vtkColumnarTableUtilities;
+    const vtkIdType numValues = numTuples * array->GetNumberOfComponents();
+    const std::string name = array->GetName() ? array->GetName() : "";
+
+    format::ColumnHeader header;
+    header.NumberOfComponents = array->GetNumberOfComponents();
+    header.NameLength = static_cast<vtkTypeUInt32>(name.size());
+    header.Reserved = 0;
+
+    std::vector<vtkTypeUInt64> offsets;
+    std::string characters;
+    vtkSmartPointer<vtkDataArray> values;
+    if (auto strings = vtkStringArray::SafeDownCast(array))
+    {
+      offsets.reserve(numValues + 1);
+      offsets.push_back(0);
+      for (vtkIdType cc = 0; cc < numValues; ++cc)
+      {
+        characters += strings->GetValue(cc);
+        offsets.push_back(characters.size());
+      }
+      header.DataType = VTK_STRING;
+      header.DataSize = offsets.size() * sizeof(vtkTypeUInt64) + characters.size();
+    }
+    else
+    {
+      // values are written as stored in memory, which needs a contiguous copy
+      // of bit arrays and of arrays with another memory layout.
+      values = vtkDataArray::SafeDownCast(array);
+      if (values->GetDataType() == VTK_BIT || !values->HasStandardMemoryLayout())
+      {
+        values.TakeReference(
+          vtkDataArray::CreateDataArray(format::GetStorageType(array->GetDataType())));
+        values->DeepCopy(array);
+      }
+      header.DataType = format::GetStorageType(values->GetDataType());
+      header.DataSize = static_cast<vtkTypeUInt64>(numValues) * values->GetDataTypeSize();
+    }
+
+    this->WriteSidecar(&header, sizeof(header));
+    this->WriteSidecar(name.c_str(), name.size());
+    this->WriteSidecarPadding();
+    if (values)
+    {
+      if (numValues > 0)
+      {
+        this->WriteSidecar(values->GetVoidPointer(0), header.DataSize);
+      }
+    }
+    else
+    {
+      this->WriteSidecar(offsets.data(), offsets.size() * sizeof(vtkTypeUInt64));
+      this->WriteSidecar(characters.c_str(), characters.size());
+    }
+    this->WriteSidecarPadding();
+  }
+
   CSVFile(const CSVFile&) = delete;
   void operator=(const CSVFile&) = delete;
 };
 
+//-----------------------------------------------------------------------------
+std::string vtkCSVWriter::GetColumnarSidecarFileName(const std::string& fileName)
+{
+  return vtkColumnarTableUtilities::GetSidecarFileName(fileName);
+}
+
 //-----------------------------------------------------------------------------
 std::string vtkCSVWriter::GetString(std::string string)
 {
@@ -660,7 +958,7 @@ void vtkCSVWriter::WriteData()
       this->WriteAllTimeSteps && !this->WriteAllTimeStepsSeparately && this->CurrentTimeIndex > 0
       ? CSVFile::OpenMode::Append
       : CSVFile::OpenMode::Write;
-    int error_code = file.Open(filename.str().c_str(), openMode);
+    int error_code = file.Open(filename.str().c_str(), openMode, this->WriteColumnarSidecar);
     if (error_code == vtkErrorCode::NoError)
     {
       file.WriteHeader(table, this, openMode);
@@ -714,7 +1012,7 @@ void vtkCSVWriter::WriteData()
       this->WriteAllTimeSteps && !this->WriteAllTimeStepsSeparately && this->CurrentTimeIndex > 0
       ? CSVFile::OpenMode::Append
       : CSVFile::OpenMode::Write;
-    int error_code = file.Open(filename.str().c_str(), openMode);
+    int error_code = file.Open(filename.str().c_str(), openMode, this->WriteColumnarSidecar);
     controller->Broadcast(&error_code, 1, 0);
     if (error_code != vtkErrorCode::NoError)
     {
@@ -810,6 +1108,7 @@ void vtkCSVWriter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "AddMetaData: " << (this->AddMetaData ? "Yes" : "No") << endl;
   os << indent << "AddTimeStep: " << (this->AddTimeStep ? "Yes" : "No") << endl;
   os << indent << "AddTime: " << (this->AddTime ? "Yes" : "No") << endl;
+  os << indent << "WriteColumnarSidecar: " << (this->WriteColumnarSidecar ? "Yes" : "No") << endl;
   os << indent << "NumberOfTimeSteps: " << this->NumberOfTimeSteps << endl;
   os << indent << "CurrentTimeIndex: " << this->CurrentTimeIndex << endl;
   os << indent << "TimeValues " << (this->TimeValues ? this->TimeValues->GetName() : "(none)")
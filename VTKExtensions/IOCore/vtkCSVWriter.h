@@ -169,6 +169,27 @@ public:
   vtkBooleanMacro(AddTimeStep, bool);
   ///@}
 
+  ///@{
+  /**
+   * When set to true (default is false), the written rows are also saved in a
+   * binary columnar file next to the CSV file, named by
+   * `GetColumnarSidecarFileName`. vtkColumnarTableReader reads that file
+   * without parsing any text. Appended time steps and the pieces gathered from
+   * other ranks are written as separate chunks of the same file. All the
+   * chunks have the columns of the first one: missing or mismatched columns
+   * are padded with empty strings, NaN or 0, and new columns are skipped.
+   */
+  vtkSetMacro(WriteColumnarSidecar, bool);
+  vtkGetMacro(WriteColumnarSidecar, bool);
+  vtkBooleanMacro(WriteColumnarSidecar, bool);
+  ///@}
+
+  /**
+   * Returns the name of the binary columnar file written next to the CSV file
+   * `fileName` when WriteColumnarSidecar is on.
+   */
+  static std::string GetColumnarSidecarFileName(const std::string& fileName);
+
   ///@{
   /**
    * Internal method: decorates the "string" with the "StringDelimiter" if
@@ -211,6 +232,7 @@ protected:
   bool AddMetaData;
   bool AddTimeStep;
   bool AddTime;
+  bool WriteColumnarSidecar;
 
   vtkMultiProcessController* Controller;
 
@@ -0,0 +1,481 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkColumnarTableReader.h"
+
+#include "vtkByteSwap.h"
+#include "vtkColumnarTableUtilities.h"
+#include "vtkDataArray.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkStringArray.h"
+#include "vtkTable.h"
+
+#include "vtksys/FStream.hxx"
+#include "vtksys/SystemTools.hxx"
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace
+{
+namespace format = vtkColumnarTableUtilities;
+
+//----------------------------------------------------------------------------
+// The content of a file, memory mapped when possible and read otherwise.
+// Mappings are private and writable so that arrays referencing them can be
+// modified downstream: modified pages are copied.
+class vtkColumnarTableBuffer
+{
+public:
+  static std::shared_ptr<vtkColumnarTableBuffer> Load(const std::string& filename)
+  {
+    const auto size = static_cast<size_t>(vtksys::SystemTools::FileLength(filename));
+    if (size == 0)
+    {
+      return nullptr;
+    }
+#if !defined(_WIN32)
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd >= 0)
+    {
+      void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+      close(fd);
+      if (data != MAP_FAILED)
+      {
+        return std::shared_ptr<vtkColumnarTableBuffer>(
+          new vtkColumnarTableBuffer(static_cast<char*>(data), size, true));
+      }
+    }
+#endif
+    vtksys::ifstream file(filename.c_str(), ios::in | ios::binary);
+    std::unique_ptr<char[]> data(new char[size]);
+    if (!file.read(data.get(), size))
+    {
+      return nullptr;
+    }
+    return std::shared_ptr<vtkColumnarTableBuffer>(
+      new vtkColumnarTableBuffer(data.release(), size, false));
+  }
+
+  ~vtkColumnarTableBuffer()
+  {
+#if !defined(_WIN32)
+    if (this->Mapped)
+    {
+      munmap(this->Data, this->Size);
+      return;
+    }
+#endif
+    delete[] this->Data;
+  }
+
+  // Returns the address of `count` bytes at `position`, or nullptr if they
+  // are out of the file.
+  char* GetData(vtkTypeUInt64 position, vtkTypeUInt64 count) const
+  {
+    if (position > this->Size || count > this->Size - position)
+    {
+      return nullptr;
+    }
+    return this->Data + position;
+  }
+
+private:
+  vtkColumnarTableBuffer(char* data, size_t size, bool mapped)
+    : Data(data)
+    , Size(size)
+    , Mapped(mapped)
+  {
+  }
+  vtkColumnarTableBuffer(const vtkColumnarTableBuffer&) = delete;
+  void operator=(const vtkColumnarTableBuffer&) = delete;
+
+  char* Data;
+  size_t Size;
+  bool Mapped;
+};
+
+//----------------------------------------------------------------------------
+// Buffers referenced by data arrays, keyed by the first value of the arrays.
+// A buffer is released with the last array referencing it. This is
+// intentionally leaked so that arrays outliving static destruction are safe.
+struct ReferencedBuffersType
+{
+  std::mutex Mutex;
+  std::multimap<void*, std::shared_ptr<vtkColumnarTableBuffer>> Buffers;
+};
+
+ReferencedBuffersType& ReferencedBuffers()
+{
+  static ReferencedBuffersType* buffers = new ReferencedBuffersType;
+  return *buffers;
+}
+
+void ReferenceBuffer(void* data, const std::shared_ptr<vtkColumnarTableBuffer>& buffer)
+{
+  auto& buffers = ReferencedBuffers();
+  std::lock_guard<std::mutex> lock(buffers.Mutex);
+  buffers.Buffers.emplace(data, buffer);
+}
+
+void ReleaseBuffer(void* data)
+{
+  std::shared_ptr<vtkColumnarTableBuffer> buffer;
+  auto& buffers = ReferencedBuffers();
+  std::lock_guard<std::mutex> lock(buffers.Mutex);
+  auto iter = buffers.Buffers.find(data);
+  if (iter != buffers.Buffers.end())
+  {
+    // release once the lock is released.
+    buffer = std::move(iter->second);
+    buffers.Buffers.erase(iter);
+  }
+}
+
+//----------------------------------------------------------------------------
+struct ColumnRecord
+{
+  std::string Name;
+  int DataType;
+  int NumberOfComponents;
+  char* Data;
+  vtkTypeUInt64 DataSize;
+};
+
+struct ChunkRecord
+{
+  vtkTypeUInt64 NumberOfRows;
+  std::vector<ColumnRecord> Columns;
+};
+
+template <typename T>
+void Swap(T& value)
+{
+  vtkByteSwap::SwapVoidRange(&value, 1, sizeof(T));
+}
+
+// Copies the record at `position` and moves `position` past it.
+template <typename T>
+bool ReadRecord(const vtkColumnarTableBuffer& buffer, vtkTypeUInt64& position, T& record)
+{
+  const char* data = buffer.GetData(position, sizeof(T));
+  if (!data)
+  {
+    return false;
+  }
+  memcpy(&record, data, sizeof(T));
+  position += sizeof(T);
+  return true;
+}
+
+// Checks the offsets of a string column, in place.
+bool CheckStringColumn(ColumnRecord& column, vtkTypeUInt64 numberOfValues, bool swap)
+{
+  const vtkTypeUInt64 offsetsSize = (numberOfValues + 1) * sizeof(vtkTypeUInt64);
+  if (column.DataSize < offsetsSize)
+  {
+    return false;
+  }
+  auto offsets = reinterpret_cast<vtkTypeUInt64*>(column.Data);
+  if (swap)
+  {
+    vtkByteSwap::SwapVoidRange(offsets, numberOfValues + 1, sizeof(vtkTypeUInt64));
+  }
+  for (vtkTypeUInt64 cc = 0; cc < numberOfValues; ++cc)
+  {
+    if (offsets[cc] > offsets[cc + 1])
+    {
+      return false;
+    }
+  }
+  return offsets[0] == 0 && offsets[numberOfValues] <= column.DataSize - offsetsSize;
+}
+
+bool ParseChunk(const vtkColumnarTableBuffer& buffer, vtkTypeUInt64& position, bool swap,
+  ChunkRecord& chunk)
+{
+  format::ChunkHeader header;
+  if (!ReadRecord(buffer, position, header))
+  {
+    return false;
+  }
+  if (swap)
+  {
+    Swap(header.NumberOfRows);
+    Swap(header.NumberOfColumns);
+  }
+  if (!buffer.GetData(position, header.NumberOfColumns * sizeof(format::ColumnHeader)))
+  {
+    return false;
+  }
+  chunk.NumberOfRows = header.NumberOfRows;
+  chunk.Columns.resize(header.NumberOfColumns);
+  for (auto& column : chunk.Columns)
+  {
+    format::ColumnHeader columnHeader;
+    if (!ReadRecord(buffer, position, columnHeader))
+    {
+      return false;
+    }
+    if (swap)
+    {
+      Swap(columnHeader.DataType);
+      Swap(columnHeader.NumberOfComponents);
+      Swap(columnHeader.NameLength);
+      Swap(columnHeader.DataSize);
+    }
+    const char* name = buffer.GetData(position, columnHeader.NameLength);
+    if (!name || columnHeader.NumberOfComponents <= 0)
+    {
+      return false;
+    }
+    column.Name.assign(name, columnHeader.NameLength);
+    column.DataType = columnHeader.DataType;
+    column.NumberOfComponents = columnHeader.NumberOfComponents;
+    column.DataSize = columnHeader.DataSize;
+    position += columnHeader.NameLength;
+    position += format::GetPadding(position);
+    column.Data = buffer.GetData(position, column.DataSize);
+    if (!column.Data)
+    {
+      return false;
+    }
+    position += column.DataSize;
+    position += format::GetPadding(position);
+
+    const vtkTypeUInt64 numberOfValues = chunk.NumberOfRows * column.NumberOfComponents;
+    if (column.DataType == VTK_STRING)
+    {
+      if (!CheckStringColumn(column, numberOfValues, swap))
+      {
+        return false;
+      }
+    }
+    else
+    {
+      vtkSmartPointer<vtkDataArray> array;
+      array.TakeReference(vtkDataArray::CreateDataArray(column.DataType));
+      if (!array || array->GetDataType() == VTK_BIT ||
+        column.DataSize != numberOfValues * array->GetDataTypeSize())
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Copies the values of `column` at `tuple` in `array`.
+void CopyColumn(const ColumnRecord& column, vtkTypeUInt64 numberOfRows, bool swap,
+  vtkAbstractArray* array, vtkIdType tuple)
+{
+  if (column.DataSize == 0)
+  {
+    return;
+  }
+  const vtkIdType numberOfValues =
+    static_cast<vtkIdType>(numberOfRows) * column.NumberOfComponents;
+  const vtkIdType first = tuple * column.NumberOfComponents;
+  if (auto strings = vtkStringArray::SafeDownCast(array))
+  {
+    auto offsets = reinterpret_cast<const vtkTypeUInt64*>(column.Data);
+    const char* characters = column.Data + (numberOfValues + 1) * sizeof(vtkTypeUInt64);
+    for (vtkIdType cc = 0; cc < numberOfValues; ++cc)
+    {
+      strings->SetValue(
+        first + cc, std::string(characters + offsets[cc], offsets[cc + 1] - offsets[cc]));
+    }
+    return;
+  }
+  auto values = static_cast<vtkDataArray*>(array);
+  void* target = values->GetVoidPointer(first);
+  memcpy(target, column.Data, column.DataSize);
+  if (swap)
+  {
+    vtkByteSwap::SwapVoidRange(target, numberOfValues, values->GetDataTypeSize());
+  }
+}
+}
+
+vtkStandardNewMacro(vtkColumnarTableReader);
+//----------------------------------------------------------------------------
+vtkColumnarTableReader::vtkColumnarTableReader()
+{
+  this->SetNumberOfInputPorts(0);
+}
+
+//----------------------------------------------------------------------------
+vtkColumnarTableReader::~vtkColumnarTableReader() = default;
+
+//----------------------------------------------------------------------------
+int vtkColumnarTableReader::CanReadFile(const char* filename)
+{
+  if (!filename)
+  {
+    return 0;
+  }
+  vtksys::ifstream file(filename, ios::in | ios::binary);
+  char magic[sizeof(format::MAGIC)];
+  return file.read(magic, sizeof(magic)) && memcmp(magic, format::MAGIC, sizeof(magic)) == 0
+    ? 1
+    : 0;
+}
+
+//----------------------------------------------------------------------------
+int vtkColumnarTableReader::RequestData(vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** vtkNotUsed(inputVector), vtkInformationVector* outputVector)
+{
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+  vtkTable* output = vtkTable::GetData(outInfo);
+  if (outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER()) > 0)
+  {
+    return 1;
+  }
+  if (this->FileName.empty())
+  {
+    vtkErrorMacro("FileName not set.");
+    return 0;
+  }
+
+  auto buffer = vtkColumnarTableBuffer::Load(this->FileName);
+  if (!buffer)
+  {
+    vtkErrorMacro("Could not read file: " << this->FileName);
+    return 0;
+  }
+
+  vtkTypeUInt64 position = 0;
+  format::FileHeader header;
+  if (!::ReadRecord(*buffer, position, header) ||
+    memcmp(header.Magic, format::MAGIC, sizeof(format::MAGIC)) != 0)
+  {
+    vtkErrorMacro("Not a columnar table file: " << this->FileName);
+    return 0;
+  }
+  const bool swap = header.ByteOrderMark == format::SWAPPED_BYTE_ORDER_MARK;
+  if (swap)
+  {
+    ::Swap(header.Version);
+  }
+  else if (header.ByteOrderMark != format::BYTE_ORDER_MARK)
+  {
+    vtkErrorMacro("Invalid byte order mark in " << this->FileName);
+    return 0;
+  }
+  if (header.Version > format::VERSION)
+  {
+    vtkErrorMacro("Unsupported version " << header.Version << " in " << this->FileName);
+    return 0;
+  }
+
+  // locate all the columns of all the chunks.
+  std::vector<::ChunkRecord> chunks;
+  vtkTypeUInt64 numberOfRows = 0;
+  while (buffer->GetData(position, 1))
+  {
+    chunks.emplace_back();
+    if (!::ParseChunk(*buffer, position, swap, chunks.back()))
+    {
+      vtkErrorMacro("Invalid chunk #" << chunks.size() - 1 << " in " << this->FileName);
+      return 0;
+    }
+    const auto& first = chunks.front().Columns;
+    const auto& current = chunks.back().Columns;
+    bool sameColumns = first.size() == current.size();
+    for (size_t cc = 0; sameColumns && cc < first.size(); ++cc)
+    {
+      sameColumns = first[cc].Name == current[cc].Name &&
+        first[cc].DataType == current[cc].DataType &&
+        first[cc].NumberOfComponents == current[cc].NumberOfComponents;
+    }
+    if (!sameColumns)
+    {
+      vtkErrorMacro("Chunk #" << chunks.size() - 1
+                              << " does not have the same columns as the first chunk in "
+                              << this->FileName);
+      return 0;
+    }
+    numberOfRows += chunks.back().NumberOfRows;
+  }
+  if (chunks.empty())
+  {
+    return 1;
+  }
+
+  const size_t numberOfColumns = chunks.front().Columns.size();
+  std::vector<vtkSmartPointer<vtkAbstractArray>> arrays(numberOfColumns);
+  std::vector<size_t> copiedColumns;
+  for (size_t cc = 0; cc < numberOfColumns; ++cc)
+  {
+    const auto& column = chunks.front().Columns[cc];
+    if (column.DataType == VTK_STRING)
+    {
+      arrays[cc] = vtkSmartPointer<vtkStringArray>::New();
+    }
+    else
+    {
+      arrays[cc].TakeReference(vtkDataArray::CreateDataArray(column.DataType));
+    }
+    arrays[cc]->SetName(column.Name.c_str());
+    arrays[cc]->SetNumberOfComponents(column.NumberOfComponents);
+    if (chunks.size() == 1 && !swap && column.DataType != VTK_STRING && column.DataSize > 0)
+    {
+      // reference the values in the buffer.
+      auto array = vtkDataArray::SafeDownCast(arrays[cc]);
+      const vtkIdType numberOfValues =
+        static_cast<vtkIdType>(numberOfRows) * column.NumberOfComponents;
+      array->SetVoidArray(
+        column.Data, numberOfValues, /*save=*/0, vtkAbstractArray::VTK_DATA_ARRAY_USER_DEFINED);
+      array->SetArrayFreeFunction(::ReleaseBuffer);
+      ::ReferenceBuffer(column.Data, buffer);
+    }
+    else
+    {
+      arrays[cc]->SetNumberOfTuples(static_cast<vtkIdType>(numberOfRows));
+      copiedColumns.push_back(cc);
+    }
+  }
+
+  // assemble the other columns from the chunks, one column per task.
+  vtkSMPTools::For(0, static_cast<vtkIdType>(copiedColumns.size()),
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      for (vtkIdType index = begin; index < end; ++index)
+      {
+        const size_t cc = copiedColumns[index];
+        vtkIdType tuple = 0;
+        for (const auto& chunk : chunks)
+        {
+          ::CopyColumn(chunk.Columns[cc], chunk.NumberOfRows, swap, arrays[cc], tuple);
+          tuple += static_cast<vtkIdType>(chunk.NumberOfRows);
+        }
+      }
+    });
+
+  for (const auto& array : arrays)
+  {
+    output->AddColumn(array);
+  }
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+void vtkColumnarTableReader::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "FileName: " << this->FileName << endl;
+}
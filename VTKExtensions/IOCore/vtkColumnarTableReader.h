@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkColumnarTableReader
+ * @brief   reads the binary columnar sidecar of CSV files written by vtkCSVWriter.
+ *
+ * vtkCSVWriter can write a binary columnar copy of the tables it writes next to
+ * the CSV file (see vtkCSVWriter::SetWriteColumnarSidecar). This reader reads
+ * such files into a vtkTable without parsing any text. Columns keep the type
+ * and number of components of the arrays that were written, instead of being
+ * split in one column per component as in the CSV file.
+ *
+ * The file is memory mapped when possible. When it was written in a single
+ * chunk, i.e. by a serial writer without appending time steps, and in the
+ * byte order of the reader, numeric columns reference the mapped values
+ * without copying them. The mapping is private so that modifying such
+ * columns downstream does not modify the file. Otherwise, the columns are
+ * assembled from the chunks concurrently.
+ *
+ * In parallel, the table is read on the first piece only and the other pieces
+ * produce empty tables.
+ *
+ * @sa vtkCSVWriter, vtkColumnarTableUtilities
+ */
+
+#ifndef vtkColumnarTableReader_h
+#define vtkColumnarTableReader_h
+
+#include "vtkPVVTKExtensionsIOCoreModule.h" // needed for exports
+#include "vtkTableAlgorithm.h"
+
+#include <string> // for std::string
+
+class VTKPVVTKEXTENSIONSIOCORE_EXPORT vtkColumnarTableReader : public vtkTableAlgorithm
+{
+public:
+  static vtkColumnarTableReader* New();
+  vtkTypeMacro(vtkColumnarTableReader, vtkTableAlgorithm);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Specify the name of the file to read.
+   */
+  vtkSetStdStringFromCharMacro(FileName);
+  vtkGetCharFromStdStringMacro(FileName);
+  ///@}
+
+  /**
+   * Returns 1 if `filename` starts with the signature of the format.
+   */
+  static int CanReadFile(const char* filename);
+
+protected:
+  vtkColumnarTableReader();
+  ~vtkColumnarTableReader() override;
+
+  int RequestData(vtkInformation* request, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override;
+
+private:
+  vtkColumnarTableReader(const vtkColumnarTableReader&) = delete;
+  void operator=(const vtkColumnarTableReader&) = delete;
+
+  std::string FileName;
+};
+
+#endif
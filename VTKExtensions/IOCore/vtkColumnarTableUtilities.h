@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+
+/**
+ * @class   vtkColumnarTableUtilities
+ * @brief   A namespace describing the columnar table file format
+ *
+ * A namespace providing the constants and record layouts of the binary
+ * columnar table format written by vtkCSVWriter next to its CSV files and
+ * read by vtkColumnarTableReader.
+ *
+ * A file starts with a FileHeader followed by any number of chunks. Each
+ * chunk holds rows appended by a single write: a ChunkHeader followed by
+ * `NumberOfColumns` columns. A column is a ColumnHeader, its name, padding up
+ * to the next multiple of ALIGNMENT bytes in the file, `DataSize` bytes of
+ * values and padding again. Values are stored in the byte order of the writer,
+ * tuple after tuple. String columns (VTK_STRING) store `NumberOfValues + 1`
+ * 64-bit offsets followed by the characters of all the values.
+ */
+
+#ifndef vtkColumnarTableUtilities_h
+#define vtkColumnarTableUtilities_h
+
+#include "vtkType.h"
+
+#include <string>
+
+namespace vtkColumnarTableUtilities
+{
+///@{
+/**
+ * Constants identifying the format.
+ */
+constexpr char MAGIC[8] = { 'v', 't', 'k', 'P', 'V', 'C', 'T', '\n' };
+constexpr vtkTypeUInt32 VERSION = 1;
+constexpr vtkTypeUInt32 BYTE_ORDER_MARK = 0x01020304;
+constexpr vtkTypeUInt32 SWAPPED_BYTE_ORDER_MARK = 0x04030201;
+constexpr vtkTypeUInt64 ALIGNMENT = 64;
+///@}
+
+/**
+ * Extension appended to the name of a CSV file to name its sidecar.
+ */
+const std::string SIDECAR_EXTENSION = ".pvct";
+
+///@{
+/**
+ * Records of the format.
+ */
+struct FileHeader
+{
+  char Magic[8];
+  vtkTypeUInt32 Version;
+  vtkTypeUInt32 ByteOrderMark;
+};
+
+struct ChunkHeader
+{
+  vtkTypeUInt64 NumberOfRows;
+  vtkTypeUInt32 NumberOfColumns;
+  vtkTypeUInt32 Reserved;
+};
+
+struct ColumnHeader
+{
+  vtkTypeInt32 DataType;
+  vtkTypeInt32 NumberOfComponents;
+  vtkTypeUInt32 NameLength;
+  vtkTypeUInt32 Reserved;
+  vtkTypeUInt64 DataSize;
+};
+///@}
+
+/**
+ * Returns the name of the sidecar of the CSV file `fileName`.
+ */
+inline std::string GetSidecarFileName(const std::string& fileName)
+{
+  return fileName + SIDECAR_EXTENSION;
+}
+
+/**
+ * Returns the number of padding bytes needed after `position`.
+ */
+inline vtkTypeUInt64 GetPadding(vtkTypeUInt64 position)
+{
+  return (ALIGNMENT - position % ALIGNMENT) % ALIGNMENT;
+}
+
+/**
+ * Returns the type used to store values of `type`. Types whose size depends on
+ * the platform or the build are stored using the fixed size type of the same
+ * size, and bits are stored as unsigned chars.
+ */
+inline int GetStorageType(int type)
+{
+  switch (type)
+  {
+    case VTK_BIT:
+      return VTK_UNSIGNED_CHAR;
+    case VTK_ID_TYPE:
+      return VTK_SIZEOF_ID_TYPE == 8 ? VTK_TYPE_INT64 : VTK_TYPE_INT32;
+    case VTK_LONG:
+      return VTK_SIZEOF_LONG == 8 ? VTK_TYPE_INT64 : VTK_TYPE_INT32;
+    case VTK_UNSIGNED_LONG:
+      return VTK_SIZEOF_LONG == 8 ? VTK_TYPE_UINT64 : VTK_TYPE_UINT32;
+    default:
+      return type;
+  }
+}
+}
+
+#endif
@@ -12,6 +12,7 @@
 #include "vtkMultiBlockDataSet.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkPVLogger.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkXMLDataElement.h"
@@ -36,8 +37,10 @@
 #include <vtksys/SystemTools.hxx>
 
 #include <algorithm>
+#include <atomic>
 #include <map>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace
@@ -136,7 +139,9 @@ vtkXMLCollectionReader::vtkXMLCollectionReader()
   this->Internal = new vtkXMLCollectionReaderInternals;
   this->InternalForceMultiBlock = false;
   this->ForceOutputTypeToMultiBlock = 0;
+  this->NumberOfReadThreads = 1;
   this->CurrentOutput = -1;
+  this->ReadingConcurrently = false;
 }
 
 //----------------------------------------------------------------------------
@@ -149,6 +154,8 @@ vtkXMLCollectionReader::~vtkXMLCollectionReader()
 void vtkXMLCollectionReader::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "ForceOutputTypeToMultiBlock: " << this->ForceOutputTypeToMultiBlock << endl;
+  os << indent << "NumberOfReadThreads: " << this->NumberOfReadThreads << endl;
 }
 
 //----------------------------------------------------------------------------
@@ -537,6 +544,35 @@ void vtkXMLCollectionReader::ReadXMLDataImpl()
     vtkMultiBlockDataSet* output = vtkMultiBlockDataSet::GetData(outInfo);
 
     unsigned int nBlocks = static_cast<unsigned int>(this->Internal->Readers.size());
+
+    // Readers are setup on this thread, only reading the files may happen
+    // concurrently.
+    std::vector<vtkSmartPointer<vtkDataObject>> actualOutputs(nBlocks);
+    for (unsigned int i = 0; i < nBlocks; ++i)
+    {
+      actualOutputs[i].TakeReference(this->SetupOutput(filePath, i));
+    }
+
+    int numThreads = this->NumberOfReadThreads;
+    if (numThreads == 0)
+    {
+      numThreads = static_cast<int>(std::thread::hardware_concurrency());
+    }
+    numThreads = std::min(numThreads, static_cast<int>(nBlocks));
+    if (numThreads > 1)
+    {
+      this->ReadFilesConcurrently(
+        numThreads, updatePiece, updateNumPieces, updateGhostLevels, actualOutputs);
+    }
+    else
+    {
+      for (unsigned int i = 0; i < nBlocks; ++i)
+      {
+        this->CurrentOutput = i;
+        this->ReadAFile(i, updatePiece, updateNumPieces, updateGhostLevels, actualOutputs[i]);
+      }
+    }
+
     output->SetNumberOfBlocks(nBlocks);
     for (unsigned int i = 0; i < nBlocks; ++i)
     {
@@ -548,11 +584,8 @@ void vtkXMLCollectionReader::ReadXMLDataImpl()
         block->Delete();
       }
 
-      this->CurrentOutput = i;
-      vtkDataObject* actualOutput = this->SetupOutput(filePath, i);
-      this->ReadAFile(i, updatePiece, updateNumPieces, updateGhostLevels, actualOutput);
       block->SetNumberOfBlocks(updateNumPieces);
-      block->SetBlock(updatePiece, actualOutput);
+      block->SetBlock(updatePiece, actualOutputs[i]);
 
       // Set the block name from the DataSet name attribute, if any
       vtkXMLDataElement* ds = this->Internal->RestrictedDataSets[i];
@@ -561,10 +594,57 @@ void vtkXMLCollectionReader::ReadXMLDataImpl()
       {
         output->GetMetaData(i)->Set(vtkCompositeDataSet::NAME(), name);
       }
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkXMLCollectionReader::ReadFilesConcurrently(int numThreads, int updatePiece,
+  int updateNumPieces, int updateGhostLevels,
+  const std::vector<vtkSmartPointer<vtkDataObject>>& outputs)
+{
+  const unsigned int nBlocks = static_cast<unsigned int>(outputs.size());
+  vtkVLogScopeF(PARAVIEW_LOG_EXECUTION_VERBOSITY(), "read %u files using %d threads", nBlocks,
+    numThreads);
 
-      actualOutput->Delete();
+  // Progress events are only fired from this thread, as files complete, since
+  // observers are not expected to be thread-safe.
+  const std::thread::id mainThread = std::this_thread::get_id();
+  const float width = this->ProgressRange[1] - this->ProgressRange[0];
+  std::atomic<unsigned int> nextIndex(0);
+  std::atomic<unsigned int> numRead(0);
+  auto worker = [&]() {
+    for (unsigned int i = nextIndex++; i < nBlocks && !this->AbortExecute; i = nextIndex++)
+    {
+      {
+        vtkXMLDataElement* ds = this->Internal->RestrictedDataSets[i];
+        vtkVLogScopeF(PARAVIEW_LOG_EXECUTION_VERBOSITY(), "read '%s'", ds->GetAttribute("file"));
+        this->ReadAFile(i, updatePiece, updateNumPieces, updateGhostLevels, outputs[i]);
+      }
+      ++numRead;
+      if (std::this_thread::get_id() == mainThread)
+      {
+        this->UpdateProgressDiscrete(this->ProgressRange[0] + width * numRead / nBlocks);
+      }
     }
+  };
+
+  this->ReadingConcurrently = true;
+  std::vector<std::thread> threads;
+  threads.reserve(numThreads - 1);
+  for (int cc = 1; cc < numThreads; ++cc)
+  {
+    threads.emplace_back([&worker, cc]() {
+      vtkLogger::SetThreadName("read thread " + std::to_string(cc));
+      worker();
+    });
   }
+  worker();
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  this->ReadingConcurrently = false;
 }
 
 //----------------------------------------------------------------------------
@@ -575,9 +655,12 @@ void vtkXMLCollectionReader::ReadAFile(int index, int updatePiece, int updateNum
   vtkXMLReader* r = this->Internal->Readers[index].GetPointer();
   if (r)
   {
-    // Observe the progress of the internal reader.
-    const auto oid = r->AddObserver(
-      vtkCommand::ProgressEvent, this, &vtkXMLCollectionReader::InternalProgressCallback);
+    // Observe the progress of the internal reader, unless other files are
+    // being read by other threads at the same time.
+    const auto oid = this->ReadingConcurrently
+      ? 0
+      : r->AddObserver(
+          vtkCommand::ProgressEvent, this, &vtkXMLCollectionReader::InternalProgressCallback);
 
     // Propagate array selections to the reader.
     vtkPropagateSelection(r->GetPointDataArraySelection(), this->PointDataArraySelection);
@@ -591,7 +674,10 @@ void vtkXMLCollectionReader::ReadAFile(int index, int updatePiece, int updateNum
 
     // The internal reader is finished.  Remove the observer in case
     // we delete the reader later.
-    r->RemoveObserver(oid);
+    if (oid != 0)
+    {
+      r->RemoveObserver(oid);
+    }
 
     // Share the new data with our output.
     actualOutput->ShallowCopy(r->GetOutputDataObject(0));
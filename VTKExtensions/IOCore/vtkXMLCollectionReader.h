@@ -18,8 +18,11 @@
 #define vtkXMLCollectionReader_h
 
 #include "vtkPVVTKExtensionsIOCoreModule.h" //needed for exports
+#include "vtkSmartPointer.h"                 // for vtkSmartPointer
 #include "vtkXMLReader.h"
 
+#include <vector> // for std::vector
+
 class vtkXMLCollectionReaderInternals;
 
 class VTKPVVTKEXTENSIONSIOCORE_EXPORT vtkXMLCollectionReader : public vtkXMLReader
@@ -114,6 +117,18 @@ public:
   vtkBooleanMacro(ForceOutputTypeToMultiBlock, int);
   ///@}
 
+  ///@{
+  /**
+   * Get/Set the number of data sets read concurrently, using a pool of
+   * threads, when the output is a multiblock dataset. Having several reads in
+   * flight helps saturate the bandwidth of parallel file systems. 0 means as
+   * many threads as the hardware supports. Default is 1, i.e. the data sets
+   * are read one after another.
+   */
+  vtkSetClampMacro(NumberOfReadThreads, int, 0, VTK_INT_MAX);
+  vtkGetMacro(NumberOfReadThreads, int);
+  ///@}
+
 protected:
   vtkXMLCollectionReader();
   ~vtkXMLCollectionReader() override;
@@ -122,6 +137,7 @@ protected:
 
   bool InternalForceMultiBlock;
   int ForceOutputTypeToMultiBlock;
+  int NumberOfReadThreads;
 
   // Get the name of the data set being read.
   const char* GetDataSetName() override;
@@ -174,7 +190,14 @@ private:
   vtkXMLCollectionReader(const vtkXMLCollectionReader&) = delete;
   void operator=(const vtkXMLCollectionReader&) = delete;
 
+  /**
+   * Calls ReadAFile() for all `outputs`, using up to `numThreads` threads.
+   */
+  void ReadFilesConcurrently(int numThreads, int updatePiece, int updateNumPieces,
+    int updateGhostLevels, const std::vector<vtkSmartPointer<vtkDataObject>>& outputs);
+
   int CurrentOutput;
+  bool ReadingConcurrently;
 };
 
 #endif
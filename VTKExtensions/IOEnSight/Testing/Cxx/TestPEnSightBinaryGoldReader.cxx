@@ -1,17 +1,49 @@
 // SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkCellTypes.h"
+#include "vtkDataArray.h"
+#include "vtkMPIController.h"
 #include "vtkMultiBlockDataSet.h"
 #include "vtkNew.h"
 #include "vtkPGenericEnSightReader.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkSOADataArrayTemplate.h"
 #include "vtkTestUtilities.h"
 #include "vtkUnstructuredGrid.h"
 
-int TestPEnSightBinaryGoldReader(int argc, char* argv[])
+namespace
 {
-  char* fname =
-    vtkTestUtilities::ExpandDataFileName(argc, argv, "Testing/Data/EnSight/TEST_bin.case");
+bool SameArrays(vtkDataArray* expected, vtkDataArray* actual)
+{
+  if (!expected || !actual ||
+    expected->GetNumberOfComponents() != actual->GetNumberOfComponents() ||
+    expected->GetNumberOfTuples() != actual->GetNumberOfTuples())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < expected->GetNumberOfTuples(); i++)
+  {
+    for (int comp = 0; comp < expected->GetNumberOfComponents(); comp++)
+    {
+      if (expected->GetComponent(i, comp) != actual->GetComponent(i, comp))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
 
+// Arrays wrapping the memory mapped file are SOA arrays, the copied ones are
+// not.
+bool IsMapped(vtkDataArray* array)
+{
+  return vtkSOADataArrayTemplate<float>::SafeDownCast(array) != nullptr;
+}
+
+int TestReader(const char* fname, bool& mapped)
+{
   vtkNew<vtkPGenericEnSightReader> reader;
   reader->SetCaseFileName(fname);
   reader->Update();
@@ -44,5 +76,74 @@ int TestPEnSightBinaryGoldReader(int argc, char* argv[])
     }
   }
 
+  // memory mapped files must give the same results.
+  vtkNew<vtkPGenericEnSightReader> mappedReader;
+  mappedReader->SetCaseFileName(fname);
+  mappedReader->UseMemoryMappingOn();
+  mappedReader->Update();
+  vtkUnstructuredGrid* mappedUG =
+    vtkUnstructuredGrid::SafeDownCast(mappedReader->GetOutput()->GetBlock(0));
+  if (!mappedUG || mappedUG->GetNumberOfCells() != ug->GetNumberOfCells() ||
+    !SameArrays(ug->GetPoints()->GetData(), mappedUG->GetPoints()->GetData()))
+  {
+    std::cerr << "Memory mapped reading gives different points or cells." << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (IsMapped(ug->GetPoints()->GetData()))
+  {
+    std::cerr << "Points are mapped without memory mapping." << std::endl;
+    return EXIT_FAILURE;
+  }
+  mapped = IsMapped(mappedUG->GetPoints()->GetData());
+  for (int i = 0; i < ug->GetPointData()->GetNumberOfArrays(); i++)
+  {
+    vtkDataArray* array = ug->GetPointData()->GetArray(i);
+    vtkDataArray* mappedArray =
+      array ? mappedUG->GetPointData()->GetArray(array->GetName()) : nullptr;
+    if (array && !SameArrays(array, mappedArray))
+    {
+      std::cerr << "Memory mapped reading gives a different " << array->GetName() << " array."
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+    mapped = mapped || IsMapped(mappedArray);
+  }
+
   return EXIT_SUCCESS;
 }
+}
+
+int TestPEnSightBinaryGoldReader(int argc, char* argv[])
+{
+  vtkMPIController* contr = vtkMPIController::New();
+  contr->Initialize(&argc, &argv);
+  vtkMultiProcessController::SetGlobalController(contr);
+
+  char* fname =
+    vtkTestUtilities::ExpandDataFileName(argc, argv, "Testing/Data/EnSight/TEST_bin.case");
+  bool mapped = false;
+  int success = TestReader(fname, mapped) == EXIT_SUCCESS ? 1 : 0;
+  delete[] fname;
+
+  int allSuccess = 0;
+  contr->AllReduce(&success, &allSuccess, 1, vtkCommunicator::LOGICAL_AND_OP);
+
+  // the parallel reader is only used with several processes, it must then
+  // wrap the memory mapped file on at least one rank.
+  int localMapped = mapped ? 1 : 0;
+  int anyMapped = 0;
+  contr->AllReduce(&localMapped, &anyMapped, 1, vtkCommunicator::LOGICAL_OR_OP);
+  if (contr->GetNumberOfProcesses() > 1 && !anyMapped)
+  {
+    if (contr->GetLocalProcessId() == 0)
+    {
+      std::cerr << "No rank read arrays from the memory mapped file." << std::endl;
+    }
+    allSuccess = 0;
+  }
+
+  vtkMultiProcessController::SetGlobalController(nullptr);
+  contr->Finalize();
+  contr->Delete();
+  return allSuccess ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,161 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkLogger.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPGenericEnSightReader.h"
+#include "vtkTestUtilities.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <vtksys/FStream.hxx>
+#include <vtksys/SystemTools.hxx>
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#define VERIFY(x, ...)                                                                             \
+  if (!(x))                                                                                        \
+  {                                                                                                \
+    vtkLogF(ERROR, __VA_ARGS__);                                                                   \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+namespace
+{
+const int NumberOfSteps = 3;
+
+// Writes a transient single file geometry, one triangle per time step, whose
+// first point is at x = `origin` + step. `padding[step]` is appended to the
+// description of each step to move the time steps around in the file.
+void WriteGeometry(const std::string& fname, double origin, const std::vector<int>& padding)
+{
+  vtksys::ofstream file(fname.c_str(), std::ios::out | std::ios::binary);
+  char value[32];
+  for (int step = 0; step < NumberOfSteps; ++step)
+  {
+    file << "BEGIN TIME STEP\n"
+         << "step " << step << std::string(padding[step], '.') << "\n"
+         << "triangle\n"
+         << "node id off\n"
+         << "element id off\n"
+         << "part\n"
+         << "         1\n"
+         << "triangle\n"
+         << "coordinates\n"
+         << "         3\n";
+    const double coords[9] = { origin + step, 1, 0, 0, 0, 1, 0, 0, 0 };
+    for (double coord : coords)
+    {
+      snprintf(value, sizeof(value), "%12.5e\n", coord);
+      file << value;
+    }
+    file << "tria3\n"
+         << "         1\n"
+         << "         1         2         3\n"
+         << "END TIME STEP\n";
+  }
+}
+
+void WriteCase(const std::string& fname)
+{
+  vtksys::ofstream file(fname.c_str());
+  file << "FORMAT\n"
+       << "type: ensight gold\n"
+       << "GEOMETRY\n"
+       << "model: 1 1 steps.geo\n"
+       << "TIME\n"
+       << "time set: 1\n"
+       << "number of steps: " << NumberOfSteps << "\n"
+       << "time values:\n";
+  for (int step = 0; step < NumberOfSteps; ++step)
+  {
+    file << step << "\n";
+  }
+  file << "FILE\n"
+       << "file set: 1\n"
+       << "number of steps: " << NumberOfSteps << "\n";
+}
+
+// Reads the last time step and returns the x coordinate of its first point.
+double ReadLastStep(const std::string& caseName)
+{
+  vtkNew<vtkPGenericEnSightReader> reader;
+  reader->SetCaseFileName(caseName.c_str());
+  reader->UseTimeStepIndexFilesOn();
+  reader->UpdateTimeStep(NumberOfSteps - 1);
+  auto ug = vtkUnstructuredGrid::SafeDownCast(reader->GetOutput()->GetBlock(0));
+  return ug && ug->GetNumberOfPoints() == 3 ? ug->GetPoint(0)[0] : -1.0;
+}
+
+// Returns the lines of the index file.
+std::vector<std::string> ReadIndex(const std::string& fname)
+{
+  std::vector<std::string> lines;
+  vtksys::ifstream file(fname.c_str());
+  std::string line;
+  while (std::getline(file, line))
+  {
+    lines.push_back(line);
+  }
+  return lines;
+}
+
+void WriteIndex(const std::string& fname, const std::vector<std::string>& lines)
+{
+  vtksys::ofstream file(fname.c_str());
+  for (const auto& line : lines)
+  {
+    file << line << "\n";
+  }
+}
+}
+
+int TestPEnSightTimeStepIndex(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  const std::string directory = std::string(tempDir) + "/TestPEnSightTimeStepIndex";
+  delete[] tempDir;
+  vtksys::SystemTools::RemoveADirectory(directory);
+  vtksys::SystemTools::MakeDirectory(directory);
+
+  const std::string caseName = directory + "/steps.case";
+  const std::string geoName = directory + "/steps.geo";
+  const std::string indexName = geoName + ".stepindex";
+  WriteCase(caseName);
+  WriteGeometry(geoName, 0.0, { 0, 0, 20 });
+
+  // cold read: the file is scanned and the offsets of steps 1 and 2 are saved.
+  VERIFY(!vtksys::SystemTools::FileExists(indexName), "Unexpected index file.");
+  VERIFY(ReadLastStep(caseName) == 2.0, "Cold read gives the wrong time step.");
+  std::vector<std::string> index = ReadIndex(indexName);
+  VERIFY(index.size() == 2 + NumberOfSteps - 1, "Expected %d indexed steps, got %d.",
+    NumberOfSteps - 1, static_cast<int>(index.size()) - 2);
+
+  // read with the index: keep only the last step so that reading it without
+  // the index would scan step 1 again and save it back.
+  index.erase(index.begin() + 2);
+  WriteIndex(indexName, index);
+  VERIFY(ReadLastStep(caseName) == 2.0, "Indexed read gives the wrong time step.");
+  VERIFY(ReadIndex(indexName) == index, "The index was not used.");
+
+  // rewrite the data file with the same size and modification time but with
+  // steps 1 and 2 moved: the index is stale and must be ignored.
+  const std::string referenceName = directory + "/reference.geo";
+  vtksys::SystemTools::CopyAFile(geoName, referenceName);
+  vtksys::SystemTools::CopyFileTime(geoName, referenceName);
+  WriteGeometry(geoName, 10.0, { 20, 0, 0 });
+  vtksys::SystemTools::CopyFileTime(referenceName, geoName);
+  VERIFY(vtksys::SystemTools::FileLength(geoName) ==
+        vtksys::SystemTools::FileLength(referenceName) &&
+      vtksys::SystemTools::ModifiedTime(geoName) ==
+        vtksys::SystemTools::ModifiedTime(referenceName),
+    "Failed to rewrite the data file with the same size and modification time.");
+  VERIFY(ReadLastStep(caseName) == 12.0, "Stale index was used.");
+  VERIFY(ReadIndex(indexName).size() == 2 + NumberOfSteps - 1, "Stale index was not rewritten.");
+
+  vtksys::SystemTools::RemoveADirectory(directory);
+  return EXIT_SUCCESS;
+}
@@ -5,6 +5,7 @@
 #include "vtkByteSwap.h"
 #include "vtkCellData.h"
 #include "vtkCharArray.h"
+#include "vtkEndian.h"
 #include "vtkFloatArray.h"
 #include "vtkIdList.h"
 #include "vtkImageData.h"
@@ -13,6 +14,7 @@
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkRectilinearGrid.h"
+#include "vtkSOADataArrayTemplate.h"
 #include "vtkStructuredGrid.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
@@ -20,14 +22,154 @@
 #include "vtksys/FStream.hxx"
 #include "vtksys/SystemTools.hxx"
 
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #include <cctype>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <streambuf>
 #include <string>
+#include <vector>
 
 vtkStandardNewMacro(vtkPEnSightGoldBinaryReader);
 
 // This is half the precision of an int.
 #define MAXIMUM_PART_ID 65536
 
+//----------------------------------------------------------------------------
+// A file mapped in memory, used as the buffer of an istream. The mapping is
+// private and writable so that arrays referencing it can be modified
+// downstream: modified pages are copied.
+class vtkPEnSightGoldBinaryReader::vtkMappedFile : public std::streambuf
+{
+public:
+  static std::shared_ptr<vtkMappedFile> Map(const char* filename, size_t size)
+  {
+#if !defined(_WIN32)
+    if (size == 0)
+    {
+      return nullptr;
+    }
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0)
+    {
+      return nullptr;
+    }
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+      return nullptr;
+    }
+    return std::shared_ptr<vtkMappedFile>(new vtkMappedFile(static_cast<char*>(data), size));
+#else
+    (void)filename;
+    (void)size;
+    return nullptr;
+#endif
+  }
+
+  ~vtkMappedFile() override
+  {
+#if !defined(_WIN32)
+    munmap(this->Data, this->Size);
+#endif
+  }
+
+  // Returns the address of `count` bytes at `position`, or nullptr if they
+  // are out of the file.
+  char* GetData(vtkTypeInt64 position, vtkTypeInt64 count) const
+  {
+    if (position < 0 || count < 0 || position + count > static_cast<vtkTypeInt64>(this->Size))
+    {
+      return nullptr;
+    }
+    return this->Data + position;
+  }
+
+protected:
+  pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+  {
+    off_type base = 0;
+    if (dir == std::ios_base::cur)
+    {
+      base = this->gptr() - this->eback();
+    }
+    else if (dir == std::ios_base::end)
+    {
+      base = static_cast<off_type>(this->Size);
+    }
+    return this->seekpos(pos_type(base + off), which);
+  }
+
+  pos_type seekpos(pos_type pos, std::ios_base::openmode which) override
+  {
+    const off_type offset = pos;
+    if ((which & std::ios_base::in) == 0 || offset < 0 ||
+      offset > static_cast<off_type>(this->Size))
+    {
+      return pos_type(off_type(-1));
+    }
+    this->setg(this->Data, this->Data + offset, this->Data + this->Size);
+    return pos;
+  }
+
+private:
+  vtkMappedFile(char* data, size_t size)
+    : Data(data)
+    , Size(size)
+  {
+    this->setg(this->Data, this->Data, this->Data + this->Size);
+  }
+
+  char* Data;
+  size_t Size;
+};
+
+namespace
+{
+// Mappings referenced by data arrays, keyed by the first value of the arrays.
+// A mapping is released with the last array referencing it. This is
+// intentionally leaked so that arrays outliving static destruction are safe.
+struct MappedArraysType
+{
+  std::mutex Mutex;
+  std::multimap<void*, std::shared_ptr<void>> Mappings;
+};
+
+MappedArraysType& MappedArrays()
+{
+  static MappedArraysType* arrays = new MappedArraysType;
+  return *arrays;
+}
+
+void ReferenceMapping(void* data, const std::shared_ptr<void>& mapping)
+{
+  auto& arrays = MappedArrays();
+  std::lock_guard<std::mutex> lock(arrays.Mutex);
+  arrays.Mappings.emplace(data, mapping);
+}
+
+void ReleaseMapping(void* data)
+{
+  std::shared_ptr<void> mapping;
+  auto& arrays = MappedArrays();
+  std::lock_guard<std::mutex> lock(arrays.Mutex);
+  auto iter = arrays.Mappings.find(data);
+  if (iter != arrays.Mappings.end())
+  {
+    // unmap once the lock is released.
+    mapping = std::move(iter->second);
+    arrays.Mappings.erase(iter);
+  }
+}
+}
+
 //----------------------------------------------------------------------------
 vtkPEnSightGoldBinaryReader::vtkPEnSightGoldBinaryReader()
 {
@@ -70,6 +212,7 @@ int vtkPEnSightGoldBinaryReader::OpenFile(const char* filename)
   // Close file from any previous image
   delete this->IFile;
   this->IFile = nullptr;
+  this->MappedFile = nullptr;
 
   // Open the new file
   vtkDebugMacro(<< "Opening file " << filename);
@@ -79,11 +222,23 @@ int vtkPEnSightGoldBinaryReader::OpenFile(const char* filename)
     // Find out how big the file is.
     this->FileSize = (long)(fs.st_size);
 
+    if (this->UseMemoryMapping)
+    {
+      this->MappedFile = vtkMappedFile::Map(filename, static_cast<size_t>(fs.st_size));
+      vtkDebugMacro(<< "Memory mapping " << (this->MappedFile ? "succeeded" : "failed"));
+    }
+    if (this->MappedFile)
+    {
+      this->IFile = new std::istream(this->MappedFile.get());
+    }
+    else
+    {
 #ifdef _WIN32
-    this->IFile = new vtksys::ifstream(filename, ios::in | ios::binary);
+      this->IFile = new vtksys::ifstream(filename, ios::in | ios::binary);
 #else
-    this->IFile = new vtksys::ifstream(filename, ios::in);
+      this->IFile = new vtksys::ifstream(filename, ios::in);
 #endif
+    }
   }
   else
   {
@@ -246,15 +401,10 @@ int vtkPEnSightGoldBinaryReader::ReadGeometryFile(
     int realTimeStep = timeStep - 1;
     int j = 0;
     // Try to find the nearest time step for which we know the offset
-    for (i = realTimeStep; i >= 0; i--)
+    long offset;
+    if (this->GetClosestFileOffset(fileName, realTimeStep, j, offset))
     {
-      if (this->FileOffsets.find(fileName) != this->FileOffsets.end() &&
-        this->FileOffsets[fileName].find(i) != this->FileOffsets[fileName].end())
-      {
-        this->IFile->seekg(this->FileOffsets[fileName][i], ios::beg);
-        j = i;
-        break;
-      }
+      this->IFile->seekg(offset, ios::beg);
     }
 
     // Hopefully we are not very far from the timestep we want to use
@@ -267,12 +417,7 @@ int vtkPEnSightGoldBinaryReader::ReadGeometryFile(
       }
       else
       {
-        if (this->FileOffsets.find(fileName) == this->FileOffsets.end())
-        {
-          std::map<int, long> tsMap;
-          this->FileOffsets[fileName] = tsMap;
-        }
-        this->FileOffsets[fileName][j] = this->IFile->tellg();
+        this->SetFileOffset(fileName, j, this->IFile->tellg());
       }
     }
 
@@ -1123,17 +1268,12 @@ int vtkPEnSightGoldBinaryReader::ReadMeasuredGeometryFile(
   if (this->UseFileSets)
   {
     int realTimeStep = timeStep - 1;
-    int k, j = 0;
+    int j = 0;
     // Try to find the nearest time step for which we know the offset
-    for (k = realTimeStep; k >= 0; k--)
+    long offset;
+    if (this->GetClosestFileOffset(fileName, realTimeStep, j, offset))
     {
-      if (this->FileOffsets.find(fileName) != this->FileOffsets.end() &&
-        this->FileOffsets[fileName].find(k) != this->FileOffsets[fileName].end())
-      {
-        this->IFile->seekg(this->FileOffsets[fileName][k], ios::beg);
-        j = k;
-        break;
-      }
+      this->IFile->seekg(offset, ios::beg);
     }
 
     // Hopefully we are not very far from the timestep we want to use
@@ -1162,12 +1302,7 @@ int vtkPEnSightGoldBinaryReader::ReadMeasuredGeometryFile(
       this->IFile->seekg(
         (sizeof(float) * 3 + sizeof(int)) * this->NumberOfMeasuredPoints, ios::cur);
       this->ReadLine(line); // END TIME STEP
-      if (this->FileOffsets.find(fileName) == this->FileOffsets.end())
-      {
-        std::map<int, long> tsMap;
-        this->FileOffsets[fileName] = tsMap;
-      }
-      this->FileOffsets[fileName][j] = this->IFile->tellg();
+      this->SetFileOffset(fileName, j, this->IFile->tellg());
     }
     while (strncmp(line, "BEGIN TIME STEP", 15) != 0)
     {
@@ -1312,15 +1447,10 @@ int vtkPEnSightGoldBinaryReader::ReadScalarsPerNode(const char* fileName, const
     int realTimeStep = timeStep - 1;
     // Try to find the nearest time step for which we know the offset
     int j = 0;
-    for (i = realTimeStep; i >= 0; i--)
+    long offset;
+    if (this->GetClosestFileOffset(fileName, realTimeStep, j, offset))
     {
-      if (this->FileOffsets.find(fileName) != this->FileOffsets.end() &&
-        this->FileOffsets[fileName].find(i) != this->FileOffsets[fileName].end())
-      {
-        this->IFile->seekg(this->FileOffsets[fileName][i], ios::beg);
-        j = i;
-        break;
-      }
+      this->IFile->seekg(offset, ios::beg);
     }
 
     // Hopefully we are not very far from the timestep we want to use
@@ -1361,12 +1491,7 @@ int vtkPEnSightGoldBinaryReader::ReadScalarsPerNode(const char* fileName, const
           this->IFile->seekg(sizeof(float) * numPts, ios::cur);
         }
       }
-      if (this->FileOffsets.find(fileName) == this->FileOffsets.end())
-      {
-        std::map<int, long> tsMap;
-        this->FileOffsets[fileName] = tsMap;
-      }
-      this->FileOffsets[fileName][j] = this->IFile->tellg();
+      this->SetFileOffset(fileName, j, this->IFile->tellg());
     }
 
     this->ReadLine(line);
@@ -1432,24 +1557,39 @@ int vtkPEnSightGoldBinaryReader::ReadScalarsPerNode(const char* fileName, const
     if (numPts)
     {
       this->ReadLine(line); // "coordinates" or "block"
-      if (component == 0)
+      vtkSmartPointer<vtkDataArray> mappedScalars;
+      if (numberOfComponents == 1)
       {
-        scalars = vtkFloatArray::New();
-        scalars->SetNumberOfComponents(numberOfComponents);
-        scalars->SetNumberOfTuples(this->GetPointIds(realId)->GetLocalNumberOfIds());
+        mappedScalars = this->ReadMappedFloatArrays(this->GetPointIds(realId), numPts, 1);
       }
-      else
+      if (mappedScalars)
       {
-        scalars = (vtkFloatArray*)(output->GetPointData()->GetArray(description));
+        // released like a newly allocated array below.
+        scalars = vtkFloatArray::SafeDownCast(mappedScalars);
+        scalars->Register(nullptr);
       }
+      else
+      {
+        if (component == 0)
+        {
+          scalars = vtkFloatArray::New();
+          scalars->SetNumberOfComponents(numberOfComponents);
+          scalars->SetNumberOfTuples(this->GetPointIds(realId)->GetLocalNumberOfIds());
+        }
+        else
+        {
+          scalars = (vtkFloatArray*)(output->GetPointData()->GetArray(description));
+        }
 
-      scalarsRead = new float[numPts];
-      this->ReadFloatArray(scalarsRead, numPts);
+        scalarsRead = new float[numPts];
+        this->ReadFloatArray(scalarsRead, numPts);
 
-      for (i = 0; i < numPts; i++)
-      {
-        this->InsertVariableComponent(
-          scalars, i, component, &(scalarsRead[i]), realId, 0, SCALAR_PER_NODE);
+        for (i = 0; i < numPts; i++)
+        {
+          this->InsertVariableComponent(
+            scalars, i, component, &(scalarsRead[i]), realId, 0, SCALAR_PER_NODE);
+        }
+        delete[] scalarsRead;
       }
       if (component == 0)
       {
@@ -1465,7 +1605,6 @@ int vtkPEnSightGoldBinaryReader::ReadScalarsPerNode(const char* fileName, const
       {
         output->GetPointData()->AddArray(scalars);
       }
-      delete[] scalarsRead;
     }
 
     this->IFile->peek();
@@ -1529,15 +1668,10 @@ int vtkPEnSightGoldBinaryReader::ReadVectorsPerNode(const char* fileName, const
     int realTimeStep = timeStep - 1;
     // Try to find the nearest time step for which we know the offset
     int j = 0;
-    for (i = realTimeStep; i >= 0; i--)
+    long offset;
+    if (this->GetClosestFileOffset(fileName, realTimeStep, j, offset))
     {
-      if (this->FileOffsets.find(fileName) != this->FileOffsets.end() &&
-        this->FileOffsets[fileName].find(i) != this->FileOffsets[fileName].end())
-      {
-        this->IFile->seekg(this->FileOffsets[fileName][i], ios::beg);
-        j = i;
-        break;
-      }
+      this->IFile->seekg(offset, ios::beg);
     }
 
     // Hopefully we are not very far from the timestep we want to use
@@ -1578,12 +1712,7 @@ int vtkPEnSightGoldBinaryReader::ReadVectorsPerNode(const char* fileName, const
           this->IFile->seekg(sizeof(float) * 3 * numPts, ios::cur);
         }
       }
-      if (this->FileOffsets.find(fileName) == this->FileOffsets.end())
-      {
-        std::map<int, long> tsMap;
-        this->FileOffsets[fileName] = tsMap;
-      }
-      this->FileOffsets[fileName][j] = this->IFile->tellg();
+      this->SetFileOffset(fileName, j, this->IFile->tellg());
     }
 
     this->ReadLine(line);
@@ -1647,32 +1776,46 @@ int vtkPEnSightGoldBinaryReader::ReadVectorsPerNode(const char* fileName, const
     if (numPts)
     {
       this->ReadLine(line); // "coordinates" or "block"
-      vectors->SetNumberOfComponents(3);
-      vectors->SetNumberOfTuples(this->GetPointIds(realId)->GetLocalNumberOfIds());
-      comp1 = new float[numPts];
-      comp2 = new float[numPts];
-      comp3 = new float[numPts];
-      this->ReadFloatArray(comp1, numPts);
-      this->ReadFloatArray(comp2, numPts);
-      this->ReadFloatArray(comp3, numPts);
-      for (i = 0; i < numPts; i++)
+      vtkSmartPointer<vtkDataArray> mappedVectors =
+        this->ReadMappedFloatArrays(this->GetPointIds(realId), numPts, 3);
+      if (mappedVectors)
       {
-        tuple[0] = comp1[i];
-        tuple[1] = comp2[i];
-        tuple[2] = comp3[i];
-        this->InsertVariableComponent(vectors, i, -1, tuple, realId, 0, VECTOR_PER_NODE);
+        mappedVectors->SetName(description);
+        output->GetPointData()->AddArray(mappedVectors);
+        if (!output->GetPointData()->GetVectors())
+        {
+          output->GetPointData()->SetVectors(mappedVectors);
+        }
       }
-      vectors->SetName(description);
-      output->GetPointData()->AddArray(vectors);
-      if (!output->GetPointData()->GetVectors())
+      else
       {
-        output->GetPointData()->SetVectors(vectors);
+        vectors->SetNumberOfComponents(3);
+        vectors->SetNumberOfTuples(this->GetPointIds(realId)->GetLocalNumberOfIds());
+        comp1 = new float[numPts];
+        comp2 = new float[numPts];
+        comp3 = new float[numPts];
+        this->ReadFloatArray(comp1, numPts);
+        this->ReadFloatArray(comp2, numPts);
+        this->ReadFloatArray(comp3, numPts);
+        for (i = 0; i < numPts; i++)
+        {
+          tuple[0] = comp1[i];
+          tuple[1] = comp2[i];
+          tuple[2] = comp3[i];
+          this->InsertVariableComponent(vectors, i, -1, tuple, realId, 0, VECTOR_PER_NODE);
+        }
+        vectors->SetName(description);
+        output->GetPointData()->AddArray(vectors);
+        if (!output->GetPointData()->GetVectors())
+        {
+          output->GetPointData()->SetVectors(vectors);
+        }
+        delete[] comp1;
+        delete[] comp2;
+        delete[] comp3;
       }
-      vectors->Delete();
-      delete[] comp1;
-      delete[] comp2;
-      delete[] comp3;
     }
+    vectors->Delete();
 
     this->IFile->peek();
     if (this->IFile->eof())
@@ -1734,15 +1877,10 @@ int vtkPEnSightGoldBinaryReader::ReadTensorsPerNode(const char* fileName, const
     int realTimeStep = timeStep - 1;
     int j = 0;
     // Try to find the nearest time step for which we know the offset
-    for (i = realTimeStep; i >= 0; i--)
+    long offset;
+    if (this->GetClosestFileOffset(fileName, realTimeStep, j, offset))
     {
-      if (this->FileOffsets.find(fileName) != this->FileOffsets.end() &&
-        this->FileOffsets[fileName].find(i) != this->FileOffsets[fileName].end())
-      {
-        this->IFile->seekg(this->FileOffsets[fileName][i], ios::beg);
-        j = i;
-        break;
-      }
+      this->IFile->seekg(offset, ios::beg);
     }
 
     // Hopefully we are not very far from the timestep we want to use
@@ -1770,12 +1908,7 @@ int vtkPEnSightGoldBinaryReader::ReadTensorsPerNode(const char* fileName, const
           this->IFile->seekg(sizeof(float) * 6 * numPts, ios::cur);
         }
       }
-      if (this->FileOffsets.find(fileName) == this->FileOffsets.end())
-      {
-        std::map<int, long> tsMap;
-        this->FileOffsets[fileName] = tsMap;
-      }
-      this->FileOffsets[fileName][j] = this->IFile->tellg();
+      this->SetFileOffset(fileName, j, this->IFile->tellg());
     }
     this->ReadLine(line);
     while (strncmp(line, "BEGIN TIME STEP", 15) != 0)
@@ -1894,15 +2027,10 @@ int vtkPEnSightGoldBinaryReader::ReadScalarsPerElement(const char* fileName,
     int realTimeStep = timeStep - 1;
     // Try to find the nearest time step for which we know the offset
     int j = 0;
-    for (i = realTimeStep; i >= 0; i--)
+    long offset;
+    if (this->GetClosestFileOffset(fileName, realTimeStep, j, offset))
     {
-      if (this->FileOffsets.find(fileName) != this->FileOffsets.end() &&
-        this->FileOffsets[fileName].find(i) != this->FileOffsets[fileName].end())
-      {
-        this->IFile->seekg(this->FileOffsets[fileName][i], ios::beg);
-        j = i;
-        break;
-      }
+      this->IFile->seekg(offset, ios::beg);
     }
 
     // Hopefully we are not very far from the timestep we want to use
@@ -1962,12 +2090,7 @@ int vtkPEnSightGoldBinaryReader::ReadScalarsPerElement(const char* fileName,
           lineRead = this->ReadLine(line);
         }
       } // end while
-      if (this->FileOffsets.find(fileName) == this->FileOffsets.end())
-      {
-        std::map<int, long> tsMap;
-        this->FileOffsets[fileName] = tsMap;
-      }
-      this->FileOffsets[fileName][j] = this->IFile->tellg();
+      this->SetFileOffset(fileName, j, this->IFile->tellg());
     } // end for
     this->ReadLine(line);
     while (strncmp(line, "BEGIN TIME STEP", 15) != 0)
@@ -2140,15 +2263,10 @@ int vtkPEnSightGoldBinaryReader::ReadVectorsPerElement(const char* fileName,
     int realTimeStep = timeStep - 1;
     // Try to find the nearest time step for which we know the offset
     int j = 0;
-    for (i = realTimeStep; i >= 0; i--)
+    long offset;
+    if (this->GetClosestFileOffset(fileName, realTimeStep, j, offset))
     {
-      if (this->FileOffsets.find(fileName) != this->FileOffsets.end() &&
-        this->FileOffsets[fileName].find(i) != this->FileOffsets[fileName].end())
-      {
-        this->IFile->seekg(this->FileOffsets[fileName][i], ios::beg);
-        j = i;
-        break;
-      }
+      this->IFile->seekg(offset, ios::beg);
     }
 
     // Hopefully we are not very far from the timestep we want to use
@@ -2209,12 +2327,7 @@ int vtkPEnSightGoldBinaryReader::ReadVectorsPerElement(const char* fileName,
           lineRead = this->ReadLine(line);
         }
       }
-      if (this->FileOffsets.find(fileName) == this->FileOffsets.end())
-      {
-        std::map<int, long> tsMap;
-        this->FileOffsets[fileName] = tsMap;
-      }
-      this->FileOffsets[fileName][j] = this->IFile->tellg();
+      this->SetFileOffset(fileName, j, this->IFile->tellg());
     }
     this->ReadLine(line);
     while (strncmp(line, "BEGIN TIME STEP", 15) != 0)
@@ -2386,15 +2499,10 @@ int vtkPEnSightGoldBinaryReader::ReadTensorsPerElement(const char* fileName,
     int realTimeStep = timeStep - 1;
     // Try to find the nearest time step for which we know the offset
     int j = 0;
-    for (i = realTimeStep; i >= 0; i--)
+    long offset;
+    if (this->GetClosestFileOffset(fileName, realTimeStep, j, offset))
     {
-      if (this->FileOffsets.find(fileName) != this->FileOffsets.end() &&
-        this->FileOffsets[fileName].find(i) != this->FileOffsets[fileName].end())
-      {
-        this->IFile->seekg(this->FileOffsets[fileName][i], ios::beg);
-        j = i;
-        break;
-      }
+      this->IFile->seekg(offset, ios::beg);
     }
 
     // Hopefully we are not very far from the timestep we want to use
@@ -2455,12 +2563,7 @@ int vtkPEnSightGoldBinaryReader::ReadTensorsPerElement(const char* fileName,
           lineRead = this->ReadLine(line);
         }
       }
-      if (this->FileOffsets.find(fileName) == this->FileOffsets.end())
-      {
-        std::map<int, long> tsMap;
-        this->FileOffsets[fileName] = tsMap;
-      }
-      this->FileOffsets[fileName][j] = this->IFile->tellg();
+      this->SetFileOffset(fileName, j, this->IFile->tellg());
     }
     this->ReadLine(line);
     while (strncmp(line, "BEGIN TIME STEP", 15) != 0)
@@ -3754,28 +3857,38 @@ int vtkPEnSightGoldBinaryReader::CreateStructuredGridOutput(
   output->SetDimensions(newDimensions);
   //   output->SetWholeExtent(
   //                          0, newDimensions[0]-1, 0, newDimensions[1]-1, 0, newDimensions[2]-1);
-  points->Allocate(this->GetPointIds(partId)->GetLocalNumberOfIds());
 
-  long currentPositionInFile = this->IFile->tellg();
+  vtkSmartPointer<vtkDataArray> coordinates =
+    this->ReadMappedFloatArrays(this->GetPointIds(partId), numPts, 3);
+  if (coordinates)
+  {
+    points->SetData(coordinates);
+  }
+  else
+  {
+    points->Allocate(this->GetPointIds(partId)->GetLocalNumberOfIds());
 
-  // Buffer Read.
-  this->FloatBufferFilePosition = currentPositionInFile;
-  this->FloatBufferIndexBegin = 0;
-  this->FloatBufferNumberOfVectors = numPts;
-  long endFilePosition = currentPositionInFile + 3 * numPts * (long)sizeof(float);
-  if (this->Fortran)
-    endFilePosition += 24; // 4 * (begin + end) * number of components (3)
-  this->UpdateFloatBuffer();
-  this->IFile->seekg(endFilePosition);
+    long currentPositionInFile = this->IFile->tellg();
 
-  for (i = 0; i < numPts; i++)
-  {
-    int realPointId = this->GetPointIds(partId)->GetId(i);
-    if (realPointId != -1)
+    // Buffer Read.
+    this->FloatBufferFilePosition = currentPositionInFile;
+    this->FloatBufferIndexBegin = 0;
+    this->FloatBufferNumberOfVectors = numPts;
+    long endFilePosition = currentPositionInFile + 3 * numPts * (long)sizeof(float);
+    if (this->Fortran)
+      endFilePosition += 24; // 4 * (begin + end) * number of components (3)
+    this->UpdateFloatBuffer();
+    this->IFile->seekg(endFilePosition);
+
+    for (i = 0; i < numPts; i++)
     {
-      float vec[3];
-      this->GetVectorFromFloatBuffer(i, vec);
-      points->InsertNextPoint(vec[0], vec[1], vec[2]);
+      int realPointId = this->GetPointIds(partId)->GetId(i);
+      if (realPointId != -1)
+      {
+        float vec[3];
+        this->GetVectorFromFloatBuffer(i, vec);
+        points->InsertNextPoint(vec[0], vec[1], vec[2]);
+      }
     }
   }
   output->SetPoints(points);
@@ -4297,6 +4410,67 @@ int vtkPEnSightGoldBinaryReader::ReadFloatArray(float* result, int numFloats)
   return 1;
 }
 
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkDataArray> vtkPEnSightGoldBinaryReader::ReadMappedFloatArrays(
+  vtkPEnSightReaderCellIds* ids, vtkIdType numTuples, int numComps)
+{
+#ifdef VTK_WORDS_BIGENDIAN
+  const bool nativeByteOrder = this->ByteOrder != FILE_LITTLE_ENDIAN;
+#else
+  const bool nativeByteOrder = this->ByteOrder == FILE_LITTLE_ENDIAN;
+#endif
+  int first, count;
+  if (!this->MappedFile || !nativeByteOrder || numTuples <= 0 || numComps <= 0 ||
+    !ids->GetLocalRange(numTuples, first, count))
+  {
+    return nullptr;
+  }
+
+  // Each array is a separate record, surrounded by its length in Fortran files.
+  const vtkTypeInt64 position = this->IFile->tellg();
+  const vtkTypeInt64 markerSize = this->Fortran ? 4 : 0;
+  const vtkTypeInt64 recordSize = numTuples * sizeof(float) + 2 * markerSize;
+  std::vector<float*> arrays(numComps);
+  for (int comp = 0; comp < numComps; ++comp)
+  {
+    char* data = this->MappedFile->GetData(
+      position + comp * recordSize + markerSize + first * sizeof(float), count * sizeof(float));
+    if (!data || reinterpret_cast<std::uintptr_t>(data) % alignof(float) != 0)
+    {
+      return nullptr;
+    }
+    arrays[comp] = reinterpret_cast<float*>(data);
+  }
+
+  vtkSmartPointer<vtkDataArray> result;
+  if (numComps == 1)
+  {
+    auto array = vtkSmartPointer<vtkFloatArray>::New();
+    array->SetArray(arrays[0], count, 0, vtkAbstractArray::VTK_DATA_ARRAY_USER_DEFINED);
+    array->SetArrayFreeFunction(::ReleaseMapping);
+    result = array;
+  }
+  else
+  {
+    auto array = vtkSmartPointer<vtkSOADataArrayTemplate<float>>::New();
+    array->SetNumberOfComponents(numComps);
+    for (int comp = 0; comp < numComps; ++comp)
+    {
+      array->SetArray(comp, arrays[comp], count, /*updateMaxId=*/comp == 0, /*save=*/false,
+        vtkAbstractArray::VTK_DATA_ARRAY_USER_DEFINED);
+      array->SetArrayFreeFunction(comp, ::ReleaseMapping);
+    }
+    result = array;
+  }
+  for (int comp = 0; comp < numComps; ++comp)
+  {
+    ::ReferenceMapping(arrays[comp], this->MappedFile);
+  }
+
+  this->IFile->seekg(position + numComps * recordSize);
+  return result;
+}
+
 //----------------------------------------------------------------------------
 int vtkPEnSightGoldBinaryReader::ReadOrSkipCoordinates(
   vtkPoints* points, long offset, int partId, bool skip)
@@ -4325,6 +4499,18 @@ int vtkPEnSightGoldBinaryReader::ReadOrSkipCoordinates(
     this->IFile->seekg(sizeof(int) * numPts, ios::cur);
   }
 
+  if (!skip && this->GetPointIds(partId)->GetNumberOfIds() != 0)
+  {
+    vtkSmartPointer<vtkDataArray> coordinates =
+      this->ReadMappedFloatArrays(this->GetPointIds(partId), numPts, 3);
+    if (coordinates)
+    {
+      points->SetData(coordinates);
+      this->GetPointIds(partId)->SetNumberOfIds(numPts);
+      return static_cast<int>(coordinates->GetNumberOfTuples());
+    }
+  }
+
   long currentPositionInFile = this->IFile->tellg();
 
   this->FloatBufferFilePosition = currentPositionInFile;
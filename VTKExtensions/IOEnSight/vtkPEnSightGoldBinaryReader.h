@@ -16,6 +16,15 @@
  * Oxalya (http://www.oxalya.com)
  *
  * \endverbatim
+ *
+ * When `UseMemoryMapping` is enabled (see vtkPGenericEnSightReader), the
+ * files are memory mapped instead of being read through a stream. This is
+ * ignored on platforms without memory mapping support. Per-node variables and unstructured
+ * coordinates of the parts read entirely by this process are then wrapped
+ * as data arrays referencing the mapping, without any intermediate copy,
+ * provided the file is stored in the native byte order. The coordinates and
+ * the 3-component variables, which EnSight stores as one block per
+ * component, are exposed as vtkSOADataArrayTemplate<float> arrays.
  */
 
 #ifndef vtkPEnSightGoldBinaryReader_h
@@ -23,7 +32,11 @@
 
 #include "vtkPEnSightReader.h"
 #include "vtkPVVTKExtensionsIOEnSightModule.h" //needed for exports
+#include "vtkSmartPointer.h"                    // for vtkSmartPointer
+
+#include <memory> // for std::shared_ptr
 
+class vtkDataArray;
 class vtkMultiBlockDataSet;
 class vtkUnstructuredGrid;
 class vtkPoints;
@@ -39,6 +52,8 @@ protected:
   vtkPEnSightGoldBinaryReader();
   ~vtkPEnSightGoldBinaryReader() override;
 
+  class vtkMappedFile;
+
   // Returns 1 if successful.  Sets file size as a side action.
   int OpenFile(const char* filename);
 
@@ -159,6 +174,19 @@ protected:
    */
   int ReadFloatArray(float* result, int numFloats);
 
+  /**
+   * Internal function to read `numComps` consecutive float arrays of
+   * `numTuples` values, one per component, as a single array referencing the
+   * memory mapped file: a vtkFloatArray for a single component, a
+   * vtkSOADataArrayTemplate<float> otherwise. Only the values of the local
+   * `ids` are referenced, which requires them to be contiguous in the file.
+   * Returns nullptr, without moving in the file, when that is not the case or
+   * when the file is not mapped or not stored in the native byte order; the
+   * values must then be read with ReadFloatArray.
+   */
+  vtkSmartPointer<vtkDataArray> ReadMappedFloatArrays(
+    vtkPEnSightReaderCellIds* ids, vtkIdType numTuples, int numComps);
+
   /**
    * Read Coordinates, or just skip the part in the file.
    */
@@ -197,6 +225,10 @@ protected:
   // The size of the file could be used to choose byte order.
   long FileSize;
 
+  // The mapping IFile reads from, if any. Arrays returned by
+  // ReadMappedFloatArrays keep it alive as long as they need it.
+  std::shared_ptr<vtkMappedFile> MappedFile;
+
   // Float Vector Buffer utils
   void GetVectorFromFloatBuffer(vtkIdType i, float* vector);
   void UpdateFloatBuffer();
@@ -117,15 +117,10 @@ int vtkPEnSightGoldReader::ReadGeometryFile(
     int realTimeStep = timeStep - 1;
     // Try to find the nearest time step for which we know the offset
     int j = 0;
-    for (i = realTimeStep; i >= 0; i--)
+    long offset;
+    if (this->GetClosestFileOffset(fileName, realTimeStep, j, offset))
     {
-      if (this->FileOffsets.find(fileName) != this->FileOffsets.end() &&
-        this->FileOffsets[fileName].find(i) != this->FileOffsets[fileName].end())
-      {
-        this->IS->seekg(this->FileOffsets[fileName][i], ios::beg);
-        j = i;
-        break;
-      }
+      this->IS->seekg(offset, ios::beg);
     }
 
     // Hopefully we are not very far from the timestep we want to use
@@ -137,12 +132,7 @@ int vtkPEnSightGoldReader::ReadGeometryFile(
         this->ReadLine(line);
       }
       this->ReadLine(line);
-      if (this->FileOffsets.find(fileName) == this->FileOffsets.end())
-      {
-        std::map<int, long> tsMap;
-        this->FileOffsets[fileName] = tsMap;
-      }
-      this->FileOffsets[fileName][j] = this->IS->tellg();
+      this->SetFileOffset(fileName, j, this->IS->tellg());
     }
 
     while (strncmp(line, "BEGIN TIME STEP", 15) != 0)
@@ -322,15 +312,10 @@ int vtkPEnSightGoldReader::ReadMeasuredGeometryFile(
     int realTimeStep = timeStep - 1;
     // Try to find the nearest time step for which we know the offset
     int j = 0;
-    for (i = realTimeStep; i >= 0; i--)
+    long offset;
+    if (this->GetClosestFileOffset(fileName, realTimeStep, j, offset))
     {
-      if (this->FileOffsets.find(fileName) != this->FileOffsets.end() &&
-        this->FileOffsets[fileName].find(i) != this->FileOffsets[fileName].end())
-      {
-        this->IS->seekg(this->FileOffsets[fileName][i], ios::beg);
-        j = i;
-        break;
-      }
+      this->IS->seekg(offset, ios::beg);
     }
 
     // Hopefully we are not very far from the timestep we want to use
@@ -342,12 +327,7 @@ int vtkPEnSightGoldReader::ReadMeasuredGeometryFile(
         this->ReadLine(line);
       }
       this->ReadLine(line);
-      if (this->FileOffsets.find(fileName) == this->FileOffsets.end())
-      {
-        std::map<int, long> tsMap;
-        this->FileOffsets[fileName] = tsMap;
-      }
-      this->FileOffsets[fileName][j] = this->IS->tellg();
+      this->SetFileOffset(fileName, j, this->IS->tellg());
     }
 
     while (strncmp(line, "BEGIN TIME STEP", 15) != 0)
@@ -472,15 +452,10 @@ int vtkPEnSightGoldReader::ReadScalarsPerNode(const char* fileName, const char*
     int realTimeStep = timeStep - 1;
     // Try to find the nearest time step for which we know the offset
     j = 0;
-    for (i = realTimeStep; i >= 0; i--)
+    long offset;
+    if (this->GetClosestFileOffset(fileName, realTimeStep, j, offset))
     {
-      if (this->FileOffsets.find(fileName) != this->FileOffsets.end() &&
-        this->FileOffsets[fileName].find(i) != this->FileOffsets[fileName].end())
-      {
-        this->IS->seekg(this->FileOffsets[fileName][i], ios::beg);
-        j = i;
-        break;
-      }
+      this->IS->seekg(offset, ios::beg);
     }
 
     // Hopefully we are not very far from the timestep we want to use
@@ -492,12 +467,7 @@ int vtkPEnSightGoldReader::ReadScalarsPerNode(const char* fileName, const char*
       {
         this->ReadLine(line);
       }
-      if (this->FileOffsets.find(fileName) == this->FileOffsets.end())
-      {
-        std::map<int, long> tsMap;
-        this->FileOffsets[fileName] = tsMap;
-      }
-      this->FileOffsets[fileName][j] = this->IS->tellg();
+      this->SetFileOffset(fileName, j, this->IS->tellg());
     }
 
     this->ReadLine(line);
@@ -692,15 +662,10 @@ int vtkPEnSightGoldReader::ReadVectorsPerNode(const char* fileName, const char*
     int realTimeStep = timeStep - 1;
     // Try to find the nearest time step for which we know the offset
     j = 0;
-    for (i = realTimeStep; i >= 0; i--)
+    long offset;
+    if (this->GetClosestFileOffset(fileName, realTimeStep, j, offset))
     {
-      if (this->FileOffsets.find(fileName) != this->FileOffsets.end() &&
-        this->FileOffsets[fileName].find(i) != this->FileOffsets[fileName].end())
-      {
-        this->IS->seekg(this->FileOffsets[fileName][i], ios::beg);
-        j = i;
-        break;
-      }
+      this->IS->seekg(offset, ios::beg);
     }
 
     // Hopefully we are not very far from the timestep we want to use
@@ -712,12 +677,7 @@ int vtkPEnSightGoldReader::ReadVectorsPerNode(const char* fileName, const char*
       {
         this->ReadLine(line);
       }
-      if (this->FileOffsets.find(fileName) == this->FileOffsets.end())
-      {
-        std::map<int, long> tsMap;
-        this->FileOffsets[fileName] = tsMap;
-      }
-      this->FileOffsets[fileName][j] = this->IS->tellg();
+      this->SetFileOffset(fileName, j, this->IS->tellg());
     }
 
     this->ReadLine(line);
@@ -871,15 +831,10 @@ int vtkPEnSightGoldReader::ReadTensorsPerNode(const char* fileName, const char*
     int realTimeStep = timeStep - 1;
     // Try to find the nearest time step for which we know the offset
     j = 0;
-    for (i = realTimeStep; i >= 0; i--)
+    long offset;
+    if (this->GetClosestFileOffset(fileName, realTimeStep, j, offset))
     {
-      if (this->FileOffsets.find(fileName) != this->FileOffsets.end() &&
-        this->FileOffsets[fileName].find(i) != this->FileOffsets[fileName].end())
-      {
-        this->IS->seekg(this->FileOffsets[fileName][i], ios::beg);
-        j = i;
-        break;
-      }
+      this->IS->seekg(offset, ios::beg);
     }
 
     // Hopefully we are not very far from the timestep we want to use
@@ -891,12 +846,7 @@ int vtkPEnSightGoldReader::ReadTensorsPerNode(const char* fileName, const char*
       {
         this->ReadLine(line);
       }
-      if (this->FileOffsets.find(fileName) == this->FileOffsets.end())
-      {
-        std::map<int, long> tsMap;
-        this->FileOffsets[fileName] = tsMap;
-      }
-      this->FileOffsets[fileName][j] = this->IS->tellg();
+      this->SetFileOffset(fileName, j, this->IS->tellg());
     }
 
     this->ReadLine(line);
@@ -997,15 +947,10 @@ int vtkPEnSightGoldReader::ReadScalarsPerElement(const char* fileName, const cha
     int realTimeStep = timeStep - 1;
     // Try to find the nearest time step for which we know the offset
     int j = 0;
-    for (i = realTimeStep; i >= 0; i--)
+    long offset;
+    if (this->GetClosestFileOffset(fileName, realTimeStep, j, offset))
     {
-      if (this->FileOffsets.find(fileName) != this->FileOffsets.end() &&
-        this->FileOffsets[fileName].find(i) != this->FileOffsets[fileName].end())
-      {
-        this->IS->seekg(this->FileOffsets[fileName][i], ios::beg);
-        j = i;
-        break;
-      }
+      this->IS->seekg(offset, ios::beg);
     }
 
     // Hopefully we are not very far from the timestep we want to use
@@ -1017,12 +962,7 @@ int vtkPEnSightGoldReader::ReadScalarsPerElement(const char* fileName, const cha
       {
         this->ReadLine(line);
       }
-      if (this->FileOffsets.find(fileName) == this->FileOffsets.end())
-      {
-        std::map<int, long> tsMap;
-        this->FileOffsets[fileName] = tsMap;
-      }
-      this->FileOffsets[fileName][j] = this->IS->tellg();
+      this->SetFileOffset(fileName, j, this->IS->tellg());
     }
 
     this->ReadLine(line);
@@ -1204,15 +1144,10 @@ int vtkPEnSightGoldReader::ReadVectorsPerElement(const char* fileName, const cha
     int realTimeStep = timeStep - 1;
     // Try to find the nearest time step for which we know the offset
     j = 0;
-    for (i = realTimeStep; i >= 0; i--)
+    long offset;
+    if (this->GetClosestFileOffset(fileName, realTimeStep, j, offset))
     {
-      if (this->FileOffsets.find(fileName) != this->FileOffsets.end() &&
-        this->FileOffsets[fileName].find(i) != this->FileOffsets[fileName].end())
-      {
-        this->IS->seekg(this->FileOffsets[fileName][i], ios::beg);
-        j = i;
-        break;
-      }
+      this->IS->seekg(offset, ios::beg);
     }
 
     // Hopefully we are not very far from the timestep we want to use
@@ -1224,12 +1159,7 @@ int vtkPEnSightGoldReader::ReadVectorsPerElement(const char* fileName, const cha
       {
         this->ReadLine(line);
       }
-      if (this->FileOffsets.find(fileName) == this->FileOffsets.end())
-      {
-        std::map<int, long> tsMap;
-        this->FileOffsets[fileName] = tsMap;
-      }
-      this->FileOffsets[fileName][j] = this->IS->tellg();
+      this->SetFileOffset(fileName, j, this->IS->tellg());
     }
 
     this->ReadLine(line);
@@ -1373,15 +1303,10 @@ int vtkPEnSightGoldReader::ReadTensorsPerElement(const char* fileName, const cha
     int realTimeStep = timeStep - 1;
     // Try to find the nearest time step for which we know the offset
     j = 0;
-    for (i = realTimeStep; i >= 0; i--)
+    long offset;
+    if (this->GetClosestFileOffset(fileName, realTimeStep, j, offset))
     {
-      if (this->FileOffsets.find(fileName) != this->FileOffsets.end() &&
-        this->FileOffsets[fileName].find(i) != this->FileOffsets[fileName].end())
-      {
-        this->IS->seekg(this->FileOffsets[fileName][i], ios::beg);
-        j = i;
-        break;
-      }
+      this->IS->seekg(offset, ios::beg);
     }
 
     // Hopefully we are not very far from the timestep we want to use
@@ -1393,12 +1318,7 @@ int vtkPEnSightGoldReader::ReadTensorsPerElement(const char* fileName, const cha
       {
         this->ReadLine(line);
       }
-      if (this->FileOffsets.find(fileName) == this->FileOffsets.end())
-      {
-        std::map<int, long> tsMap;
-        this->FileOffsets[fileName] = tsMap;
-      }
-      this->FileOffsets[fileName][j] = this->IS->tellg();
+      this->SetFileOffset(fileName, j, this->IS->tellg());
     }
 
     this->ReadLine(line);
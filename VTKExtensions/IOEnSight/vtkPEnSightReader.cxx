@@ -28,6 +28,11 @@
 #include "vtkUnstructuredGrid.h"
 
 #include "vtksys/FStream.hxx"
+#include "vtksys/SystemTools.hxx"
+
+#include <iomanip>
+#include <sstream>
+#include <string>
 
 typedef std::vector<vtkPEnSightReader::vtkPEnSightReaderCellIds*> vtkPEnSightReaderCellIdsTypeBase;
 class vtkPEnSightReaderCellIdsType : public vtkPEnSightReaderCellIdsTypeBase
@@ -36,6 +41,35 @@ class vtkPEnSightReaderCellIdsType : public vtkPEnSightReaderCellIdsTypeBase
 
 namespace
 {
+const char* const TimeStepIndexHeader = "EnSight time step index 2";
+
+std::string GetTimeStepIndexFileName(const std::string& fullFileName)
+{
+  return fullFileName + ".stepindex";
+}
+
+// Returns the bytes around `offset` in `file`, hex encoded. Index files store
+// it along with each offset to detect data files rewritten without changing
+// their size or modification time.
+std::string GetOffsetFingerprint(std::istream& file, long offset)
+{
+  const int halfWidth = 32;
+  const long start = offset > halfWidth ? offset - halfWidth : 0;
+  char buffer[2 * halfWidth];
+  file.clear();
+  file.seekg(start, ios::beg);
+  file.read(buffer, static_cast<std::streamsize>(offset - start + halfWidth));
+  const std::streamsize count = file.gcount();
+
+  std::ostringstream stream;
+  stream << std::hex << std::setfill('0');
+  for (std::streamsize cc = 0; cc < count; ++cc)
+  {
+    stream << std::setw(2) << static_cast<int>(static_cast<unsigned char>(buffer[cc]));
+  }
+  return count > 0 ? stream.str() : std::string("-");
+}
+
 void cleanup(vtkPEnSightReaderCellIdsType* foo)
 {
   if (!foo)
@@ -426,6 +460,7 @@ int vtkPEnSightReader::RequestData(vtkInformation* vtkNotUsed(request),
     }
   }
 
+  this->SaveFileOffsets();
   return 1;
 }
 
@@ -2594,6 +2629,127 @@ void vtkPEnSightReader::SetBlockName(
   output->GetMetaData(blockNo)->Set(vtkCompositeDataSet::NAME(), name);
 }
 
+//----------------------------------------------------------------------------
+std::string vtkPEnSightReader::GetFullFileName(const char* fileName)
+{
+  std::string sfilename;
+  if (this->FilePath)
+  {
+    sfilename = this->FilePath;
+    if (sfilename.at(sfilename.length() - 1) != '/')
+    {
+      sfilename += "/";
+    }
+  }
+  sfilename += fileName;
+  return sfilename;
+}
+
+//----------------------------------------------------------------------------
+bool vtkPEnSightReader::GetClosestFileOffset(
+  const char* fileName, int timeStep, int& closestTimeStep, long& offset)
+{
+  if (this->UseTimeStepIndexFiles && this->LoadedFileOffsets.insert(fileName).second)
+  {
+    // The index is only valid for the data file it was written for, as read
+    // by this class.
+    const std::string sfilename = this->GetFullFileName(fileName);
+    vtksys::ifstream file(::GetTimeStepIndexFileName(sfilename).c_str());
+    std::string header, className;
+    unsigned long fileSize;
+    long modifiedTime;
+    if (std::getline(file, header) && header == ::TimeStepIndexHeader &&
+      (file >> className >> fileSize >> modifiedTime) && className == this->GetClassName() &&
+      fileSize == vtksys::SystemTools::FileLength(sfilename) &&
+      modifiedTime == vtksys::SystemTools::ModifiedTime(sfilename))
+    {
+      // the whole index is stale if the data around any offset changed.
+      vtksys::ifstream dataFile(sfilename.c_str(), ios::in | ios::binary);
+      std::map<int, long> offsets;
+      int step;
+      long stepOffset;
+      std::string fingerprint;
+      bool valid = dataFile.good();
+      while (valid && (file >> step >> stepOffset >> fingerprint))
+      {
+        valid = (fingerprint == ::GetOffsetFingerprint(dataFile, stepOffset));
+        offsets.insert(std::make_pair(step, stepOffset));
+      }
+      if (valid)
+      {
+        this->FileOffsets[fileName].insert(offsets.begin(), offsets.end());
+        vtkDebugMacro("Loaded " << offsets.size() << " time step offsets for " << sfilename);
+      }
+      else
+      {
+        vtkDebugMacro("Ignoring stale time step index for " << sfilename);
+      }
+    }
+  }
+
+  auto iter = this->FileOffsets.find(fileName);
+  if (iter == this->FileOffsets.end())
+  {
+    return false;
+  }
+  auto stepIter = iter->second.upper_bound(timeStep);
+  if (stepIter == iter->second.begin())
+  {
+    return false;
+  }
+  --stepIter;
+  closestTimeStep = stepIter->first;
+  offset = stepIter->second;
+  return true;
+}
+
+//----------------------------------------------------------------------------
+void vtkPEnSightReader::SetFileOffset(const char* fileName, int timeStep, long offset)
+{
+  long& value = this->FileOffsets[fileName][timeStep];
+  if (value != offset)
+  {
+    value = offset;
+    this->ModifiedFileOffsets.insert(fileName);
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPEnSightReader::SaveFileOffsets()
+{
+  if (this->UseTimeStepIndexFiles && this->GetMultiProcessLocalProcessId() <= 0)
+  {
+    for (const std::string& fileName : this->ModifiedFileOffsets)
+    {
+      const std::string sfilename = this->GetFullFileName(fileName.c_str());
+      const std::string indexName = ::GetTimeStepIndexFileName(sfilename);
+      const std::string tmpName =
+        indexName + ".tmp" + std::to_string(vtksys::SystemTools::GetTime());
+
+      // write under a temporary name so that other sessions never read a
+      // partially written index.
+      vtksys::ifstream dataFile(sfilename.c_str(), ios::in | ios::binary);
+      vtksys::ofstream file(tmpName.c_str());
+      file << ::TimeStepIndexHeader << "\n"
+           << this->GetClassName() << " " << vtksys::SystemTools::FileLength(sfilename) << " "
+           << vtksys::SystemTools::ModifiedTime(sfilename) << "\n";
+      for (const auto& pair : this->FileOffsets[fileName])
+      {
+        file << pair.first << " " << pair.second << " "
+             << ::GetOffsetFingerprint(dataFile, pair.second) << "\n";
+      }
+      file.close();
+      if (!file || !vtksys::SystemTools::RenameFile(tmpName, indexName))
+      {
+        // the data directory may be read-only, this is not an error.
+        vtksys::SystemTools::RemoveFile(tmpName);
+        vtkDebugMacro("Could not write time step index " << indexName);
+      }
+    }
+  }
+  this->ModifiedFileOffsets.clear();
+}
+
 //----------------------------------------------------------------------------
 void vtkPEnSightReader::PrintSelf(ostream& os, vtkIndent indent)
 {
@@ -27,6 +27,7 @@
 #include "vtkIdTypeArray.h" // For ivars
 #include <algorithm>        // For ivars
 #include <map>              // For ivars
+#include <set>              // For ivars
 #include <string>           // For ivars
 #include <vector>           // For ivars
 
@@ -424,6 +425,66 @@ public:
       return result;
     }
 
+    // Returns true if the local ids are the global ids [first, first + count)
+    // of the n global ids, in the same order, i.e. when the values read by
+    // this process are contiguous in the file.
+    bool GetLocalRange(int n, int& first, int& count)
+    {
+      switch (this->mode)
+      {
+        case SINGLE_PROCESS_MODE:
+        {
+          first = 0;
+          count = n;
+          return n > 0;
+        }
+        case IMPLICIT_STRUCTURED_MODE:
+        {
+          // The split is contiguous if it is along the slowest varying
+          // dimension, ignoring dimensions of size 1.
+          const int dim = this->ImplicitSplitDimension;
+          if (dim == -1)
+            return false;
+          int stride = 1;
+          for (int d = 0; d < 3; d++)
+          {
+            if (d < dim)
+              stride *= this->ImplicitDimensions[d];
+            else if (d > dim && this->ImplicitDimensions[d] != 1)
+              return false;
+          }
+          first = this->ImplicitSplitDimensionBeginIndex * stride;
+          count = (this->ImplicitSplitDimensionEndIndex - this->ImplicitSplitDimensionBeginIndex) *
+            stride;
+          return count > 0 && first + count <= n;
+        }
+        case SPARSE_MODE:
+        {
+          return false;
+        }
+        default:
+        {
+          break;
+        }
+      }
+
+      first = -1;
+      count = 0;
+      const int size = std::min(n, static_cast<int>(this->cellVector->size()));
+      for (int i = 0; i < size; i++)
+      {
+        const int id = (*this->cellVector)[i];
+        if (id == -1)
+          continue;
+        if (first == -1)
+          first = i;
+        if (id != count || i != first + count)
+          return false;
+        count++;
+      }
+      return count > 0 && count == this->GetLocalNumberOfIds();
+    }
+
   protected:
     IntIntMap* cellMap;
     int cellNumberOfIds;
@@ -803,7 +864,36 @@ protected:
 
   int GhostLevels;
 
+  /**
+   * Returns the path of `fileName`, relative to FilePath.
+   */
+  std::string GetFullFileName(const char* fileName);
+
+  /**
+   * Looks for the closest time step, at or before `timeStep`, whose offset in
+   * `fileName` is known. Returns false if there is none; otherwise sets
+   * `closestTimeStep` and `offset`. The index file of `fileName` is loaded on
+   * first use when UseTimeStepIndexFiles is enabled. The index is ignored if
+   * the data file size or modification time changed, or if the bytes around
+   * any of its offsets differ from those recorded when it was written.
+   */
+  bool GetClosestFileOffset(const char* fileName, int timeStep, int& closestTimeStep, long& offset);
+
+  /**
+   * Records the offset of `timeStep` in `fileName`.
+   */
+  void SetFileOffset(const char* fileName, int timeStep, long offset);
+
+  /**
+   * Writes the index files of the files with new offsets, when
+   * UseTimeStepIndexFiles is enabled. Only the first process writes them.
+   */
+  void SaveFileOffsets();
+
   std::map<std::string, std::map<int, long>> FileOffsets;
+  // Files whose index file was looked for, and files with new offsets since.
+  std::set<std::string> LoadedFileOffsets;
+  std::set<std::string> ModifiedFileOffsets;
 
 private:
   vtkPEnSightReader(const vtkPEnSightReader&) = delete;
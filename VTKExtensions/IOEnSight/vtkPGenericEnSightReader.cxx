@@ -33,6 +33,8 @@ vtkPGenericEnSightReader::vtkPGenericEnSightReader()
   // -2 is the default starting value
   this->MultiProcessLocalProcessId = -2;
   this->MultiProcessNumberOfProcesses = -2;
+  this->UseMemoryMapping = false;
+  this->UseTimeStepIndexFiles = false;
 }
 
 //----------------------------------------------------------------------------
@@ -126,6 +128,8 @@ int vtkPGenericEnSightReader::RequestInformation(
   if (reader)
   {
     // this dynamic cast never should fail
+    reader->SetUseMemoryMapping(this->UseMemoryMapping);
+    reader->SetUseTimeStepIndexFiles(this->UseTimeStepIndexFiles);
     reader->RequestInformation(request, inputVector, outputVector);
   }
   this->Reader->SetParticleCoordinatesByIndex(this->ParticleCoordinatesByIndex);
@@ -190,4 +194,6 @@ void vtkPGenericEnSightReader::PrintSelf(ostream& os, vtkIndent indent)
   this->Superclass::PrintSelf(os, indent);
   os << indent << "MultiProcessLocalProcessId: " << this->MultiProcessLocalProcessId << endl;
   os << indent << "MultiProcessNumberOfProcesses: " << this->MultiProcessNumberOfProcesses << endl;
+  os << indent << "UseMemoryMapping: " << this->UseMemoryMapping << endl;
+  os << indent << "UseTimeStepIndexFiles: " << this->UseTimeStepIndexFiles << endl;
 }
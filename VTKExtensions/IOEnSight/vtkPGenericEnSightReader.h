@@ -27,6 +27,32 @@ public:
   vtkTypeMacro(vtkPGenericEnSightReader, vtkGenericEnSightReader);
   void PrintSelf(ostream& os, vtkIndent indent) override;
 
+  ///@{
+  /**
+   * Get/Set whether EnSight Gold binary files are memory mapped instead of
+   * being read through a stream when read in parallel. See
+   * vtkPEnSightGoldBinaryReader. This has no effect with a single process,
+   * where the serial readers are used. Default is false.
+   */
+  vtkSetMacro(UseMemoryMapping, bool);
+  vtkGetMacro(UseMemoryMapping, bool);
+  vtkBooleanMacro(UseMemoryMapping, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Get/Set whether the byte offsets of the time steps found in transient
+   * single files (file sets) are saved to index files, when read in
+   * parallel. The first process writes `<file>.stepindex` next to each data
+   * file, and later sessions read it back to reach any indexed time step with
+   * a single seek instead of scanning the file. Index files are ignored when
+   * their data file changed. Default is false.
+   */
+  vtkSetMacro(UseTimeStepIndexFiles, bool);
+  vtkGetMacro(UseTimeStepIndexFiles, bool);
+  vtkBooleanMacro(UseTimeStepIndexFiles, bool);
+  ///@}
+
 protected:
   vtkPGenericEnSightReader();
   ~vtkPGenericEnSightReader() override;
@@ -45,6 +71,9 @@ protected:
   int MultiProcessLocalProcessId;
   int MultiProcessNumberOfProcesses;
 
+  bool UseMemoryMapping;
+  bool UseTimeStepIndexFiles;
+
 private:
   vtkPGenericEnSightReader(const vtkPGenericEnSightReader&) = delete;
   void operator=(const vtkPGenericEnSightReader&) = delete;
@@ -0,0 +1,173 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCellData.h"
+#include "vtkCompositeDataIterator.h"
+#include "vtkCompositeDataSet.h"
+#include "vtkDataArray.h"
+#include "vtkDataSet.h"
+#include "vtkDummyController.h"
+#include "vtkLogger.h"
+#include "vtkMPIController.h"
+#include "vtkNew.h"
+#include "vtkSmartPointer.h"
+#include "vtkSpyPlotReader.h"
+#include "vtkTestUtilities.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <map>
+#include <set>
+#include <vector>
+
+namespace
+{
+// Bounds, number of cells and sum of the cell arrays of each block.
+const int RecordSize = 8;
+
+// Reads the file with `controller` and returns the records of the blocks of
+// this process.
+std::vector<double> ReadBlocks(const char* fname, vtkMultiProcessController* controller)
+{
+  vtkNew<vtkSpyPlotReader> reader;
+  reader->SetGlobalController(controller);
+  reader->SetFileName(fname);
+  reader->Update();
+
+  std::vector<double> records;
+  auto cds = vtkCompositeDataSet::SafeDownCast(reader->GetOutputDataObject(0));
+  if (!cds)
+  {
+    return records;
+  }
+  vtkSmartPointer<vtkCompositeDataIterator> iter;
+  iter.TakeReference(cds->NewIterator());
+  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+  {
+    auto ds = vtkDataSet::SafeDownCast(iter->GetCurrentDataObject());
+    if (!ds)
+    {
+      continue;
+    }
+    double bounds[6];
+    ds->GetBounds(bounds);
+    double sum = 0.0;
+    vtkCellData* cd = ds->GetCellData();
+    for (int i = 0; i < cd->GetNumberOfArrays(); ++i)
+    {
+      vtkDataArray* array = cd->GetArray(i);
+      for (vtkIdType tuple = 0; array && tuple < array->GetNumberOfTuples(); ++tuple)
+      {
+        for (int comp = 0; comp < array->GetNumberOfComponents(); ++comp)
+        {
+          sum += array->GetComponent(tuple, comp);
+        }
+      }
+    }
+    records.insert(records.end(), bounds, bounds + 6);
+    records.push_back(static_cast<double>(ds->GetNumberOfCells()));
+    records.push_back(sum);
+  }
+  return records;
+}
+
+using BlockKey = std::array<double, 6>;
+
+BlockKey GetKey(const double* record)
+{
+  BlockKey key;
+  std::copy(record, record + 6, key.begin());
+  return key;
+}
+
+// Checks that the blocks read in parallel are those read in serial, each
+// one read by a single process with the same values.
+bool Compare(const std::vector<double>& serial, const std::vector<double>& parallel)
+{
+  std::map<BlockKey, const double*> expected;
+  for (size_t cc = 0; cc < serial.size(); cc += RecordSize)
+  {
+    expected[GetKey(&serial[cc])] = &serial[cc];
+  }
+  if (expected.empty() || expected.size() * RecordSize != serial.size())
+  {
+    vtkLogF(ERROR, "Unexpected serial blocks.");
+    return false;
+  }
+
+  std::set<BlockKey> found;
+  for (size_t cc = 0; cc < parallel.size(); cc += RecordSize)
+  {
+    const BlockKey key = GetKey(&parallel[cc]);
+    auto iter = expected.find(key);
+    if (iter == expected.end())
+    {
+      vtkLogF(ERROR, "Block read in parallel is not read in serial.");
+      return false;
+    }
+    if (!found.insert(key).second)
+    {
+      vtkLogF(ERROR, "Block read by more than one process.");
+      return false;
+    }
+    if (iter->second[6] != parallel[cc + 6] || iter->second[7] != parallel[cc + 7])
+    {
+      vtkLogF(ERROR, "Block values differ: %g cells, sum %g instead of %g cells, sum %g.",
+        parallel[cc + 6], parallel[cc + 7], iter->second[6], iter->second[7]);
+      return false;
+    }
+  }
+  if (found.size() != expected.size())
+  {
+    vtkLogF(ERROR, "Read %d blocks in parallel instead of %d.", static_cast<int>(found.size()),
+      static_cast<int>(expected.size()));
+    return false;
+  }
+  return true;
+}
+}
+
+int TestSpyPlotBlockDistribution(int argc, char* argv[])
+{
+  vtkNew<vtkMPIController> controller;
+  controller->Initialize(&argc, &argv);
+  vtkMultiProcessController::SetGlobalController(controller);
+  const int rank = controller->GetLocalProcessId();
+  const int numRanks = controller->GetNumberOfProcesses();
+
+  char* fname = vtkTestUtilities::ExpandDataFileName(
+    argc, argv, "Testing/Data/SPCTH/Dave_Karelitz_Small/spcth_a.0");
+
+  // blocks are distributed over all processes.
+  std::vector<double> local = ReadBlocks(fname, controller);
+  vtkIdType localSize = static_cast<vtkIdType>(local.size());
+  std::vector<vtkIdType> sizes(numRanks, 0);
+  controller->Gather(&localSize, sizes.data(), 1, 0);
+  std::vector<vtkIdType> offsets(numRanks, 0);
+  for (int cc = 1; cc < numRanks; ++cc)
+  {
+    offsets[cc] = offsets[cc - 1] + sizes[cc - 1];
+  }
+  std::vector<double> parallel(offsets.back() + sizes.back());
+  controller->GatherV(local.data(), parallel.data(), localSize, sizes.data(), offsets.data(), 0);
+
+  int success = 1;
+  if (rank == 0)
+  {
+    // the same file read by this process alone.
+    vtkNew<vtkDummyController> serialController;
+    const std::vector<double> serial = ReadBlocks(fname, serialController);
+    success = Compare(serial, parallel) ? 1 : 0;
+    if (success && numRanks > 1 && local.size() == serial.size())
+    {
+      vtkLogF(ERROR, "All the blocks were read by the first process.");
+      success = 0;
+    }
+  }
+  controller->Broadcast(&success, 1, 0);
+  delete[] fname;
+
+  vtkMultiProcessController::SetGlobalController(nullptr);
+  controller->Finalize();
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,192 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkDataArraySelection.h"
+#include "vtkLogger.h"
+#include "vtkMultiProcessStream.h"
+#include "vtkNew.h"
+#include "vtkSpyPlotReader.h"
+#include "vtkSpyPlotReaderMap.h"
+#include "vtkSpyPlotUniReader.h"
+#include "vtkTestUtilities.h"
+
+#include <vtksys/FStream.hxx>
+#include <vtksys/SystemTools.hxx>
+
+#include <cstdlib>
+#include <map>
+#include <sstream>
+#include <string>
+
+#define VERIFY(x, ...)                                                                             \
+  if (!(x))                                                                                        \
+  {                                                                                                \
+    vtkLogF(ERROR, __VA_ARGS__);                                                                   \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+namespace
+{
+const int NumberOfFiles = 4;
+
+// Deletes the readers of the map.
+struct ReaderMap : public vtkSpyPlotReaderMap
+{
+  ~ReaderMap() { this->Clean(nullptr); }
+};
+
+// Describes what ReadInformation() gives for each time step of a file.
+std::string Describe(vtkSpyPlotUniReader* reader)
+{
+  std::ostringstream description;
+  int range[2];
+  reader->GetTimeStepRange(range);
+  description << "AMR " << reader->IsAMR() << " materials " << reader->GetNumberOfMaterials()
+              << " dimensions " << reader->GetNumberOfDimensions() << "\n";
+  for (int step = range[0]; step <= range[1]; ++step)
+  {
+    reader->SetCurrentTimeStep(step);
+    description << "time " << reader->GetTimeFromTimeStep(step) << " blocks "
+                << reader->GetNumberOfDataBlocks() << " fields";
+    for (int field = 0; reader->GetCellFieldName(field); ++field)
+    {
+      description << " " << reader->GetCellFieldName(field);
+    }
+    description << "\n";
+  }
+  return description.str();
+}
+
+// Describes a file read from disk.
+std::string DescribeFile(const std::string& fname)
+{
+  vtkNew<vtkDataArraySelection> selection;
+  vtkNew<vtkSpyPlotUniReader> reader;
+  reader->SetCellArraySelection(selection);
+  reader->SetFileName(fname.c_str());
+  return reader->ReadInformation() ? Describe(reader) : std::string();
+}
+
+// Returns the number of files whose meta-data is in a stream from Save().
+int GetNumberOfSavedMetaData(vtkMultiProcessStream stream)
+{
+  int magicNumber;
+  int numberOfFiles;
+  stream >> magicNumber >> numberOfFiles;
+  for (int cc = 0; cc < numberOfFiles; ++cc)
+  {
+    std::string fname;
+    stream >> fname;
+  }
+  int count;
+  stream >> count;
+  return count;
+}
+
+std::string GetFileName(const std::string& directory, const std::string& series, int index)
+{
+  return directory + "/" + series + "." + std::to_string(index);
+}
+
+// Copies a series into `directory`, keeping the modification times.
+void CopySeries(const std::string& dataDirectory, const std::string& directory,
+  const std::string& series)
+{
+  for (int cc = 0; cc < NumberOfFiles; ++cc)
+  {
+    const std::string source = GetFileName(dataDirectory, series, cc);
+    const std::string target = GetFileName(directory, series, cc);
+    vtksys::SystemTools::CopyAFile(source, target);
+    vtksys::SystemTools::CopyFileTime(source, target);
+  }
+}
+}
+
+int TestSpyPlotMetaDataCache(int argc, char* argv[])
+{
+  char* fname = vtkTestUtilities::ExpandDataFileName(
+    argc, argv, "Testing/Data/SPCTH/Dave_Karelitz_Small/spcth_a.0");
+  const std::string dataDirectory = vtksys::SystemTools::GetFilenamePath(fname);
+  delete[] fname;
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  const std::string directory = std::string(tempDir) + "/TestSpyPlotMetaDataCache";
+  delete[] tempDir;
+  vtksys::SystemTools::RemoveADirectory(directory);
+  vtksys::SystemTools::MakeDirectory(directory);
+
+  // two series of files, read as two time steps of a file series.
+  std::map<std::string, std::string> expected;
+  for (const char* series : { "spcth_a", "spcth" })
+  {
+    CopySeries(dataDirectory, directory, series);
+    for (int cc = 0; cc < NumberOfFiles; ++cc)
+    {
+      const std::string name = GetFileName(directory, series, cc);
+      expected[name] = DescribeFile(name);
+      VERIFY(!expected[name].empty(), "Cannot read %s.", name.c_str());
+    }
+  }
+
+  // the map of the root node reads the headers, the map of another node gets
+  // them from the stream.
+  vtkNew<vtkSpyPlotReader> parent;
+  ReaderMap root;
+  ReaderMap node;
+  auto update = [&](const std::string& series) {
+    vtkMultiProcessStream stream;
+    root.Initialize(GetFileName(directory, series, 0).c_str());
+    root.UpdateMetaData(parent);
+    root.Save(stream);
+    vtkMultiProcessStream copy(stream);
+    node.Load(copy);
+    return stream;
+  };
+  auto check = [&]() {
+    const int numberOfFiles = static_cast<int>(node.Files.size());
+    VERIFY(numberOfFiles == NumberOfFiles, "Expected %d files, got %d.", NumberOfFiles,
+      numberOfFiles);
+    for (auto iter = node.Files.begin(); iter != node.Files.end(); ++iter)
+    {
+      VERIFY(Describe(node.GetReader(iter, parent)) == expected[iter->first],
+        "Meta-data of %s differs from the file.", iter->first.c_str());
+    }
+    return EXIT_SUCCESS;
+  };
+
+  // first time step: the meta-data of all the files is shared. The files are
+  // removed so that the other node can only use the shared meta-data.
+  vtkMultiProcessStream stream = update("spcth_a");
+  VERIFY(GetNumberOfSavedMetaData(stream) == NumberOfFiles, "Expected %d shared meta-data.",
+    NumberOfFiles);
+  for (int cc = 0; cc < NumberOfFiles; ++cc)
+  {
+    vtksys::SystemTools::RemoveFile(GetFileName(directory, "spcth_a", cc));
+  }
+  VERIFY(check() == EXIT_SUCCESS, "First time step failed.");
+
+  // second time step: new files.
+  stream = update("spcth");
+  VERIFY(GetNumberOfSavedMetaData(stream) == NumberOfFiles, "Expected %d shared meta-data.",
+    NumberOfFiles);
+  VERIFY(check() == EXIT_SUCCESS, "Second time step failed.");
+
+  // back to the first time step: the same files again, nothing to share.
+  CopySeries(dataDirectory, directory, "spcth_a");
+  stream = update("spcth_a");
+  VERIFY(GetNumberOfSavedMetaData(stream) == 0, "Cached meta-data was shared again.");
+  VERIFY(check() == EXIT_SUCCESS, "Cached time step failed.");
+
+  // a modified file is read again, and only its meta-data is shared.
+  const std::string modified = GetFileName(directory, "spcth_a", 1);
+  {
+    vtksys::ofstream file(modified.c_str(), std::ios::out | std::ios::binary | std::ios::app);
+    file << std::string(16, '\0');
+  }
+  expected[modified] = DescribeFile(modified);
+  stream = update("spcth_a");
+  VERIFY(GetNumberOfSavedMetaData(stream) == 1, "Expected the meta-data of the modified file.");
+  VERIFY(check() == EXIT_SUCCESS, "Modified time step failed.");
+
+  vtksys::SystemTools::RemoveADirectory(directory);
+  return EXIT_SUCCESS;
+}
@@ -1,8 +1,13 @@
 // SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkSpyPlotBlockIterator.h"
+#include "vtkCommunicator.h"
+#include "vtkMultiProcessController.h"
 #include "vtkSpyPlotReader.h"
+
+#include <algorithm>
 #include <cassert>
+#include <vector>
 
 vtkSpyPlotBlockIterator::vtkSpyPlotBlockIterator()
 {
@@ -45,16 +50,19 @@ void vtkSpyPlotBlockDistributionBlockIterator::Start()
 
 int vtkSpyPlotBlockDistributionBlockIterator::GetNumberOfBlocksToProcess()
 {
-  // When distributing blocks, each process is as such
-  // going to read each file, so it's okay if this method
-  // creates reader for all files and reads information from them.
-  int total_num_blocks = 0;
+  // The number of data blocks of each file is part of its header. The size of
+  // each block needs the block headers: they are read by a single process per
+  // file and shared with the others, which only read the block headers of the
+  // files they have blocks in.
+  std::vector<int> firstBlock(this->NumberOfFiles + 1, 0);
+  std::vector<vtkSpyPlotUniReader*> readers(this->NumberOfFiles, nullptr);
   vtkSpyPlotReaderMap::MapOfStringToSPCTH::iterator fileIterator;
   fileIterator = this->FileMap->Files.begin();
   size_t numFiles = this->FileMap->Files.size();
   int cur_file = 1;
   int progressInterval = (int)(numFiles / 20 + 1);
-  for (; fileIterator != this->FileMap->Files.end(); fileIterator++, cur_file++)
+  for (int fileIndex = 0; fileIterator != this->FileMap->Files.end();
+       fileIterator++, cur_file++, fileIndex++)
   {
     if (!(cur_file % progressInterval))
     {
@@ -63,27 +71,95 @@ int vtkSpyPlotBlockDistributionBlockIterator::GetNumberOfBlocksToProcess()
     }
     vtkSpyPlotUniReader* reader = this->FileMap->GetReader(fileIterator, this->Parent);
     reader->ReadInformation();
-    if (!reader->SetCurrentTimeStep(this->CurrentTimeStep))
+    firstBlock[fileIndex + 1] = firstBlock[fileIndex];
+    // Skip the readers that do not have the requested time step
+    if (reader->SetCurrentTimeStep(this->CurrentTimeStep))
     {
-      // This reader does not have that time step so skip it
-      continue;
+      readers[fileIndex] = reader;
+      firstBlock[fileIndex + 1] += reader->GetNumberOfDataBlocks();
     }
+  }
 
-    int numBlocks = reader->GetNumberOfDataBlocks();
-    int numBlocksPerProcess = (numBlocks / this->NumberOfProcessors);
-    int leftOverBlocks = numBlocks - (numBlocksPerProcess * this->NumberOfProcessors);
-    if (this->ProcessorId < leftOverBlocks)
+  std::vector<vtkIdType> localNumberOfCells(firstBlock.back(), 0);
+  std::vector<vtkIdType> blockNumberOfCells;
+  for (int fileIndex = this->ProcessorId; fileIndex < this->NumberOfFiles;
+       fileIndex += this->NumberOfProcessors)
+  {
+    const int numBlocks = firstBlock[fileIndex + 1] - firstBlock[fileIndex];
+    if (numBlocks > 0 && readers[fileIndex]->GetDataBlocksNumberOfCells(blockNumberOfCells) &&
+      static_cast<int>(blockNumberOfCells.size()) == numBlocks)
     {
-      total_num_blocks += numBlocksPerProcess + 1;
+      std::copy(blockNumberOfCells.begin(), blockNumberOfCells.end(),
+        localNumberOfCells.begin() + firstBlock[fileIndex]);
     }
-    else
+  }
+
+  std::vector<vtkIdType> numberOfCells(localNumberOfCells);
+  vtkMultiProcessController* controller = this->Parent->GetGlobalController();
+  if (controller && this->NumberOfProcessors > 1 && !numberOfCells.empty())
+  {
+    controller->AllReduce(localNumberOfCells.data(), numberOfCells.data(),
+      static_cast<vtkIdType>(numberOfCells.size()), vtkCommunicator::MAX_OP);
+  }
+
+  int total_num_blocks = 0;
+  this->NumberOfCells.resize(this->NumberOfFiles);
+  for (int fileIndex = 0; fileIndex < this->NumberOfFiles; ++fileIndex)
+  {
+    this->NumberOfCells[fileIndex].assign(numberOfCells.begin() + firstBlock[fileIndex],
+      numberOfCells.begin() + firstBlock[fileIndex + 1]);
+
+    int blockStart;
+    int blockEnd;
+    if (this->GetBlockRange(fileIndex, blockStart, blockEnd))
     {
-      total_num_blocks += numBlocksPerProcess;
+      total_num_blocks += blockEnd - blockStart + 1;
     }
   }
   return total_num_blocks;
 }
 
+bool vtkSpyPlotBlockDistributionBlockIterator::GetBlockRange(
+  int fileIndex, int& blockStart, int& blockEnd) const
+{
+  assert("pre: blocks_counted" &&
+    static_cast<int>(this->NumberOfCells.size()) == this->NumberOfFiles);
+  const std::vector<vtkIdType>& numberOfCells = this->NumberOfCells[fileIndex];
+  const int numBlocks = static_cast<int>(numberOfCells.size());
+  vtkIdType totalNumberOfCells = 0;
+  for (vtkIdType count : numberOfCells)
+  {
+    totalNumberOfCells += count;
+  }
+
+  // Each block goes to the process owning the middle of its cells in the
+  // running cell count, so that all processes get contiguous ranges of about
+  // the same number of cells, whatever the sizes of the blocks. The blocks are
+  // split by count when their sizes are unknown.
+  blockStart = numBlocks;
+  blockEnd = numBlocks - 1;
+  vtkIdType cellOffset = 0;
+  for (int block = 0; block < numBlocks; ++block)
+  {
+    double middle = block + 0.5;
+    double total = numBlocks;
+    if (totalNumberOfCells > 0)
+    {
+      middle = cellOffset + 0.5 * numberOfCells[block];
+      total = static_cast<double>(totalNumberOfCells);
+    }
+    cellOffset += numberOfCells[block];
+    const int owner = std::min(
+      static_cast<int>(middle * this->NumberOfProcessors / total), this->NumberOfProcessors - 1);
+    if (owner == this->ProcessorId)
+    {
+      blockStart = std::min(blockStart, block);
+      blockEnd = block;
+    }
+  }
+  return blockStart <= blockEnd;
+}
+
 void vtkSpyPlotBlockDistributionBlockIterator::FindFirstBlockOfCurrentOrNextFile()
 {
   this->Active = this->FileIndex < this->NumberOfFiles;
@@ -99,30 +175,12 @@ void vtkSpyPlotBlockDistributionBlockIterator::FindFirstBlockOfCurrentOrNextFile
     {
       this->NumberOfFields = this->UniReader->GetNumberOfCellFields();
 
-      int numBlocks = this->UniReader->GetNumberOfDataBlocks();
-
-      if (this->ProcessorId < numBlocks) // otherwise skip to the next file
+      // Only decode the fields of the blocks of this process
+      bool hasBlocks = this->GetBlockRange(this->FileIndex, this->Block, this->BlockEnd);
+      this->UniReader->SetDataBlockRange(this->Block, this->BlockEnd);
+      if (hasBlocks) // otherwise skip to the next file
       {
-        int numBlocksPerProcess = numBlocks / this->NumberOfProcessors;
-        int leftOverBlocks = numBlocks - (numBlocksPerProcess * this->NumberOfProcessors);
-
-        int blockStart;
-
-        if (this->ProcessorId < leftOverBlocks)
-        {
-          blockStart = (numBlocksPerProcess + 1) * this->ProcessorId;
-          this->BlockEnd = blockStart + (numBlocksPerProcess + 1) - 1;
-        }
-        else
-        {
-          blockStart = numBlocksPerProcess * this->ProcessorId + leftOverBlocks;
-          this->BlockEnd = blockStart + numBlocksPerProcess - 1;
-        }
-        this->Block = blockStart;
-        if (this->Block <= this->BlockEnd)
-        {
-          break; // Done
-        }
+        break; // Done
       }
     }
     ++this->FileIterator;
@@ -246,6 +304,7 @@ void vtkSpyPlotFileDistributionBlockIterator::FindFirstBlockOfCurrentOrNextFile(
 
       this->BlockEnd = numberOfBlocks - 1;
       this->Block = 0;
+      this->UniReader->SetDataBlockRange(this->Block, this->BlockEnd);
       if (this->Block <= this->BlockEnd)
       {
         break;
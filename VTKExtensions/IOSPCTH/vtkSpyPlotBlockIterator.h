@@ -8,6 +8,7 @@
 #include "vtkSpyPlotUniReader.h"             // for vtkSpyPlotUniReader
 
 #include <cassert> // for assert
+#include <vector>  // for std::vector
 
 class vtkSpyPlotReader;
 
@@ -104,6 +105,19 @@ public:
 
 protected:
   void FindFirstBlockOfCurrentOrNextFile() override;
+
+  /**
+   * Computes the range of data blocks of the file `fileIndex` assigned to this
+   * process. The blocks of each file are split into contiguous ranges holding
+   * about the same number of cells. Returns false if no block is assigned to
+   * this process.
+   */
+  bool GetBlockRange(int fileIndex, int& blockStart, int& blockEnd) const;
+
+  // Number of cells of the data blocks of each file at the current time step.
+  // Filled by GetNumberOfBlocksToProcess(), which must be called on all
+  // processes before Start().
+  std::vector<std::vector<vtkIdType>> NumberOfCells;
 };
 
 class VTKPVVTKEXTENSIONSIOSPCTH_EXPORT vtkSpyPlotFileDistributionBlockIterator
@@ -309,8 +309,11 @@ int vtkSpyPlotReader::UpdateFile(vtkInformation* request, vtkInformationVector*
   // nodes.
   if (procId == 0)
   {
-    // Clean Map and initialize it with the given file.
+    // Clean Map and initialize it with the given file. Then read the headers
+    // of the files that are new or changed since the previous time, so that
+    // the other nodes do not need to.
     this->Map->Initialize(this->FileName);
+    this->Map->UpdateMetaData(this);
   }
   if (numProcs > 1)
   {
@@ -205,12 +205,15 @@ public:
   void SetCellArrayStatus(const char* name, int status);
   ///@}
 
+  ///@{
   /**
    * Set the controller used to coordinate parallel reading.
    * The "global controller" has all processes while the
    * "controller" has only those who have blocks.
    */
   void SetGlobalController(vtkMultiProcessController* controller);
+  vtkGetObjectMacro(GlobalController, vtkMultiProcessController);
+  ///@}
 
   /**
    * Determine if the file can be read with this reader.
@@ -9,6 +9,8 @@
 #include "vtksys/SystemTools.hxx"
 
 #include <cassert>
+#include <string>
+#include <utility>
 
 namespace
 {
@@ -37,6 +39,12 @@ bool HasNumericalExtension(const char* filename, int& number)
   }
   return false;
 }
+
+std::string GetFileSignature(const std::string& filename)
+{
+  return std::to_string(vtksys::SystemTools::FileLength(filename)) + " " +
+    std::to_string(vtksys::SystemTools::ModifiedTime(filename));
+}
 }
 
 //-----------------------------------------------------------------------------
@@ -55,6 +63,39 @@ void vtkSpyPlotReaderMap::Clean(vtkSpyPlotUniReader* save)
   this->Files.erase(this->Files.begin(), end);
 }
 
+//-----------------------------------------------------------------------------
+void vtkSpyPlotReaderMap::UpdateMetaData(vtkSpyPlotReader* parent)
+{
+  this->PruneMetaData();
+  for (MapOfStringToSPCTH::iterator iter = this->Files.begin(); iter != this->Files.end(); ++iter)
+  {
+    const std::string signature = ::GetFileSignature(iter->first);
+    auto cached = this->MetaData.find(iter->first);
+    if (cached != this->MetaData.end())
+    {
+      if (cached->second.Signature == signature)
+      {
+        continue;
+      }
+      // the file changed, forget about the old meta-data and its reader
+      this->MetaData.erase(cached);
+      if (iter->second)
+      {
+        iter->second->Delete();
+        iter->second = nullptr;
+      }
+    }
+
+    std::string data;
+    if (this->GetReader(iter, parent)->GetMetaData(data))
+    {
+      FileMetaData& metaData = this->MetaData[iter->first];
+      metaData.Signature = signature;
+      metaData.Data = std::move(data);
+    }
+  }
+}
+
 //-----------------------------------------------------------------------------
 bool vtkSpyPlotReaderMap::Save(vtkMultiProcessStream& stream)
 {
@@ -63,6 +104,25 @@ bool vtkSpyPlotReaderMap::Save(vtkMultiProcessStream& stream)
   {
     stream << iter->first;
   }
+
+  // only send the meta-data that the other nodes do not have yet.
+  int count = 0;
+  for (const auto& item : this->MetaData)
+  {
+    count += item.second.Shared ? 0 : 1;
+  }
+  stream << count;
+  for (auto& item : this->MetaData)
+  {
+    if (!item.second.Shared)
+    {
+      std::string& data = item.second.Data;
+      stream << item.first << item.second.Signature;
+      stream.Push(
+        reinterpret_cast<unsigned char*>(&data[0]), static_cast<unsigned int>(data.size()));
+      item.second.Shared = true;
+    }
+  }
   return true;
 }
 
@@ -79,9 +139,44 @@ bool vtkSpyPlotReaderMap::Load(vtkMultiProcessStream& stream)
     stream >> fname;
     this->Files[fname] = nullptr;
   }
+
+  int count;
+  stream >> count;
+  for (int cc = 0; cc < count; cc++)
+  {
+    std::string fname;
+    FileMetaData metaData;
+    unsigned char* data = nullptr;
+    unsigned int length = 0;
+    stream >> fname >> metaData.Signature;
+    stream.Pop(data, length);
+    metaData.Data.assign(reinterpret_cast<char*>(data), length);
+    delete[] data;
+    metaData.Shared = true;
+    this->MetaData[fname] = std::move(metaData);
+  }
+  this->PruneMetaData();
   return true;
 }
 
+//-----------------------------------------------------------------------------
+void vtkSpyPlotReaderMap::PruneMetaData()
+{
+  // all the nodes have the same files, so they forget the same meta-data and
+  // Save() sends it again if a file comes back.
+  for (auto iter = this->MetaData.begin(); iter != this->MetaData.end();)
+  {
+    if (this->Files.find(iter->first) == this->Files.end())
+    {
+      iter = this->MetaData.erase(iter);
+    }
+    else
+    {
+      ++iter;
+    }
+  }
+}
+
 //-----------------------------------------------------------------------------
 bool vtkSpyPlotReaderMap::Initialize(const char* filename)
 {
@@ -128,6 +223,17 @@ vtkSpyPlotUniReader* vtkSpyPlotReaderMap::GetReader(
     it->second = vtkSpyPlotUniReader::New();
     it->second->SetCellArraySelection(parent->GetCellDataArraySelection());
     it->second->SetFileName(it->first.c_str());
+
+    auto cached = this->MetaData.find(it->first);
+    if (cached != this->MetaData.end() && !it->second->SetMetaData(cached->second.Data))
+    {
+      // start over with a clean reader, that will read the file itself.
+      this->MetaData.erase(cached);
+      it->second->Delete();
+      it->second = vtkSpyPlotUniReader::New();
+      it->second->SetCellArraySelection(parent->GetCellDataArraySelection());
+      it->second->SetFileName(it->first.c_str());
+    }
     // cout << parent->GetController()->GetLocalProcessId()
     // << "Create reader: " << it->second << endl;
   }
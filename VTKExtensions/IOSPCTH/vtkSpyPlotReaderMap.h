@@ -40,10 +40,33 @@ public:
   vtkSpyPlotUniReader* GetReader(MapOfStringToSPCTH::iterator& it, vtkSpyPlotReader* parent);
   void TellReadersToCheck(vtkSpyPlotReader* parent);
 
+  // Reads the meta-data of the files that are not cached yet, or that
+  // changed on disk since they were cached. This is meant to be called on
+  // the 0th node only, before Save() shares the new meta-data with the other
+  // nodes. Readers created by GetReader() use the cached meta-data instead of
+  // reading the headers of their file.
+  void UpdateMetaData(vtkSpyPlotReader* parent);
+
   bool Save(vtkMultiProcessStream& stream);
   bool Load(vtkMultiProcessStream& stream);
 
 private:
+  // Meta-data of a file, see vtkSpyPlotUniReader::GetMetaData().
+  struct FileMetaData
+  {
+    std::string Signature; // size and modification time of the file
+    std::string Data;
+    bool Shared = false; // whether Save() has sent it already
+  };
+
+  // Meta-data indexed by file name. Unlike Files, it is kept by Clean() so
+  // that it is reused across time steps of file series.
+  std::map<std::string, FileMetaData> MetaData;
+
+  // Forgets the meta-data of the files that are not in Files anymore, so that
+  // MetaData does not grow as other files are opened.
+  void PruneMetaData();
+
   /**
    * This does the updating of the meta data of the case file. Similar to
    * InitializeFromCaseFile, this method builds the vtkSpyPlotReaderMap using the
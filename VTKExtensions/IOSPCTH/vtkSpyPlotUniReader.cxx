@@ -7,6 +7,7 @@
 #include "vtkFloatArray.h"
 #include "vtkIntArray.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 #include "vtkSpyPlotBlock.h"
 #include "vtkSpyPlotIStream.h"
 #include "vtkUnsignedCharArray.h"
@@ -14,7 +15,13 @@
 #include "vtksys/FStream.hxx"
 #include "vtksys/RegularExpression.hxx"
 
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <map>
 #include <sstream>
+#include <streambuf>
+#include <utility>
 #include <vector>
 
 //=============================================================================
@@ -43,6 +50,188 @@ inline ostream& operator<<(ostream& os, const vtkSpyPlotWriteString& c)
   return os;
 }
 
+namespace
+{
+// Stream buffer over the parts of a file read while parsing its meta-data.
+// When created with the file, reads go through to the file and the byte
+// ranges that are read are recorded. When created without file, the recorded
+// ranges are restored with Deserialize() and reads are served from memory.
+class vtkSpyPlotMetaDataBuffer : public std::streambuf
+{
+public:
+  explicit vtkSpyPlotMetaDataBuffer(std::streambuf* file)
+    : File(file)
+  {
+  }
+
+  std::string Serialize() const
+  {
+    std::string data;
+    for (const auto& range : this->Ranges)
+    {
+      const vtkTypeInt64 header[2] = { range.first,
+        static_cast<vtkTypeInt64>(range.second.size()) };
+      data.append(reinterpret_cast<const char*>(header), sizeof(header));
+      data.append(range.second);
+    }
+    return data;
+  }
+
+  bool Deserialize(const std::string& data)
+  {
+    this->Ranges.clear();
+    size_t pos = 0;
+    vtkTypeInt64 header[2];
+    while (pos + sizeof(header) <= data.size())
+    {
+      memcpy(header, data.data() + pos, sizeof(header));
+      pos += sizeof(header);
+      if (header[0] < 0 || header[1] < 0 || static_cast<size_t>(header[1]) > data.size() - pos)
+      {
+        return false;
+      }
+      this->Ranges[header[0]] = data.substr(pos, static_cast<size_t>(header[1]));
+      pos += static_cast<size_t>(header[1]);
+    }
+    return pos == data.size();
+  }
+
+protected:
+  std::streamsize xsgetn(char* s, std::streamsize n) override
+  {
+    std::streamsize count = 0;
+    if (this->File)
+    {
+      // avoid seeking the file, which drops its buffer, for sequential reads
+      if (this->FilePosition != this->Position)
+      {
+        if (this->File->pubseekpos(this->Position, std::ios_base::in) == pos_type(off_type(-1)))
+        {
+          return 0;
+        }
+        this->FilePosition = this->Position;
+      }
+      count = this->File->sgetn(s, n);
+      this->Record(this->Position, s, count);
+      this->FilePosition += count;
+      this->Position += count;
+      return count;
+    }
+
+    while (count < n)
+    {
+      auto iter = this->Ranges.upper_bound(this->Position);
+      if (iter == this->Ranges.begin())
+      {
+        break;
+      }
+      --iter;
+      const vtkTypeInt64 offset = this->Position - iter->first;
+      const vtkTypeInt64 available = static_cast<vtkTypeInt64>(iter->second.size()) - offset;
+      if (available <= 0)
+      {
+        break;
+      }
+      const std::streamsize size = std::min<std::streamsize>(n - count, available);
+      memcpy(s + count, iter->second.data() + offset, size);
+      count += size;
+      this->Position += size;
+    }
+    return count;
+  }
+
+  int_type underflow() override
+  {
+    const vtkTypeInt64 position = this->Position;
+    const int_type c = this->uflow();
+    this->Position = position;
+    return c;
+  }
+
+  int_type uflow() override
+  {
+    char c;
+    return this->xsgetn(&c, 1) == 1 ? traits_type::to_int_type(c) : traits_type::eof();
+  }
+
+  pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode) override
+  {
+    vtkTypeInt64 position = off;
+    if (dir == std::ios_base::cur)
+    {
+      position += this->Position;
+    }
+    else if (dir == std::ios_base::end)
+    {
+      if (!this->File)
+      {
+        return pos_type(off_type(-1));
+      }
+      this->FilePosition = this->File->pubseekoff(0, std::ios_base::end, std::ios_base::in);
+      position += this->FilePosition;
+    }
+    if (position < 0)
+    {
+      return pos_type(off_type(-1));
+    }
+    this->Position = position;
+    return pos_type(off_type(position));
+  }
+
+  pos_type seekpos(pos_type pos, std::ios_base::openmode which) override
+  {
+    return this->seekoff(off_type(pos), std::ios_base::beg, which);
+  }
+
+private:
+  // Adds a range read from the file, merging it with the overlapping and
+  // adjacent ranges.
+  void Record(vtkTypeInt64 offset, const char* data, std::streamsize size)
+  {
+    if (size <= 0)
+    {
+      return;
+    }
+    std::string bytes(data, static_cast<size_t>(size));
+    vtkTypeInt64 end = offset + size;
+    auto iter = this->Ranges.upper_bound(offset);
+    if (iter != this->Ranges.begin())
+    {
+      auto previous = std::prev(iter);
+      const vtkTypeInt64 previousEnd =
+        previous->first + static_cast<vtkTypeInt64>(previous->second.size());
+      if (previousEnd >= offset)
+      {
+        bytes = previous->second.substr(0, static_cast<size_t>(offset - previous->first)) + bytes;
+        if (previousEnd > end)
+        {
+          bytes += previous->second.substr(static_cast<size_t>(end - previous->first));
+          end = previousEnd;
+        }
+        offset = previous->first;
+        this->Ranges.erase(previous);
+      }
+    }
+    while (iter != this->Ranges.end() && iter->first <= end)
+    {
+      const vtkTypeInt64 nextEnd = iter->first + static_cast<vtkTypeInt64>(iter->second.size());
+      if (nextEnd > end)
+      {
+        bytes += iter->second.substr(static_cast<size_t>(end - iter->first));
+        end = nextEnd;
+      }
+      iter = this->Ranges.erase(iter);
+    }
+    this->Ranges[offset] = std::move(bytes);
+  }
+
+  std::streambuf* File;
+  vtkTypeInt64 FilePosition = 0;
+  vtkTypeInt64 Position = 0;
+  std::map<vtkTypeInt64, std::string> Ranges;
+};
+}
+
 //-----------------------------------------------------------------------------
 vtkSpyPlotUniReader::vtkSpyPlotUniReader()
 {
@@ -86,6 +275,9 @@ vtkSpyPlotUniReader::vtkSpyPlotUniReader()
   this->DataTypeChanged = 0;
   this->GeomTimeStep = -1; // Indicate that geometry will have to be loaded
   this->NeedToCheck = 1;   // Indicates non-geometric data needs to be checked
+  this->BlocksUpdated = 0;
+  this->DataBlockRange[0] = 0;
+  this->DataBlockRange[1] = VTK_INT_MAX;
   if (!this->HaveInformation)
   {
     vtkDebugMacro(<< __LINE__ << " " << this << " Read: " << this->HaveInformation);
@@ -198,14 +390,8 @@ void vtkSpyPlotUniReader::SetDownConvertVolumeFraction(int vf)
 }
 
 //-----------------------------------------------------------------------------
-int vtkSpyPlotUniReader::MakeCurrent()
+int vtkSpyPlotUniReader::UpdateBlocks()
 {
-  if (!(this->NeedToCheck || (this->GeomTimeStep != this->CurrentTimeStep)))
-  {
-    // Nothing needs to be done
-    return 1;
-  }
-
   if (!this->HaveInformation)
   {
     vtkDebugMacro(<< __LINE__ << " " << this << " Read: " << this->HaveInformation);
@@ -216,79 +402,143 @@ int vtkSpyPlotUniReader::MakeCurrent()
     }
   }
 
+  if (this->GeomTimeStep == this->CurrentTimeStep)
+  {
+    // Nothing needs to be done
+    return 1;
+  }
+
   std::vector<unsigned char> arrayBuffer;
   vtksys::ifstream ifs(this->FileName, ios::binary | ios::in);
   vtkSpyPlotIStream spis;
   spis.SetStream(&ifs);
-  int dump;
-  vtkSpyPlotUniReader::DataDump* dp;
-  int blocksUpdated = 0;
-  int needMarkers = this->GenerateMarkers && this->MarkersOn;
 
-  // Do we have to update blocks
-  if (this->GeomTimeStep != this->CurrentTimeStep)
+  int block;
+  this->GeomTimeStep = this->CurrentTimeStep;
+  this->BlocksUpdated = 1;
+  vtkSpyPlotUniReader::DataDump* dp = this->DataDumps + this->CurrentTimeStep;
+  // vtkDebugMacro( "Dump: " << dump << " / "
+  // << this->NumberOfDataDumps << " at time: " << this->DumpTime[dump] );
+
+  // Load in the grid block information
+  // Advance the stream to where the block definitions are
+  spis.Seek(dp->BlocksOffset);
+  for (block = 0; block < dp->NumberOfBlocks; ++block)
   {
-    int block;
-    this->GeomTimeStep = this->CurrentTimeStep;
-    blocksUpdated = 1;
-    dump = this->CurrentTimeStep;
-    dp = this->DataDumps + dump;
-    // vtkDebugMacro( "Dump: " << dump << " / "
-    // << this->NumberOfDataDumps << " at time: " << this->DumpTime[dump] );
-
-    // Load in the grid block information
-    // Advance the stream to where the block definitions are
-    spis.Seek(dp->BlocksOffset);
-    for (block = 0; block < dp->NumberOfBlocks; ++block)
+    // long l = ifs.tellg();
+    vtkSpyPlotBlock* b = &(this->Blocks[block]);
+    if (!b->Read(this->IsAMR(), this->FileVersion, &spis))
     {
-      // long l = ifs.tellg();
-      vtkSpyPlotBlock* b = &(this->Blocks[block]);
-      if (!b->Read(this->IsAMR(), this->FileVersion, &spis))
-      {
-        vtkErrorMacro("Problem reading the block information");
-        return 0;
-      }
+      vtkErrorMacro("Problem reading the block information");
+      return 0;
     }
+  }
 
-    // Advance the stream to where the block geometries are
-    spis.Seek(dp->SavedBlocksGeometryOffset);
-    for (block = 0; block < dp->NumberOfBlocks; ++block)
+  // Advance the stream to where the block geometries are
+  spis.Seek(dp->SavedBlocksGeometryOffset);
+  for (block = 0; block < dp->NumberOfBlocks; ++block)
+  {
+    vtkSpyPlotBlock* b = &(this->Blocks[block]);
+    if (b->IsAllocated())
     {
-      vtkSpyPlotBlock* b = &(this->Blocks[block]);
-      if (b->IsAllocated())
+      int numBytes;
+      int component;
+      // vtkDebugMacro( "Block: " << block );
+      for (component = 0; component < 3; ++component)
       {
-        int numBytes;
-        int component;
-        // vtkDebugMacro( "Block: " << block );
-        for (component = 0; component < 3; ++component)
+        if (!spis.ReadInt32s(&numBytes, 1))
         {
-          if (!spis.ReadInt32s(&numBytes, 1))
-          {
-            vtkErrorMacro("Problem reading the number of bytes");
-            return 0;
-          }
-          // vtkDebugMacro( "  Number of bytes for " << component << ": "
-          // << numBytes );
-          if (static_cast<int>(arrayBuffer.size()) < numBytes)
-          {
-            arrayBuffer.resize(numBytes);
-          }
+          vtkErrorMacro("Problem reading the number of bytes");
+          return 0;
+        }
+        // vtkDebugMacro( "  Number of bytes for " << component << ": "
+        // << numBytes );
+        if (static_cast<int>(arrayBuffer.size()) < numBytes)
+        {
+          arrayBuffer.resize(numBytes);
+        }
 
-          if (!spis.ReadString(&*arrayBuffer.begin(), numBytes))
-          {
-            vtkErrorMacro("Problem reading the bytes");
-            return 0;
-          }
-          if (!b->SetGeometry(component, &*arrayBuffer.begin(), numBytes))
-          {
-            vtkErrorMacro("Problem RLD decoding rectilinear grid array: " << component);
-            return 0;
-          }
-          vtkDebugMacro(" " << b << " geometry initialized");
+        if (!spis.ReadString(&*arrayBuffer.begin(), numBytes))
+        {
+          vtkErrorMacro("Problem reading the bytes");
+          return 0;
+        }
+        if (!b->SetGeometry(component, &*arrayBuffer.begin(), numBytes))
+        {
+          vtkErrorMacro("Problem RLD decoding rectilinear grid array: " << component);
+          return 0;
         }
+        vtkDebugMacro(" " << b << " geometry initialized");
       }
     }
   }
+  return 1;
+}
+
+//-----------------------------------------------------------------------------
+void vtkSpyPlotUniReader::SetDataBlockRange(int first, int last)
+{
+  if (this->DataBlockRange[0] != first || this->DataBlockRange[1] != last)
+  {
+    this->DataBlockRange[0] = first;
+    this->DataBlockRange[1] = last;
+    // blocks that entered the range have to be read
+    this->NeedToCheck = 1;
+    this->Modified();
+  }
+}
+
+//-----------------------------------------------------------------------------
+int vtkSpyPlotUniReader::GetDataBlocksNumberOfCells(std::vector<vtkIdType>& numberOfCells)
+{
+  numberOfCells.clear();
+  if (!this->UpdateBlocks())
+  {
+    return 0;
+  }
+
+  vtkSpyPlotUniReader::DataDump* dp = this->DataDumps + this->CurrentTimeStep;
+  numberOfCells.reserve(dp->ActualNumberOfBlocks);
+  for (int block = 0; block < dp->NumberOfBlocks; ++block)
+  {
+    vtkSpyPlotBlock* bk = this->Blocks + block;
+    if (bk->IsAllocated())
+    {
+      numberOfCells.push_back(static_cast<vtkIdType>(bk->GetDimension(0)) * bk->GetDimension(1) *
+        bk->GetDimension(2));
+    }
+  }
+  return 1;
+}
+
+namespace
+{
+// A run-length encoded plane of a cell field, read from the file and waiting
+// to be decoded in one of the arrays.
+struct vtkSpyPlotDecodeTask
+{
+  size_t Offset;
+  int NumberOfBytes;
+  float* FloatData;
+  unsigned char* UnsignedCharData;
+  int PlaneSize;
+};
+}
+
+//-----------------------------------------------------------------------------
+int vtkSpyPlotUniReader::MakeCurrent()
+{
+  if (!(this->NeedToCheck || (this->GeomTimeStep != this->CurrentTimeStep)))
+  {
+    // Nothing needs to be done
+    return 1;
+  }
+
+  // Do we have to update blocks
+  if (!this->UpdateBlocks())
+  {
+    return 0;
+  }
 
   if (!this->NeedToCheck)
   {
@@ -297,6 +547,14 @@ int vtkSpyPlotUniReader::MakeCurrent()
 
   this->NeedToCheck = 0;
 
+  std::vector<unsigned char> arrayBuffer;
+  vtksys::ifstream ifs(this->FileName, ios::binary | ios::in);
+  vtkSpyPlotIStream spis;
+  spis.SetStream(&ifs);
+  int dump;
+  vtkSpyPlotUniReader::DataDump* dp;
+  int needMarkers = this->GenerateMarkers && this->MarkersOn;
+
   for (dump = 0; dump < this->NumberOfDataDumps; ++dump)
   {
     if (dump != this->CurrentTimeStep)
@@ -330,19 +588,16 @@ int vtkSpyPlotUniReader::MakeCurrent()
   dump = this->CurrentTimeStep;
   dp = this->DataDumps + dump;
 
+  // Only the fields of the blocks in DataBlockRange are read
+  const int firstBlock = std::max(this->DataBlockRange[0], 0);
+  const int lastBlock = std::min(this->DataBlockRange[1], dp->ActualNumberOfBlocks - 1);
+
   for (int fieldCnt = 0; fieldCnt < dp->NumVars; ++fieldCnt)
   {
     vtkSpyPlotUniReader::Variable* var = dp->Variables + fieldCnt;
     vtkDebugMacro("Variable: " << var << " (" << var->Name << ") - " << fieldCnt
                                << " (file: " << this->FileName << ") ");
 
-    // Do we need to create new data blocks
-    int blocksExists = 0;
-    if (var->DataBlocks)
-    {
-      vtkDebugMacro(" *** Looks like variable: " << var->Name << " is already loaded");
-      blocksExists = 1;
-    }
     // Did we create data blocks that we do not need any more
     if ((!this->CellArraySelection->ArrayIsEnabled(var->Name)) ||
       (this->DataTypeChanged && this->IsVolumeFraction(var)))
@@ -353,8 +608,11 @@ int vtkSpyPlotUniReader::MakeCurrent()
         int dataBlock;
         for (dataBlock = 0; dataBlock < dp->ActualNumberOfBlocks; ++dataBlock)
         {
-          var->DataBlocks[dataBlock]->Delete();
-          var->DataBlocks[dataBlock] = nullptr;
+          if (var->DataBlocks[dataBlock])
+          {
+            var->DataBlocks[dataBlock]->Delete();
+            var->DataBlocks[dataBlock] = nullptr;
+          }
         }
         delete[] var->DataBlocks;
         var->DataBlocks = nullptr;
@@ -378,9 +636,18 @@ int vtkSpyPlotUniReader::MakeCurrent()
       var->GhostCellsFixed = new int[dp->ActualNumberOfBlocks];
       memset(var->GhostCellsFixed, 0, dp->ActualNumberOfBlocks * sizeof(int));
       vtkDebugMacro(" Allocate DataBlocks: " << var->DataBlocks);
-      blocksExists = 0;
     }
 
+    // Do we need to create new data blocks
+    int blocksExists = 1;
+    for (int dataBlock = firstBlock; dataBlock <= lastBlock; ++dataBlock)
+    {
+      if (!var->DataBlocks[dataBlock])
+      {
+        blocksExists = 0;
+        break;
+      }
+    }
     if (blocksExists)
     {
       vtkDebugMacro(<< var << " Skip reading of variable: " << var->Name << " / "
@@ -391,88 +658,109 @@ int vtkSpyPlotUniReader::MakeCurrent()
     // vtkDebugMacro( "  Field: " << fieldCnt << " / " << dp->NumVars
     // << " [" << var->Name << "]" );
     // vtkDebugMacro( "    Jump to: " << dp->SavedVariableOffsets[fieldCnt] );
+    // The planes are read sequentially, then decoded concurrently.
     spis.Seek(dp->SavedVariableOffsets[fieldCnt]);
+    std::vector<vtkSpyPlotDecodeTask> tasks;
+    std::vector<int> newBlocks;
+    size_t bufferSize = 0;
     int numBytes;
     int block;
     int actualBlockId = 0;
     for (block = 0; block < dp->NumberOfBlocks; ++block)
     {
       vtkSpyPlotBlock* bk = this->Blocks + block;
-      if (bk->IsAllocated())
+      if (!bk->IsAllocated())
+      {
+        continue;
+      }
+      vtkFloatArray* floatArray = nullptr;
+      vtkUnsignedCharArray* unsignedCharArray = nullptr;
+      if (actualBlockId >= firstBlock && actualBlockId <= lastBlock &&
+        !var->DataBlocks[actualBlockId])
       {
-        vtkFloatArray* floatArray = nullptr;
-        vtkUnsignedCharArray* unsignedCharArray = nullptr;
-        vtkDataArray* dataArray = nullptr;
-        if (this->CellArraySelection->ArrayIsEnabled(var->Name) && !var->DataBlocks[actualBlockId])
+        vtkDataArray* dataArray;
+        if (this->DownConvertVolumeFraction && this->IsVolumeFraction(var))
         {
-          if (this->DownConvertVolumeFraction && this->IsVolumeFraction(var))
-          {
-            unsignedCharArray = vtkUnsignedCharArray::New();
-            dataArray = unsignedCharArray;
-          }
-          else
-          {
-            floatArray = vtkFloatArray::New();
-            dataArray = floatArray;
-          }
-          dataArray->SetNumberOfComponents(1);
-          dataArray->SetNumberOfTuples(
-            bk->GetDimension(0) * bk->GetDimension(1) * bk->GetDimension(2));
-          dataArray->SetName(var->Name);
-          // vtkDebugMacro( "*** Create data array: "
-          // << dataArray->GetNumberOfTuples() );
+          unsignedCharArray = vtkUnsignedCharArray::New();
+          dataArray = unsignedCharArray;
         }
-        int zax;
-        int bdims[3];
-        bk->GetDimensions(bdims);
-        for (zax = 0; zax < bdims[2]; ++zax)
+        else
         {
-          int planeSize = bdims[0] * bdims[1];
-          if (!spis.ReadInt32s(&numBytes, 1))
-          {
-            vtkErrorMacro("Problem reading the number of bytes");
-            return 0;
-          }
-          if (static_cast<int>(arrayBuffer.size()) < numBytes)
-          {
-            arrayBuffer.resize(numBytes);
-          }
-          if (!spis.ReadString(&*arrayBuffer.begin(), numBytes))
-          {
-            vtkErrorMacro("Problem reading the bytes");
-            return 0;
-          }
-          if (floatArray)
-          {
-            float* ptr = floatArray->GetPointer(zax * planeSize);
-            if (!this->RunLengthDataDecode(&*arrayBuffer.begin(), numBytes, ptr, planeSize))
-            {
-              vtkErrorMacro("Problem RLD decoding float data array");
-              return 0;
-            }
-          }
-          if (unsignedCharArray)
-          {
-            unsigned char* ptr = unsignedCharArray->GetPointer(zax * planeSize);
-            if (!this->RunLengthDataDecode(&*arrayBuffer.begin(), numBytes, ptr, planeSize))
-            {
-              vtkErrorMacro("Problem RLD decoding unsigned char data array");
-              return 0;
-            }
-          }
+          floatArray = vtkFloatArray::New();
+          dataArray = floatArray;
+        }
+        dataArray->SetNumberOfComponents(1);
+        dataArray->SetNumberOfTuples(
+          bk->GetDimension(0) * bk->GetDimension(1) * bk->GetDimension(2));
+        dataArray->SetName(var->Name);
+        var->DataBlocks[actualBlockId] = dataArray;
+        var->GhostCellsFixed[actualBlockId] = 0;
+        newBlocks.push_back(actualBlockId);
+        vtkDebugMacro(" " << dataArray << " initialized: " << dataArray->GetName());
+      }
+      int zax;
+      int bdims[3];
+      bk->GetDimensions(bdims);
+      int planeSize = bdims[0] * bdims[1];
+      for (zax = 0; zax < bdims[2]; ++zax)
+      {
+        if (!spis.ReadInt32s(&numBytes, 1))
+        {
+          vtkErrorMacro("Problem reading the number of bytes");
+          return 0;
         }
-        if (dataArray)
+        if (!floatArray && !unsignedCharArray)
         {
-          var->DataBlocks[actualBlockId] = dataArray;
-          var->GhostCellsFixed[actualBlockId] = 0;
-          vtkDebugMacro(" " << dataArray << " initialized: " << dataArray->GetName());
-          actualBlockId++;
+          spis.Seek(numBytes, true);
+          continue;
+        }
+        arrayBuffer.resize(bufferSize + numBytes);
+        if (!spis.ReadString(arrayBuffer.data() + bufferSize, numBytes))
+        {
+          vtkErrorMacro("Problem reading the bytes");
+          return 0;
         }
+        vtkSpyPlotDecodeTask task;
+        task.Offset = bufferSize;
+        task.NumberOfBytes = numBytes;
+        task.FloatData = floatArray ? floatArray->GetPointer(zax * planeSize) : nullptr;
+        task.UnsignedCharData =
+          unsignedCharArray ? unsignedCharArray->GetPointer(zax * planeSize) : nullptr;
+        task.PlaneSize = planeSize;
+        tasks.push_back(task);
+        bufferSize += numBytes;
+      }
+      actualBlockId++;
+    }
+
+    std::atomic<bool> decoded(true);
+    vtkSMPTools::For(0, static_cast<vtkIdType>(tasks.size()), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType cc = begin; cc < end && decoded; ++cc)
+      {
+        const vtkSpyPlotDecodeTask& task = tasks[cc];
+        const unsigned char* in = arrayBuffer.data() + task.Offset;
+        if (task.FloatData
+            ? !this->RunLengthDataDecode(in, task.NumberOfBytes, task.FloatData, task.PlaneSize)
+            : !this->RunLengthDataDecode(
+                in, task.NumberOfBytes, task.UnsignedCharData, task.PlaneSize))
+        {
+          decoded = false;
+        }
+      }
+    });
+    if (!decoded)
+    {
+      vtkErrorMacro("Problem RLD decoding data array: " << var->Name);
+      for (int dataBlock : newBlocks)
+      {
+        var->DataBlocks[dataBlock]->Delete();
+        var->DataBlocks[dataBlock] = nullptr;
       }
+      return 0;
     }
   }
 
-  if (blocksUpdated && needMarkers)
+  if (this->BlocksUpdated && needMarkers)
   {
     if (this->ReadMarkerDumps(&spis) == 0)
     {
@@ -481,6 +769,7 @@ int vtkSpyPlotUniReader::MakeCurrent()
     }
   }
 
+  this->BlocksUpdated = 0;
   this->DataTypeChanged = 0;
   return 1;
 }
@@ -1342,6 +1631,8 @@ void vtkSpyPlotUniReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "DataTypeChanged: " << this->DataTypeChanged << endl;
   os << indent << "NumberOfCellFields: " << this->NumberOfCellFields << endl;
   os << indent << "NeedToCheck: " << this->NeedToCheck << endl;
+  os << indent << "DataBlockRange: " << this->DataBlockRange[0] << " " << this->DataBlockRange[1]
+     << endl;
 }
 
 //-----------------------------------------------------------------------------
@@ -1369,10 +1660,66 @@ int vtkSpyPlotUniReader::ReadInformation()
     vtkErrorMacro("Cannot open file: " << this->FileName);
     return 0;
   }
+
+  // record what is read so that it can be shared, see GetMetaData()
+  vtkSpyPlotMetaDataBuffer buffer(ifs.rdbuf());
+  istream stream(&buffer);
   vtkSpyPlotIStream spis;
-  spis.SetStream(&ifs);
+  spis.SetStream(&stream);
+  if (!this->ParseInformation(&spis))
+  {
+    return 0;
+  }
+  this->MetaData = buffer.Serialize();
+  return 1;
+}
+
+//-----------------------------------------------------------------------------
+bool vtkSpyPlotUniReader::GetMetaData(std::string& metaData)
+{
+  if (!this->ReadInformation())
+  {
+    return false;
+  }
+  metaData = this->MetaData;
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+bool vtkSpyPlotUniReader::SetMetaData(const std::string& metaData)
+{
+  if (this->HaveInformation)
+  {
+    vtkErrorMacro("The information was already read");
+    return false;
+  }
+  if (!this->CellArraySelection)
+  {
+    vtkErrorMacro("Cell array selection not specified");
+    return false;
+  }
 
-  if (!this->ReadHeader(&spis))
+  vtkSpyPlotMetaDataBuffer buffer(nullptr);
+  if (!buffer.Deserialize(metaData))
+  {
+    vtkErrorMacro("Invalid meta-data for file: " << (this->FileName ? this->FileName : "(none)"));
+    return false;
+  }
+  istream stream(&buffer);
+  vtkSpyPlotIStream spis;
+  spis.SetStream(&stream);
+  if (!this->ParseInformation(&spis))
+  {
+    return false;
+  }
+  this->MetaData = metaData;
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+int vtkSpyPlotUniReader::ParseInformation(vtkSpyPlotIStream* spis)
+{
+  if (!this->ReadHeader(spis))
   {
     vtkErrorMacro("Invalid Header");
     return 0;
@@ -1382,20 +1729,20 @@ int vtkSpyPlotUniReader::ReadInformation()
   this->Blocks = new vtkSpyPlotBlock[this->NumberOfBlocks];
 
   // Process all the Cell Material  Fields
-  if (!this->ReadCellVariableInfo(&spis))
+  if (!this->ReadCellVariableInfo(spis))
   {
     vtkErrorMacro("Invalid cell variable section");
     return 0;
   }
 
   // Read all possible material fields
-  if (!this->ReadMaterialInfo(&spis))
+  if (!this->ReadMaterialInfo(spis))
   {
     vtkErrorMacro("Invalid material section");
     return 0;
   }
 
-  if (!this->ReadGroupHeaderInformation(&spis))
+  if (!this->ReadGroupHeaderInformation(spis))
   {
     vtkErrorMacro("Problem reading group header information");
     return 0;
@@ -1414,7 +1761,7 @@ int vtkSpyPlotUniReader::ReadInformation()
   this->TimeRange[0] = this->DumpTime[0];
   this->TimeRange[1] = this->DumpTime[this->NumberOfDataDumps - 1];
 
-  if (!this->ReadDataDumps(&spis))
+  if (!this->ReadDataDumps(spis))
   {
     vtkErrorMacro("Problem reading time information");
     return 0;
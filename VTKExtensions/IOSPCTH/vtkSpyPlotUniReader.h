@@ -25,6 +25,10 @@
 
 #include "vtkObject.h"
 #include "vtkPVVTKExtensionsIOSPCTHModule.h" //needed for exports
+
+#include <string> // for std::string
+#include <vector> // for std::vector
+
 class vtkSpyPlotBlock;
 class vtkDataArraySelection;
 class vtkDataArray;
@@ -55,12 +59,48 @@ public:
    */
   virtual int ReadInformation();
 
+  ///@{
+  /**
+   * Get/Set the meta-data of the file, i.e. the parts of the file that
+   * ReadInformation() parses. GetMetaData() reads the information if needed.
+   * SetMetaData() parses the given meta-data instead of opening the file,
+   * which lets a single process read the headers and share them with the
+   * others. SetMetaData() must be called before the information is read.
+   * Both return false on failure.
+   */
+  bool GetMetaData(std::string& metaData);
+  bool SetMetaData(const std::string& metaData);
+  ///@}
+
   /**
    * Make sure that actual data (including grid blocks) is current
    * else it will read in the required data from file
    */
   int MakeCurrent();
 
+  /**
+   * Make sure that the grid blocks (headers and geometry) of the current
+   * time step are current, without decoding any cell field. MakeCurrent()
+   * calls this method.
+   */
+  int UpdateBlocks();
+
+  ///@{
+  /**
+   * Set and get the range of data blocks (as indexed by GetBlock()) whose
+   * cell fields are decoded by MakeCurrent(). Fields of blocks outside of the
+   * range are skipped. The range is inclusive. Defaults to all blocks.
+   */
+  void SetDataBlockRange(int first, int last);
+  vtkGetVector2Macro(DataBlockRange, int);
+  ///@}
+
+  /**
+   * Fills `numberOfCells` with the number of cells of each data block of the
+   * current time step. Only the block headers are read. Returns 0 on failure.
+   */
+  int GetDataBlocksNumberOfCells(std::vector<vtkIdType>& numberOfCells);
+
   void PrintInformation();
   void PrintMemoryUsage();
 
@@ -233,6 +273,7 @@ private:
   int RunLengthDataDecode(const unsigned char* in, int inSize, int* out, int outSize);
   int RunLengthDataDecode(const unsigned char* in, int inSize, unsigned char* out, int outSize);
 
+  int ParseInformation(vtkSpyPlotIStream* spis);
   int ReadHeader(vtkSpyPlotIStream* spis);
   int ReadMarkerHeader(vtkSpyPlotIStream* spis);
   int ReadCellVariableInfo(vtkSpyPlotIStream* spis);
@@ -282,6 +323,9 @@ private:
   // Was information read
   int HaveInformation;
 
+  // Parts of the file parsed by ReadInformation
+  std::string MetaData;
+
   // Current time and time range information
   int CurrentTimeStep;
   // Time step that the geometry represents
@@ -296,6 +340,12 @@ private:
   // optimize this
   int NeedToCheck;
 
+  // Indicates that the grid blocks were read since the markers were.
+  int BlocksUpdated;
+
+  // Range of data blocks whose cell fields are read
+  int DataBlockRange[2];
+
   int DataTypeChanged;
   int DownConvertVolumeFraction;
 
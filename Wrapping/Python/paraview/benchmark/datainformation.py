@@ -0,0 +1,80 @@
+'''
+Benchmark for gathering data information across ranks.
+
+Every rank produces a multiblock dataset with a configurable number of blocks
+and arrays. The data information is then gathered from all ranks repeatedly and
+the time per gather is reported. Run it with increasing rank counts to measure
+how the gather scales, e.g.::
+
+    mpiexec -n 64 pvbatch -m paraview.benchmark.datainformation -b 100 -i 20
+'''
+
+from paraview import servermanager
+from paraview.simple import *
+
+
+def run(num_blocks=100, num_arrays=4, num_iterations=10):
+    from vtkmodules.vtkCommonSystem import vtkTimerLog
+    from vtkmodules.vtkParallelCore import vtkMultiProcessController
+    from vtkmodules.vtkRemotingCore import vtkPVDataInformation, vtkPVSession
+
+    source = ProgrammableSource(OutputDataSetType='vtkMultiBlockDataSet', Script='''
+from vtkmodules.vtkCommonCore import vtkDoubleArray
+from vtkmodules.vtkCommonDataModel import vtkImageData
+from vtkmodules.vtkParallelCore import vtkMultiProcessController
+
+rank = vtkMultiProcessController.GetGlobalController().GetLocalProcessId()
+output = self.GetOutput()
+for block in range(%d):
+    img = vtkImageData()
+    img.SetDimensions(8, 8, 8)
+    img.SetOrigin(rank * 10, block * 10, 0)
+    for index in range(%d):
+        array = vtkDoubleArray()
+        array.SetName('array%%d' %% index)
+        array.SetNumberOfTuples(img.GetNumberOfPoints())
+        array.Fill(rank + block + index)
+        img.GetPointData().AddArray(array)
+    output.SetBlock(block, img)
+''' % (num_blocks, num_arrays))
+    source.UpdatePipeline()
+
+    session = servermanager.ActiveConnection.Session
+    globalid = source.GetGlobalID()
+
+    timer = vtkTimerLog()
+    info = vtkPVDataInformation()
+    timer.StartTimer()
+    for i in range(num_iterations):
+        info.Initialize()
+        session.GatherInformation(vtkPVSession.DATA_SERVER, info, globalid)
+    timer.StopTimer()
+
+    num_ranks = session.GetNumberOfProcesses(vtkPVSession.DATA_SERVER)
+    print('Ranks:                %d' % num_ranks)
+    print('Blocks:               %d' % info.GetNumberOfDataSets())
+    print('Points:               %d' % info.GetNumberOfPoints())
+    print('Time per gather (ms): %f' %
+          (1000.0 * timer.GetElapsedTime() / num_iterations))
+    Delete(source)
+
+
+def main(argv):
+    import argparse
+    parser = argparse.ArgumentParser(
+        description='Benchmark gathering data information across ranks')
+    parser.add_argument('-b', '--blocks', default=100, type=int,
+                        help='Number of blocks generated on each rank')
+    parser.add_argument('-a', '--arrays', default=4, type=int,
+                        help='Number of point arrays on each block')
+    parser.add_argument('-i', '--iterations', default=10, type=int,
+                        help='Number of times the data information is gathered')
+
+    args = parser.parse_args(argv)
+    run(num_blocks=args.blocks, num_arrays=args.arrays,
+        num_iterations=args.iterations)
+
+
+if __name__ == "__main__":
+    import sys
+    main(sys.argv[1:])